@@ -0,0 +1,254 @@
+#ifndef ARENA_H_INCLUDED
+#define ARENA_H_INCLUDED
+
+// Growable bump allocator, memory is handed out from large blocks and everything is freed at once when the arena is destroyed
+// Each new block is twice as large as the previous one so a structure of any size only needs a handful of blocks
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include <errno.h>
+#include <stdbool.h>
+
+#define ERR_PREFIX ARN
+#include <Error.h>
+
+#ifndef ARN_BLOCKSIZE
+#define ARN_BLOCKSIZE 4096 // The size of the first block of an arena if no size is given
+#endif
+
+#ifndef ARN_MAXBLOCKSIZE
+#define ARN_MAXBLOCKSIZE 0x4000000 // Blocks stop growing at this size, larger allocations still get a block of their own
+#endif
+
+// The alignment of all allocations unless another one is asked for
+#define ARN_ALIGN (sizeof(max_align_t))
+
+enum _ARN_ErrorID {
+    _ARN_ERRORID_NONE = 0x800000000,
+    _ARN_ERRORID_CREATEARENA_MALLOC = 0x800010200,
+    _ARN_ERRORID_CREATEARENA_BLOCK = 0x800010201,
+    _ARN_ERRORID_ALLOCALIGNED_BLOCK = 0x800020200,
+    _ARN_ERRORID_ALLOCALIGNED_SIZE = 0x800020201,
+    _ARN_ERRORID_COPYSTRING_ALLOC = 0x800030200,
+    _ARN_ERRORID_ADDBLOCK_MALLOC = 0x800040200,
+    _ARN_ERRORID_ADDBLOCK_SIZE = 0x800040201
+};
+
+#define _ARN_ERRORMES_MALLOC "Unable to allocate memory (Size: %lu)"
+#define _ARN_ERRORMES_ALLOC "Unable to allocate memory in arena (Size: %lu)"
+#define _ARN_ERRORMES_SIZE "The size is too large (Size: %lu)"
+
+typedef struct __ARN_Block ARN_Block;
+typedef struct __ARN_Arena ARN_Arena;
+
+struct __ARN_Block {
+    ARN_Block *next; // The previous block, blocks are kept in a list with the newest first
+    size_t size; // The number of bytes in data
+    size_t used; // The number of bytes of data which have been handed out
+    max_align_t data[]; // The memory handed out
+};
+
+struct __ARN_Arena {
+    ARN_Block *block; // The block allocations are taken from
+    size_t blockSize; // The size of the next block
+    size_t size; // The total number of bytes in all blocks
+    size_t used; // The total number of bytes handed out
+};
+
+// Creates a new arena
+// BlockSize: The size of the first block, 0 to use ARN_BLOCKSIZE
+ARN_Arena *ARN_CreateArena(size_t BlockSize);
+
+// Allocates memory aligned to ARN_ALIGN, returns NULL on error
+// Arena: The arena to allocate from
+// Size: The number of bytes
+void *ARN_Alloc(ARN_Arena *Arena, size_t Size);
+
+// Allocates memory with a specific alignment, returns NULL on error
+// Arena: The arena to allocate from
+// Size: The number of bytes
+// Align: The alignment, it must be a power of 2
+void *ARN_AllocAligned(ARN_Arena *Arena, size_t Size, size_t Align);
+
+// Copies a string into the arena and NULL terminates it, returns NULL on error
+// Arena: The arena to allocate from
+// String: The string to copy
+// Length: The number of characters to copy
+char *ARN_CopyString(ARN_Arena *Arena, const char *String, size_t Length);
+
+// Returns the total number of bytes allocated from the system
+// Arena: The arena to get the size of
+size_t ARN_ArenaSize(ARN_Arena *Arena);
+
+// Allocates a new block which fits at least Size bytes, returns false on error
+// Arena: The arena to add the block to
+// Size: The number of bytes it must fit
+bool _ARN_AddBlock(ARN_Arena *Arena, size_t Size);
+
+void ARN_InitArena(ARN_Arena *Struct);
+void ARN_InitBlock(ARN_Block *Struct);
+
+void ARN_DestroyArena(ARN_Arena *Arena);
+
+ARN_Arena *ARN_CreateArena(size_t BlockSize)
+{
+    ARN_Arena *Arena = (ARN_Arena *)malloc(sizeof(ARN_Arena));
+
+    if (Arena == NULL)
+    {
+        _ARN_AddErrorForeign(_ARN_ERRORID_CREATEARENA_MALLOC, strerror(errno), _ARN_ERRORMES_MALLOC, sizeof(ARN_Arena));
+        return NULL;
+    }
+
+    ARN_InitArena(Arena);
+
+    if (BlockSize > 0)
+        Arena->blockSize = BlockSize;
+
+    // Get the first block
+    if (!_ARN_AddBlock(Arena, 0))
+    {
+        _ARN_AddError(_ARN_ERRORID_CREATEARENA_BLOCK, _ARN_ERRORMES_ALLOC, Arena->blockSize);
+        ARN_DestroyArena(Arena);
+        return NULL;
+    }
+
+    return Arena;
+}
+
+void *ARN_Alloc(ARN_Arena *Arena, size_t Size)
+{
+    // The data of a block is aligned to ARN_ALIGN, so it is enough to align the offset, it is only unaligned after an ARN_AllocAligned
+    size_t Start = (Arena->block->used + ARN_ALIGN - 1) & ~(ARN_ALIGN - 1);
+
+    // Fast path
+    if (Start <= Arena->block->size && Arena->block->size - Start >= Size)
+    {
+        void *Memory = (uint8_t *)Arena->block->data + Start;
+        Arena->used += Start - Arena->block->used + Size;
+        Arena->block->used = Start + Size;
+        return Memory;
+    }
+
+    return ARN_AllocAligned(Arena, Size, ARN_ALIGN);
+}
+
+void *ARN_AllocAligned(ARN_Arena *Arena, size_t Size, size_t Align)
+{
+    // Find the aligned position in the current block
+    uintptr_t Start = (uintptr_t)Arena->block->data + Arena->block->used;
+    size_t Padding = ((Start + Align - 1) & ~(uintptr_t)(Align - 1)) - Start;
+
+    // Make sure the size with padding does not overflow
+    if (Size > SIZE_MAX - Align)
+    {
+        _ARN_AddError(_ARN_ERRORID_ALLOCALIGNED_SIZE, _ARN_ERRORMES_SIZE, Size);
+        return NULL;
+    }
+
+    // Get a new block if it does not fit
+    if (Arena->block->size - Arena->block->used < Padding + Size)
+    {
+        if (!_ARN_AddBlock(Arena, Size + Align))
+        {
+            _ARN_AddError(_ARN_ERRORID_ALLOCALIGNED_BLOCK, _ARN_ERRORMES_ALLOC, Size);
+            return NULL;
+        }
+
+        Start = (uintptr_t)Arena->block->data;
+        Padding = ((Start + Align - 1) & ~(uintptr_t)(Align - 1)) - Start;
+    }
+
+    void *Memory = (uint8_t *)Arena->block->data + Arena->block->used + Padding;
+    Arena->block->used += Padding + Size;
+    Arena->used += Padding + Size;
+
+    return Memory;
+}
+
+char *ARN_CopyString(ARN_Arena *Arena, const char *String, size_t Length)
+{
+    char *NewString = (char *)ARN_AllocAligned(Arena, sizeof(char) * (Length + 1), 1);
+
+    if (NewString == NULL)
+    {
+        _ARN_AddError(_ARN_ERRORID_COPYSTRING_ALLOC, _ARN_ERRORMES_ALLOC, sizeof(char) * (Length + 1));
+        return NULL;
+    }
+
+    memcpy(NewString, String, sizeof(char) * Length);
+    NewString[Length] = '\0';
+
+    return NewString;
+}
+
+size_t ARN_ArenaSize(ARN_Arena *Arena)
+{
+    return Arena->size;
+}
+
+bool _ARN_AddBlock(ARN_Arena *Arena, size_t Size)
+{
+    // Find the size of the block
+    size_t BlockSize = Arena->blockSize;
+
+    if (BlockSize < Size)
+        BlockSize = Size;
+
+    if (BlockSize > SIZE_MAX - sizeof(ARN_Block))
+    {
+        _ARN_AddError(_ARN_ERRORID_ADDBLOCK_SIZE, _ARN_ERRORMES_SIZE, BlockSize);
+        return false;
+    }
+
+    ARN_Block *Block = (ARN_Block *)malloc(sizeof(ARN_Block) + BlockSize);
+
+    if (Block == NULL)
+    {
+        _ARN_AddErrorForeign(_ARN_ERRORID_ADDBLOCK_MALLOC, strerror(errno), _ARN_ERRORMES_MALLOC, sizeof(ARN_Block) + BlockSize);
+        return false;
+    }
+
+    ARN_InitBlock(Block);
+    Block->size = BlockSize;
+    Block->next = Arena->block;
+    Arena->block = Block;
+    Arena->size += BlockSize;
+
+    // The next block is larger
+    if (Arena->blockSize < ARN_MAXBLOCKSIZE)
+        Arena->blockSize *= 2;
+
+    return true;
+}
+
+void ARN_InitArena(ARN_Arena *Struct)
+{
+    Struct->block = NULL;
+    Struct->blockSize = ARN_BLOCKSIZE;
+    Struct->size = 0;
+    Struct->used = 0;
+}
+
+void ARN_InitBlock(ARN_Block *Struct)
+{
+    Struct->next = NULL;
+    Struct->size = 0;
+    Struct->used = 0;
+}
+
+void ARN_DestroyArena(ARN_Arena *Arena)
+{
+    for (ARN_Block *Block = Arena->block, *Next; Block != NULL; Block = Next)
+    {
+        Next = Block->next;
+        free(Block);
+    }
+
+    free(Arena);
+}
+
+#endif
@@ -3,24 +3,44 @@
 
 #include <stdio.h>
 #include <stdint.h>
+#include <stddef.h>
 #include <string.h>
 #include <errno.h>
 #include <stdbool.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <Hashing.h>
+#include <Arena.h>
 
 #define ERR_PREFIX DIC
 #include <Error.h>
 
+#ifndef DIC_INLINESIZE
+#define DIC_INLINESIZE 16 // Values copied with DIC_MODE_COPY of at most this size are stored inside the entry instead of getting their own allocation
+#endif
+
+#ifndef DIC_BATCHSIZE
+#define DIC_BATCHSIZE 16 // The number of keys DIC_GetItemBatch hashes and prefetches before resolving them
+#endif
+
+#ifndef DIC_BLOOMITEMS
+#define DIC_BLOOMITEMS 32 // The number of items each 64 byte block of a bloom filter is sized for
+#endif
+
 enum _DIC_ErrorID {
     _DIC_ERRORID_NONE = 0x600000000,
     _DIC_ERRORID_CREATEDIC_MALLOC = 0x600010200,
     _DIC_ERRORID_CREATEDIC_HASH = 0x600010201,
     _DIC_ERRORID_CREATEDIC_MALLOCLIST = 0x600010202,
-    _DIC_ERRORID_ADDITEM_MALLOCITEM = 0x600020200,
-    _DIC_ERRORID_ADDITEM_MALLOCKEY = 0x600020201,
+    _DIC_ERRORID_ADDITEM_MALLOCITEM = 0x600020200, // Deprecated, DIC_AddItem reports _DIC_ERRORID_ADDITEMHASHED_MALLOCITEM
+    _DIC_ERRORID_ADDITEM_MALLOCKEY = 0x600020201, // Deprecated, DIC_AddItem reports _DIC_ERRORID_ADDITEMHASHED_MALLOCKEY
     _DIC_ERRORID_ADDITEM_HASHTABLE = 0x600020202,
-    _DIC_ERRORID_ADDITEM_MALLOCVALUE = 0x600020203,
-    _DIC_ERRORID_DESTROYDICT_NODICT = 0x600030100,
+    _DIC_ERRORID_ADDITEM_MALLOCVALUE = 0x600020203, // Deprecated, DIC_AddItem reports _DIC_ERRORID_ADDITEMHASHED_MALLOCVALUE
+    _DIC_ERRORID_DESTROYDICT_NODICT = 0x600030100, // Deprecated, DIC_DestroyDict reports _DIC_ERRORID_RELEASEHASH_NODICT
     _DIC_ERRORID_CHECKITEM_HASHTABLE = 0x600040100,
     _DIC_ERRORID_GETITEM_HASHTABLE = 0x600050200,
     _DIC_ERRORID_GETITEM_NOITEM = 0x600050201,
@@ -30,7 +50,48 @@ enum _DIC_ErrorID {
     _DIC_ERRORID_COPYDICT_CREATE = 0x600080200,
     _DIC_ERRORID_COPYDICT_MALLOCLINK = 0x600080201,
     _DIC_ERRORID_COPYDICT_MALLOCKEY = 0x600080202,
-    _DIC_ERRORID_COPYDICT_MALLOCVALUE = 0x600080203
+    _DIC_ERRORID_COPYDICT_MALLOCVALUE = 0x600080203,
+    _DIC_ERRORID_COPYDICT_ADDITEM = 0x600080204,
+    _DIC_ERRORID_COPYDICT_BLOOM = 0x600080205,
+    _DIC_ERRORID_SAVE_HASHTABLE = 0x600090200,
+    _DIC_ERRORID_SAVE_FILE = 0x600090201,
+    _DIC_ERRORID_SAVE_WRITE = 0x600090202,
+    _DIC_ERRORID_MAP_OPEN = 0x6000A0200,
+    _DIC_ERRORID_MAP_STAT = 0x6000A0201,
+    _DIC_ERRORID_MAP_SMALL = 0x6000A0202,
+    _DIC_ERRORID_MAP_MMAP = 0x6000A0203,
+    _DIC_ERRORID_MAP_FORMAT = 0x6000A0204,
+    _DIC_ERRORID_MAP_MALLOC = 0x6000A0205,
+    _DIC_ERRORID_MAPGETITEM_NOITEM = 0x6000B0200,
+    _DIC_ERRORID_MAPGETITEM_CORRUPT = 0x6000B0201,
+    _DIC_ERRORID_UNMAP_MUNMAP = 0x6000C0100,
+    _DIC_ERRORID_TYPEDCREATEDICT_MALLOC = 0x6000D0200,
+    _DIC_ERRORID_TYPEDCREATEDICT_MALLOCLIST = 0x6000D0201,
+    _DIC_ERRORID_TYPEDADDITEM_MALLOCITEM = 0x6000E0200,
+    _DIC_ERRORID_TYPEDADDITEM_MALLOCKEY = 0x6000E0201,
+    _DIC_ERRORID_TYPEDADDITEM_MALLOCVALUE = 0x6000E0202,
+    _DIC_ERRORID_TYPEDGETITEM_NOITEM = 0x6000F0200,
+    _DIC_ERRORID_TYPEDREMOVEITEM_NOITEM = 0x600100200,
+    _DIC_ERRORID_CREATEORDEREDDICT_CREATE = 0x600110200,
+    _DIC_ERRORID_CREATEORDEREDDICT_MALLOC = 0x600110201,
+    _DIC_ERRORID_GETITEMBATCH_HASHTABLE = 0x600120200,
+    _DIC_ERRORID_ADDBLOOMFILTER_MALLOC = 0x600130200,
+    _DIC_ERRORID_INTERN_MALLOCPOOL = 0x600140200,
+    _DIC_ERRORID_INTERN_MALLOCENTRY = 0x600140201,
+    _DIC_ERRORID_INTERNKEYS_INTERN = 0x600150200,
+    _DIC_ERRORID_ADDBLOOMFILTER_ARENA = 0x600130201,
+    _DIC_ERRORID_ACQUIREHASH_CREATE = 0x600160200,
+    _DIC_ERRORID_RELEASEHASH_NODICT = 0x600170100,
+    _DIC_ERRORID_CREATEARENADICT_HASHTABLE = 0x600180200,
+    _DIC_ERRORID_CREATEARENADICT_ALLOC = 0x600180201,
+    _DIC_ERRORID_ADDITEMHASHED_MALLOCITEM = 0x600190200,
+    _DIC_ERRORID_ADDITEMHASHED_MALLOCKEY = 0x600190201,
+    _DIC_ERRORID_ADDITEMHASHED_MALLOCVALUE = 0x600190202,
+    _DIC_ERRORID_ADDITEMHASHED_REALLOCORDER = 0x600190203,
+    _DIC_ERRORID_ADDITEMHASHED_BLOOM = 0x600190204,
+    _DIC_ERRORID_ADDITEMHASHED_INTERN = 0x600190205,
+    _DIC_ERRORID_HASHKEY_HASHTABLE = 0x6001A0200,
+    _DIC_ERRORID_GETITEMHASHED_NOITEM = 0x6001B0200
 };
 
 #define _DIC_ERRORMES_MALLOC "Unable to allocate memory (Size: %lu)"
@@ -39,7 +100,30 @@ enum _DIC_ErrorID {
 #define _DIC_ERRORMES_NOHASHTABLE "No hash table is available (Expected number of dicts: %lu)"
 #define _DIC_ERRORMES_NOITEM "Unable to locate item"
 #define _DIC_ERRORMES_ADDITEM "Unable to add item"
+#define _DIC_ERRORMES_REALLOC "Unable to reallocate memory (Size: %lu)"
 #define _DIC_ERRORMES_CREATEDICT "Unable to create new dict"
+#define _DIC_ERRORMES_OPENFILE "Unable to open file \"%s\""
+#define _DIC_ERRORMES_WRITEFILE "Unable to write to file \"%s\""
+#define _DIC_ERRORMES_STATFILE "Unable to get the size of file \"%s\""
+#define _DIC_ERRORMES_SMALLFILE "File is too small to be a saved dict (%s: %lu)"
+#define _DIC_ERRORMES_MAPFILE "Unable to map file \"%s\""
+#define _DIC_ERRORMES_FORMAT "File is not a valid saved dict (%s)"
+#define _DIC_ERRORMES_CORRUPT "Saved dict points outside of the file or goes in circles (Offset: %lu)"
+#define _DIC_ERRORMES_UNMAP "Unable to unmap dict"
+#define _DIC_ERRORMES_COPYKEY "Unable to copy key"
+#define _DIC_ERRORMES_BLOOM "Unable to create bloom filter"
+#define _DIC_ERRORMES_INTERN "Unable to intern string (%s)"
+#define _DIC_ERRORMES_ARENA "Unable to allocate memory in arena (Size: %lu)"
+#define _DIC_ERRORMES_NOHOLD "No hash table is available, DIC_AcquireHash must be called before creating arena dicts"
+
+// Checks if the value of an entry is stored inside the entry
+#define _DIC_ISINLINE(Link) ((Link)->value == (void *)(Link)->inlineValue)
+
+// Rounds a size up so that the next part of a saved dict is aligned
+#define _DIC_ALIGN(Size) (((Size) + sizeof(uint64_t) - 1) & ~(sizeof(uint64_t) - 1))
+
+// Identifies a file written by DIC_Save, the version is the last byte
+#define _DIC_FILEMAGIC 0x313050414D434944
 
 enum __DIC_Mode {
     DIC_MODE_POINTER,
@@ -52,32 +136,172 @@ typedef enum __DIC_Mode DIC_Mode;
 typedef enum __DIC_Type DIC_Type;
 typedef struct __DIC_Dict DIC_Dict;
 typedef struct __DIC_LinkList DIC_LinkList;
+typedef struct __DIC_FileHeader DIC_FileHeader;
+typedef struct __DIC_FileEntry DIC_FileEntry;
+typedef struct __DIC_MappedDict DIC_MappedDict;
+typedef struct __DIC_BinaryKey DIC_BinaryKey;
+typedef struct __DIC_Iterator DIC_Iterator;
+typedef struct __DIC_BloomBlock DIC_BloomBlock;
+typedef struct __DIC_InternEntry DIC_InternEntry;
+typedef struct __DIC_InternPool DIC_InternPool;
 
 struct __DIC_LinkList {
     char *key; // The key for the item
+    uint64_t hash; // The hash of the key, compared before the key itself
     void *value; // A pointer to the value
     size_t size; // The size of the value, only used if pointer is false
     bool pointer; // If it is false then it contains a pointer to private information which must be freed when dict is destroyed
+    bool interned; // If true the key is from the intern pool and is released instead of freed
+    bool borrowed; // If true the key belongs to whoever added the item and is not freed
     DIC_LinkList *next; // The next element in the list
+    uint64_t inlineValue[(DIC_INLINESIZE + sizeof(uint64_t) - 1) / sizeof(uint64_t)]; // Storage for small copied values, value points here when it is used
+};
+
+// One cache line of a bloom filter, each key sets one bit in every word
+struct __DIC_BloomBlock {
+    uint64_t bits[8]; // The bits of the block
 };
 
 struct __DIC_Dict {
     DIC_LinkList **list;
     size_t length;
+    size_t count; // The number of items
+    DIC_LinkList **order; // All the items in the order they were added, NULL if the dict is not ordered
+    size_t orderLength; // The number of items there is space for in order
+    DIC_BloomBlock *bloom; // Bloom filter answering lookups of missing keys, NULL if the dict does not have one
+    size_t bloomLength; // The number of blocks in bloom
+    size_t bloomCapacity; // The number of items bloom is sized for, it is rebuilt twice as large when more are added
+    bool intern; // If true new keys are taken from the intern pool instead of being copied
+    ARN_Arena *arena; // If not NULL all memory of the dict is taken from this arena and it is only freed with the arena
+    bool borrow; // If true new keys are not copied, the dict points to the strings it is given
+};
+
+// A string in the intern pool, the interned pointer points to string
+struct __DIC_InternEntry {
+    DIC_InternEntry *next; // The next entry in the bucket
+    uint64_t hash; // The hash of the string
+    _Atomic size_t refCount; // The number of times the string has been interned without being released
+    char string[]; // The string
+};
+
+// The set of all interned strings
+struct __DIC_InternPool {
+    DIC_InternEntry **list; // The buckets, the length is a power of 2
+    size_t length; // The number of buckets
+    size_t count; // The number of strings
+};
+
+struct __DIC_Iterator {
+    DIC_Dict *dict; // The dict being iterated over
+    DIC_LinkList **bucket; // The next bucket to go through if the dict is not ordered
+    DIC_LinkList **endBucket; // The end of the bucket list
+    DIC_LinkList *link; // The current item
+    size_t pos; // The position of the next item in the order list if the dict is ordered
+    const char *key; // The key of the current item
+    void *value; // The value of the current item
+    size_t size; // The size of the value of the current item
+};
+
+// Goes through all items in a dict, the dict must not be changed while doing this
+// Dict: The dict to go through
+// Iterator: The name of the DIC_Iterator variable holding the current item
+#define DIC_ForEach(Dict, Iterator) for (DIC_Iterator Iterator = DIC_Iterate(Dict); DIC_Next(&Iterator);)
+
+// A key for DICBIN dictionaries, it is any sequence of bytes
+struct __DIC_BinaryKey {
+    const uint8_t *data; // The bytes of the key
+    size_t length; // The number of bytes
+};
+
+// Creates a binary key from a pointer and a length
+#define DIC_BINARYKEY(Data, Length) ((DIC_BinaryKey){(const uint8_t *)(Data), (Length)})
+
+// The multiplier used for multiplicative hashing, 2^64 divided by the golden ratio
+#define _DIC_HASHMULTIPLIER 0x9E3779B97F4A7C15
+
+// The number of layers of the hash table, characters at different positions use different layers so numbered keys like item12 and item21 do not collide
+#define _DIC_HASHDEPTH 8
+
+// All offsets in a saved dict are counted from the start of the file, an offset of 0 means no entry
+struct __DIC_FileHeader {
+    uint64_t magic; // Must be _DIC_FILEMAGIC
+    uint64_t size; // The total size of the file
+    uint64_t length; // The length of the bucket list
+    uint64_t count; // The number of entries
+    uint64_t depth; // The depth of the hash table used when saving
+    uint64_t table; // The offset of the hash table, 256 * depth values
+    uint64_t buckets; // The offset of the bucket list, length offsets to the first entry of each bucket
+};
+
+struct __DIC_FileEntry {
+    uint64_t next; // The offset of the next entry in the bucket
+    uint64_t key; // The offset of the key, it is NULL terminated
+    uint64_t value; // The offset of the value
+    uint64_t size; // The size of the value
+};
+
+struct __DIC_MappedDict {
+    uint8_t *data; // The mapped file
+    size_t size; // The size of the mapping
+    const DIC_FileHeader *header; // The header at the start of the mapping
+    const uint64_t *buckets; // The bucket list inside the mapping
+    HAS_Hash hash; // The hash saved in the file, the table points into the mapping
 };
 
 // Creates a empty dictionary
 // Size: The size of the dict list, this should be about the same size as the expected number of entries
 DIC_Dict *DIC_CreateDict(size_t Size);
 
+// Creates a empty dictionary which remembers the order the items were added in, iterating goes through the items in that order
+// Size: The size of the dict list, this should be about the same size as the expected number of entries
+DIC_Dict *DIC_CreateOrderedDict(size_t Size);
+
+// Creates a empty dictionary where the dict, its entries, keys and copied values are allocated from an arena
+// Destroying the dict does nothing, the memory is freed with the arena, removed items are only unlinked and values added with DIC_MODE_INSERT are never freed
+// The hash table is not held by arena dicts, DIC_AcquireHash must be called before creating them and DIC_ReleaseHash after the arena is destroyed
+// Size: The size of the dict list, this should be about the same size as the expected number of entries
+// Arena: The arena to allocate from
+DIC_Dict *DIC_CreateArenaDict(size_t Size, ARN_Arena *Arena);
+
+// Makes sure the hash table used by all dicts exists and holds a reference to it, returns false on error
+// Every call must be matched by a call to DIC_ReleaseHash, DIC_CreateDict and DIC_DestroyDict do this automatically
+// Dicts may be created and destroyed from several threads at once
+bool DIC_AcquireHash(void);
+
+// Releases a reference to the hash table, it is destroyed when there are no references left
+void DIC_ReleaseHash(void);
+
+// Allocates memory for a dict, from the arena if it has one
+// Dict: The dict to allocate for
+// Size: The number of bytes
+static inline void *_DIC_Alloc(DIC_Dict *Dict, size_t Size);
+
+// Frees memory allocated with _DIC_Alloc, memory from an arena is left for the arena
+// Dict: The dict the memory was allocated for
+// Memory: The memory to free
+static inline void _DIC_Free(DIC_Dict *Dict, void *Memory);
+
 // Add an item to a dictionary
 // Dict: The dictionary to add the item to
 // Key: The key for the item
 // Value: A pointer to the value to store
 // ValueLength: The size of the value data, only used if mode is not DIC_MODE_POINTER
-// Mode: If DIC_MODE_POINTER, then it will just save the pointer, if DIC_INSERT, then it will save the pointer and free it when destroying the dict, if DIC_COPY, then it will copy the value pointet to
+// Mode: If DIC_MODE_POINTER, then it will just save the pointer, if DIC_INSERT, then it will save the pointer and free it when destroying the dict, if DIC_COPY, then it will copy the value pointet to, values no larger than DIC_INLINESIZE are copied into the entry itself
 bool DIC_AddItem(DIC_Dict *Dict, const char *Key, void *Value, size_t ValueLength, DIC_Mode Mode);
 
+// Add an item to a dictionary when the hash of the key is already known, it is the same as DIC_AddItem otherwise
+// Dict: The dictionary to add the item to
+// Key: The key for the item
+// HashKey: The hash of the key from DIC_HashKey
+// Value: A pointer to the value to store
+// ValueLength: The size of the value data, only used if mode is not DIC_MODE_POINTER
+// Mode: The same as for DIC_AddItem
+bool DIC_AddItemHashed(DIC_Dict *Dict, const char *Key, uint64_t HashKey, void *Value, size_t ValueLength, DIC_Mode Mode);
+
+// Hashes a key the same way as all dicts do, the hash stays the same between processes, returns 0 on error
+// Key: The key to hash
+uint64_t DIC_HashKey(const char *Key);
+
 // Adds a list of items to a dictionary, upon failure it may leave new items in the dict
 // Dict: The dictionary to add the item to
 // Keys: The keys for the items
@@ -97,6 +321,26 @@ bool DIC_RemoveItem(DIC_Dict *Dict, const char *Key);
 // Key: The key for the item
 void *DIC_GetItem(DIC_Dict *Dict, const char *Key);
 
+// Get an item from a dictionary using a hash found with DIC_HashKey, this skips hashing the key when it is looked up often
+// Dict: The dictionary to get the item from
+// Key: The key for the item
+// HashKey: The hash of the key
+void *DIC_GetItemHashed(DIC_Dict *Dict, const char *Key, uint64_t HashKey);
+
+// Finds the entry of a key, returns NULL without setting an error if it is not in the dict
+// Dict: The dictionary to search
+// Key: The key for the item
+// HashKey: The hash of the key
+static inline DIC_LinkList *_DIC_FindItem(DIC_Dict *Dict, const char *Key, uint64_t HashKey);
+
+// Gets several items from a dictionary at once, all keys are hashed and their buckets prefetched before any of them are resolved
+// Returns false if it was unable to look up the items
+// Dict: The dictionary to get the items from
+// Keys: The keys for the items
+// Count: The number of keys
+// OutValues: Array of length Count which receives the value of each item, NULL if the item does not exist
+bool DIC_GetItemBatch(DIC_Dict *Dict, const char **Keys, size_t Count, void **OutValues);
+
 // Checks if an item exists in a dictionary
 // Dict: The dictionary to remove an item from
 // Key: The key for the item
@@ -110,14 +354,134 @@ DIC_Dict *DIC_CopyDict(DIC_Dict *Dict);
 // Dict: The dict to get the length of
 size_t DIC_DictLength(DIC_Dict *Dict);
 
+// Puts a blocked bloom filter in front of the dict, most lookups of missing keys are then answered from a single cache line
+// The filter is kept up to date when adding items and is rebuilt twice as large when it gets full, removed items stay in it until it is rebuilt
+// Returns false if it was unable to create the filter, the dict is unchanged in that case
+// Dict: The dict to add the filter to, if it already has one it is rebuilt
+// Capacity: The number of items to size the filter for, if it is smaller than the number of items in the dict that is used instead
+bool DIC_AddBloomFilter(DIC_Dict *Dict, size_t Capacity);
+
+// Adds a hash to the bloom filter of a dict
+// Dict: The dict with the filter
+// HashKey: The hash of the key to add
+static inline void _DIC_BloomAdd(DIC_Dict *Dict, uint64_t HashKey);
+
+// Checks if a hash may be in a dict, returns false only if the key is certainly not in the dict
+// Dict: The dict to check, if it has no filter this always returns true
+// HashKey: The hash of the key to check
+static inline bool _DIC_BloomCheck(const DIC_Dict *Dict, uint64_t HashKey);
+
+// Finds the block of the bloom filter for a hash
+// Dict: The dict with the filter
+// HashKey: The hash of the key
+static inline DIC_BloomBlock *_DIC_BloomFind(const DIC_Dict *Dict, uint64_t HashKey);
+
+// Starts iterating through a dict, use DIC_Next to get each item, an ordered dict is iterated in the order the items were added, otherwise it goes through the buckets in memory order
+// Dict: The dict to go through
+DIC_Iterator DIC_Iterate(DIC_Dict *Dict);
+
+// Moves the iterator to the next item, returns false when there are no more items
+// Iterator: The iterator to move
+bool DIC_Next(DIC_Iterator *Iterator);
+
+// Saves a dictionary to a file which can later be mapped with DIC_Map, the layout uses offsets so it can be mapped anywhere
+// The value of every entry is saved using its size, for DIC_MODE_POINTER this is the ValueLength given to DIC_AddItem
+// Dict: The dict to save
+// FileName: The path of the file to write
+bool DIC_Save(DIC_Dict *Dict, const char *FileName);
+
+// Maps a file written by DIC_Save into memory, the pages are shared between all processes mapping the same file
+// The output should be destroyed with DIC_Unmap
+// FileName: The path of the file
+DIC_MappedDict *DIC_Map(const char *FileName);
+
+// Get an item from a mapped dictionary, the value points into the mapping and must not be written to
+// Dict: The mapped dict to get the item from
+// Key: The key for the item
+// Size: If not NULL the size of the value is written to it
+const void *DIC_MapGetItem(const DIC_MappedDict *Dict, const char *Key, size_t *Size);
+
+// Checks if an item exists in a mapped dictionary
+// Dict: The mapped dict to search
+// Key: The key for the item
+bool DIC_MapCheckItem(const DIC_MappedDict *Dict, const char *Key);
+
+// Returns the number of elements in the mapped dictionary
+// Dict: The mapped dict to get the length of
+size_t DIC_MapLength(const DIC_MappedDict *Dict);
+
+// Finds the entry of a key in a mapped dictionary, returns NULL if it is not there or the file is corrupt
+// The key and value of the entry are checked to be inside the file
+// Dict: The mapped dict to search
+// Key: The key for the item
+const DIC_FileEntry *_DIC_MapFind(const DIC_MappedDict *Dict, const char *Key);
+
+// Hashes a uint64 key using multiplicative hashing, the upper bits are the best mixed
+// Key: The key to hash
+static inline uint64_t DIC_HashUint64(uint64_t Key);
+
+// Hashes a binary key 8 bytes at a time
+// Key: The key to hash
+uint64_t DIC_HashBinary(DIC_BinaryKey Key);
+
+// Compares two binary keys
+// Key1: The first key
+// Key2: The second key
+static inline bool DIC_EqualBinary(DIC_BinaryKey Key1, DIC_BinaryKey Key2);
+
+// Copies the data of a binary key into new memory, returns false on error
+// Dst: The key to copy to
+// Src: The key to copy
+bool _DIC_CopyBinaryKey(DIC_BinaryKey *Dst, DIC_BinaryKey Src);
+
+// Returns the canonical copy of a string, equal strings interned while the first one is still in use gives the same pointer
+// The string must be released with DIC_Release once for every time it is interned, returns NULL on error
+// Strings may be interned and released from several threads at once
+// String: The string to intern
+const char *DIC_Intern(const char *String);
+
+// Releases an interned string, it is freed when it has been released as many times as it was interned
+// String: The pointer returned by DIC_Intern
+void DIC_Release(const char *String);
+
+// Interns a string which is already interned, this is faster than DIC_Intern
+// String: The pointer returned by DIC_Intern
+static inline const char *_DIC_Retain(const char *String);
+
+// Makes a dict use the intern pool for its keys, the existing keys are interned too
+// Keys repeated across many dicts are then only stored once, and lookups with an interned key compare pointers instead of strings
+// Arena dicts keep their keys in the arena so they are left as they are
+// Returns false on error, keys interned before the error stay interned
+// Dict: The dict to use the pool
+bool DIC_InternKeys(DIC_Dict *Dict);
+
+// Makes a dict keep the pointers to the keys of new items instead of copying them
+// The keys must not be changed or freed before the dict is destroyed, this replaces interning
+// Dict: The dict to borrow keys
+void DIC_BorrowKeys(DIC_Dict *Dict);
+
 void DIC_InitLinkList(DIC_LinkList *Struct);
 void DIC_InitDict(DIC_Dict *Struct);
+void DIC_InitInternPool(DIC_InternPool *Struct);
+void DIC_InitMappedDict(DIC_MappedDict *Struct);
 
 void DIC_DestroyLinkList(DIC_LinkList *LinkList);
 void DIC_DestroyDict(DIC_Dict *Dict);
 
+// Unmaps a mapped dictionary
+// Dict: The mapped dict to unmap
+void DIC_Unmap(DIC_MappedDict *Dict);
+
+// The salts used to pick a bit in each word of a bloom block
+const uint32_t _DIC_BloomSalts[8] = {0x47B6137B, 0x44974D91, 0x8824AD5B, 0xA2B7289D, 0x705495C7, 0x2DF1424B, 0x9EFC4947, 0x5C6BFB31};
+
 HAS_Hash *_DIC_HashTable = NULL;
-size_t _DIC_DictCount = 0;
+_Atomic size_t _DIC_DictCount = 0;
+pthread_mutex_t _DIC_HashLock = PTHREAD_MUTEX_INITIALIZER;
+
+// The pool for interned strings, it only exists while it holds strings
+DIC_InternPool *_DIC_InternPool = NULL;
+pthread_mutex_t _DIC_InternLock = PTHREAD_MUTEX_INITIALIZER;
 
 DIC_Dict *DIC_CreateDict(size_t Size)
 {
@@ -140,7 +504,7 @@ DIC_Dict *DIC_CreateDict(size_t Size)
     if (Dict->list == NULL)
     {
         _DIC_AddErrorForeign(_DIC_ERRORID_CREATEDIC_MALLOCLIST, strerror(errno), _DIC_ERRORMES_MALLOC, sizeof(DIC_LinkList *) * Size);
-        DIC_DestroyDict(Dict);
+        free(Dict);
         return NULL;
     }
 
@@ -149,22 +513,140 @@ DIC_Dict *DIC_CreateDict(size_t Size)
         *List = NULL;
 
     // Create hash if needed
+    if (!DIC_AcquireHash())
+    {
+        _DIC_AddError(_DIC_ERRORID_CREATEDIC_HASH, _DIC_ERRORMES_CREATEHASH);
+        free(Dict->list);
+        free(Dict);
+        return NULL;
+    }
+
+    return Dict;
+}
+
+DIC_Dict *DIC_CreateArenaDict(size_t Size, ARN_Arena *Arena)
+{
+    extern HAS_Hash *_DIC_HashTable;
+
+    // Arena dicts are freed all at once, so they cannot hold the hash table themselves
+    if (_DIC_HashTable == NULL)
+    {
+        _DIC_SetError(_DIC_ERRORID_CREATEARENADICT_HASHTABLE, _DIC_ERRORMES_NOHOLD);
+        return NULL;
+    }
+
+    // Allocate the dict and the list together
+    DIC_Dict *Dict = (DIC_Dict *)ARN_Alloc(Arena, sizeof(DIC_Dict) + sizeof(DIC_LinkList *) * Size);
+
+    if (Dict == NULL)
+    {
+        _DIC_AddErrorForeign(_DIC_ERRORID_CREATEARENADICT_ALLOC, ARN_GetError(), _DIC_ERRORMES_ARENA, sizeof(DIC_Dict) + sizeof(DIC_LinkList *) * Size);
+        return NULL;
+    }
+
+    DIC_InitDict(Dict);
+    Dict->arena = Arena;
+    Dict->length = Size;
+    Dict->list = (DIC_LinkList **)(Dict + 1);
+
+    for (DIC_LinkList **List = Dict->list, **EndList = Dict->list + Size; List < EndList; ++List)
+        *List = NULL;
+
+    return Dict;
+}
+
+bool DIC_AcquireHash(void)
+{
     extern HAS_Hash *_DIC_HashTable;
-    extern size_t _DIC_DictCount;
+    extern _Atomic size_t _DIC_DictCount;
+    extern pthread_mutex_t _DIC_HashLock;
+
+    // Other threads may create or destroy the table at the same time
+    pthread_mutex_lock(&_DIC_HashLock);
     
     if (_DIC_HashTable == NULL)
     {
-        _DIC_HashTable = HAS_CreateHash(1, 0);
+        _DIC_HashTable = HAS_CreateHash(_DIC_HASHDEPTH, 0);
 
         if (_DIC_HashTable == NULL)
         {
-            _DIC_AddErrorForeign(_DIC_ERRORID_CREATEDIC_HASH, HAS_GetError(), _DIC_ERRORMES_CREATEHASH);
-            DIC_DestroyDict(Dict);
-            return NULL;
+            _DIC_AddErrorForeign(_DIC_ERRORID_ACQUIREHASH_CREATE, HAS_GetError(), _DIC_ERRORMES_CREATEHASH);
+            pthread_mutex_unlock(&_DIC_HashLock);
+            return false;
         }
     }
 
-    ++_DIC_DictCount;
+    atomic_fetch_add(&_DIC_DictCount, 1);
+    pthread_mutex_unlock(&_DIC_HashLock);
+
+    return true;
+}
+
+void DIC_ReleaseHash(void)
+{
+    extern HAS_Hash *_DIC_HashTable;
+    extern _Atomic size_t _DIC_DictCount;
+    extern pthread_mutex_t _DIC_HashLock;
+
+    // Other threads may create or destroy the table at the same time
+    pthread_mutex_lock(&_DIC_HashLock);
+
+    size_t Count = atomic_load(&_DIC_DictCount);
+
+    if (Count == 0)
+    {
+        _DIC_SetError(_DIC_ERRORID_RELEASEHASH_NODICT, _DIC_ERRORMES_WRONGDICTCOUNT);
+        pthread_mutex_unlock(&_DIC_HashLock);
+        return;
+    }
+
+    atomic_store(&_DIC_DictCount, Count - 1);
+
+    // Destroy hash
+    if (Count == 1 && _DIC_HashTable != NULL)
+    {
+        HAS_DestroyHash(_DIC_HashTable);
+        _DIC_HashTable = NULL;
+    }
+
+    pthread_mutex_unlock(&_DIC_HashLock);
+}
+
+static inline void *_DIC_Alloc(DIC_Dict *Dict, size_t Size)
+{
+    if (Dict->arena != NULL)
+        return ARN_Alloc(Dict->arena, Size);
+
+    return malloc(Size);
+}
+
+static inline void _DIC_Free(DIC_Dict *Dict, void *Memory)
+{
+    if (Dict->arena == NULL)
+        free(Memory);
+}
+
+DIC_Dict *DIC_CreateOrderedDict(size_t Size)
+{
+    // Create the dict
+    DIC_Dict *Dict = DIC_CreateDict(Size);
+
+    if (Dict == NULL)
+    {
+        _DIC_AddError(_DIC_ERRORID_CREATEORDEREDDICT_CREATE, _DIC_ERRORMES_CREATEDICT);
+        return NULL;
+    }
+
+    // Get memory for the order
+    Dict->orderLength = ((Size > 0) ? (Size) : (1));
+    Dict->order = (DIC_LinkList **)malloc(sizeof(DIC_LinkList *) * Dict->orderLength);
+
+    if (Dict->order == NULL)
+    {
+        _DIC_AddErrorForeign(_DIC_ERRORID_CREATEORDEREDDICT_MALLOC, strerror(errno), _DIC_ERRORMES_MALLOC, sizeof(DIC_LinkList *) * Dict->orderLength);
+        DIC_DestroyDict(Dict);
+        return NULL;
+    }
 
     return Dict;
 }
@@ -172,7 +654,7 @@ DIC_Dict *DIC_CreateDict(size_t Size)
 bool DIC_AddItem(DIC_Dict *Dict, const char *Key, void *Value, size_t ValueLength, DIC_Mode Mode)
 {
     extern HAS_Hash *_DIC_HashTable;
-    extern size_t _DIC_DictCount;
+    extern _Atomic size_t _DIC_DictCount;
 
     if (_DIC_HashTable == NULL)
     {
@@ -181,32 +663,36 @@ bool DIC_AddItem(DIC_Dict *Dict, const char *Key, void *Value, size_t ValueLengt
     }
 
     // Hash the key
-    size_t KeyLength = strlen(Key);
-    uint64_t HashKey = HAS_HashValue(_DIC_HashTable, (uint8_t *)Key, KeyLength);
+    uint64_t HashKey = HAS_HashValue(_DIC_HashTable, (uint8_t *)Key, strlen(Key));
 
+    return DIC_AddItemHashed(Dict, Key, HashKey, Value, ValueLength, Mode);
+}
+
+bool DIC_AddItemHashed(DIC_Dict *Dict, const char *Key, uint64_t HashKey, void *Value, size_t ValueLength, DIC_Mode Mode)
+{
     // Find the position of the item
     DIC_LinkList **ItemPos = Dict->list + HashKey % Dict->length;
 
     while (*ItemPos != NULL)
     {
         // Check if it is a dublicate
-        if (strcmp((*ItemPos)->key, Key) == 0)
+        if ((*ItemPos)->key == Key || ((*ItemPos)->hash == HashKey && strcmp((*ItemPos)->key, Key) == 0))
             break;
 
         // Get the next item
         ItemPos = &(*ItemPos)->next;
     }
 
-    // Copy the value
+    // Copy the value, small values are copied into the entry later
     void *CopyValue = Value;
 
-    if (Mode == DIC_MODE_COPY)
+    if (Mode == DIC_MODE_COPY && ValueLength > DIC_INLINESIZE)
     {
-        CopyValue = malloc(ValueLength);
+        CopyValue = _DIC_Alloc(Dict, ValueLength);
 
         if (CopyValue == NULL)
         {
-            _DIC_AddErrorForeign(_DIC_ERRORID_ADDITEM_MALLOCVALUE, strerror(errno), _DIC_ERRORMES_MALLOC, ValueLength);
+            _DIC_AddErrorForeign(_DIC_ERRORID_ADDITEMHASHED_MALLOCVALUE, strerror(errno), _DIC_ERRORMES_MALLOC, ValueLength);
             return false;
         }
 
@@ -216,27 +702,78 @@ bool DIC_AddItem(DIC_Dict *Dict, const char *Key, void *Value, size_t ValueLengt
     // If it did not find the item, create a new item
     if (*ItemPos == NULL)
     {
+        // Make the bloom filter larger if it is full
+        if (Dict->bloom != NULL && Dict->count >= Dict->bloomCapacity && !DIC_AddBloomFilter(Dict, Dict->bloomCapacity * 2))
+        {
+            _DIC_AddError(_DIC_ERRORID_ADDITEMHASHED_BLOOM, _DIC_ERRORMES_BLOOM);
+            if (CopyValue != Value)
+                _DIC_Free(Dict, CopyValue);
+            return false;
+        }
+
+        // Make room in the order
+        if (Dict->order != NULL && Dict->count == Dict->orderLength)
+        {
+            DIC_LinkList **NewOrder = (DIC_LinkList **)realloc(Dict->order, sizeof(DIC_LinkList *) * Dict->orderLength * 2);
+
+            if (NewOrder == NULL)
+            {
+                _DIC_AddErrorForeign(_DIC_ERRORID_ADDITEMHASHED_REALLOCORDER, strerror(errno), _DIC_ERRORMES_REALLOC, sizeof(DIC_LinkList *) * Dict->orderLength * 2);
+                if (CopyValue != Value)
+                    _DIC_Free(Dict, CopyValue);
+                return false;
+            }
+
+            Dict->order = NewOrder;
+            Dict->orderLength *= 2;
+        }
+
         // Copy the key
-        char *CopyKey = (char *)malloc(sizeof(char) * (KeyLength + 1));
+        char *CopyKey;
 
-        if (CopyKey == NULL)
+        if (Dict->borrow)
+            CopyKey = (char *)Key;
+
+        else if (Dict->intern)
         {
-            _DIC_AddErrorForeign(_DIC_ERRORID_ADDITEM_MALLOCKEY, strerror(errno), _DIC_ERRORMES_MALLOC, sizeof(char) * (KeyLength + 1));
-            if (Mode == DIC_MODE_COPY)
-                free(CopyValue);
-            return false;
+            CopyKey = (char *)DIC_Intern(Key);
+
+            if (CopyKey == NULL)
+            {
+                _DIC_AddError(_DIC_ERRORID_ADDITEMHASHED_INTERN, _DIC_ERRORMES_INTERN, Key);
+                if (CopyValue != Value)
+                    _DIC_Free(Dict, CopyValue);
+                return false;
+            }
         }
 
-        strcpy(CopyKey, Key);
+        else
+        {
+            size_t KeyLength = strlen(Key);
+            CopyKey = (char *)_DIC_Alloc(Dict, sizeof(char) * (KeyLength + 1));
+
+            if (CopyKey == NULL)
+            {
+                _DIC_AddErrorForeign(_DIC_ERRORID_ADDITEMHASHED_MALLOCKEY, strerror(errno), _DIC_ERRORMES_MALLOC, sizeof(char) * (KeyLength + 1));
+                if (CopyValue != Value)
+                    _DIC_Free(Dict, CopyValue);
+                return false;
+            }
+
+            strcpy(CopyKey, Key);
+        }
 
-        DIC_LinkList *NewItem = (DIC_LinkList *)malloc(sizeof(DIC_LinkList));
+        DIC_LinkList *NewItem = (DIC_LinkList *)_DIC_Alloc(Dict, sizeof(DIC_LinkList));
 
         if (NewItem == NULL)
         {
-            _DIC_AddErrorForeign(_DIC_ERRORID_ADDITEM_MALLOCITEM, strerror(errno), _DIC_ERRORMES_MALLOC, sizeof(DIC_LinkList));
-            free(CopyKey);
-            if (Mode == DIC_MODE_COPY)
-                free(CopyValue);
+            _DIC_AddErrorForeign(_DIC_ERRORID_ADDITEMHASHED_MALLOCITEM, strerror(errno), _DIC_ERRORMES_MALLOC, sizeof(DIC_LinkList));
+            if (Dict->intern)
+                DIC_Release(CopyKey);
+            else if (!Dict->borrow)
+                _DIC_Free(Dict, CopyKey);
+            if (CopyValue != Value)
+                _DIC_Free(Dict, CopyValue);
             return false;
         }
 
@@ -244,12 +781,38 @@ bool DIC_AddItem(DIC_Dict *Dict, const char *Key, void *Value, size_t ValueLengt
 
         // Set values
         NewItem->key = CopyKey;
+        NewItem->interned = Dict->intern;
+        NewItem->borrowed = Dict->borrow;
+        NewItem->hash = HashKey;
         *ItemPos = NewItem;
+
+        if (Dict->order != NULL)
+            Dict->order[Dict->count] = NewItem;
+
+        if (Dict->bloom != NULL)
+            _DIC_BloomAdd(Dict, HashKey);
+
+        ++Dict->count;
+    }
+
+    // Find the old value, it is removed after the new value is copied in case they overlap
+    void *OldValue = NULL;
+
+    if (!(*ItemPos)->pointer && !_DIC_ISINLINE(*ItemPos))
+        OldValue = (*ItemPos)->value;
+
+    // Copy small values into the entry
+    if (Mode == DIC_MODE_COPY && ValueLength <= DIC_INLINESIZE)
+    {
+        if (ValueLength > 0)
+            memmove((*ItemPos)->inlineValue, Value, ValueLength);
+
+        CopyValue = (void *)(*ItemPos)->inlineValue;
     }
 
     // Remove old value
-    if (!(*ItemPos)->pointer && (*ItemPos)->value != NULL)
-        free((*ItemPos)->value);
+    if (OldValue != NULL)
+        _DIC_Free(Dict, OldValue);
 
     (*ItemPos)->value = CopyValue;
     (*ItemPos)->pointer = (Mode == DIC_MODE_POINTER);
@@ -258,6 +821,20 @@ bool DIC_AddItem(DIC_Dict *Dict, const char *Key, void *Value, size_t ValueLengt
     return true;
 }
 
+uint64_t DIC_HashKey(const char *Key)
+{
+    extern HAS_Hash *_DIC_HashTable;
+    extern _Atomic size_t _DIC_DictCount;
+
+    if (_DIC_HashTable == NULL)
+    {
+        _DIC_SetError(_DIC_ERRORID_HASHKEY_HASHTABLE, _DIC_ERRORMES_NOHASHTABLE, _DIC_DictCount);
+        return 0;
+    }
+
+    return HAS_HashValue(_DIC_HashTable, (uint8_t *)Key, strlen(Key));
+}
+
 bool DIC_AddList(DIC_Dict *Dict, const char **Keys, size_t Count, void *Values, const size_t *ValueLengths, DIC_Mode Mode)
 {
     // Setup ValueLength if not needed
@@ -304,7 +881,7 @@ bool DIC_AddList(DIC_Dict *Dict, const char **Keys, size_t Count, void *Values,
 void *DIC_GetItem(DIC_Dict *Dict, const char *Key)
 {
     extern HAS_Hash *_DIC_HashTable;
-    extern size_t _DIC_DictCount;
+    extern _Atomic size_t _DIC_DictCount;
 
     if (_DIC_HashTable == NULL)
     {
@@ -316,27 +893,109 @@ void *DIC_GetItem(DIC_Dict *Dict, const char *Key)
     size_t KeyLength = strlen(Key);
     uint64_t HashKey = HAS_HashValue(_DIC_HashTable, (uint8_t *)Key, KeyLength);
 
-    // Find the item
-    DIC_LinkList **ItemPos = Dict->list + HashKey % Dict->length;
+    DIC_LinkList *Item = _DIC_FindItem(Dict, Key, HashKey);
 
-    while (*ItemPos != NULL)
+    if (Item == NULL)
     {
-        // Check if it found it
-        if (strcmp((*ItemPos)->key, Key) == 0)
-            return (*ItemPos)->value;
+        _DIC_SetError(_DIC_ERRORID_GETITEM_NOITEM, _DIC_ERRORMES_NOITEM);
+        return NULL;
+    }
 
-        // Get the next item
-        ItemPos = &(*ItemPos)->next;
+    return Item->value;
+}
+
+void *DIC_GetItemHashed(DIC_Dict *Dict, const char *Key, uint64_t HashKey)
+{
+    DIC_LinkList *Item = _DIC_FindItem(Dict, Key, HashKey);
+
+    if (Item == NULL)
+    {
+        _DIC_SetError(_DIC_ERRORID_GETITEMHASHED_NOITEM, _DIC_ERRORMES_NOITEM);
+        return NULL;
     }
 
-    _DIC_SetError(_DIC_ERRORID_GETITEM_NOITEM, _DIC_ERRORMES_NOITEM);
+    return Item->value;
+}
+
+static inline DIC_LinkList *_DIC_FindItem(DIC_Dict *Dict, const char *Key, uint64_t HashKey)
+{
+    // Check the bloom filter
+    if (!_DIC_BloomCheck(Dict, HashKey))
+        return NULL;
+
+    // Find the item
+    for (DIC_LinkList *Item = Dict->list[HashKey % Dict->length]; Item != NULL; Item = Item->next)
+        if (Item->key == Key || (Item->hash == HashKey && strcmp(Item->key, Key) == 0))
+            return Item;
+
     return NULL;
 }
 
+bool DIC_GetItemBatch(DIC_Dict *Dict, const char **Keys, size_t Count, void **OutValues)
+{
+    extern HAS_Hash *_DIC_HashTable;
+    extern _Atomic size_t _DIC_DictCount;
+
+    if (_DIC_HashTable == NULL)
+    {
+        _DIC_SetError(_DIC_ERRORID_GETITEMBATCH_HASHTABLE, _DIC_ERRORMES_NOHASHTABLE, _DIC_DictCount);
+        return false;
+    }
+
+    uint64_t HashKeys[DIC_BATCHSIZE];
+    DIC_LinkList **Buckets[DIC_BATCHSIZE];
+
+    // Do the keys in groups
+    for (size_t Start = 0; Start < Count; Start += DIC_BATCHSIZE)
+    {
+        size_t GroupCount = ((Count - Start < DIC_BATCHSIZE) ? (Count - Start) : (DIC_BATCHSIZE));
+        const char **GroupKeys = Keys + Start;
+
+        // Hash all of the keys and prefetch their buckets and bloom blocks
+        for (size_t Pos = 0; Pos < GroupCount; ++Pos)
+        {
+            HashKeys[Pos] = HAS_HashValue(_DIC_HashTable, (uint8_t *)GroupKeys[Pos], strlen(GroupKeys[Pos]));
+            Buckets[Pos] = Dict->list + HashKeys[Pos] % Dict->length;
+            __builtin_prefetch(Buckets[Pos]);
+
+            if (Dict->bloom != NULL)
+                __builtin_prefetch(_DIC_BloomFind(Dict, HashKeys[Pos]));
+        }
+
+        // Prefetch the first item of each bucket, keys rejected by the bloom filter are skipped
+        for (size_t Pos = 0; Pos < GroupCount; ++Pos)
+        {
+            if (!_DIC_BloomCheck(Dict, HashKeys[Pos]))
+                Buckets[Pos] = NULL;
+
+            else if (*Buckets[Pos] != NULL)
+                __builtin_prefetch(*Buckets[Pos]);
+        }
+
+        // Find the items
+        for (size_t Pos = 0; Pos < GroupCount; ++Pos)
+        {
+            OutValues[Start + Pos] = NULL;
+
+            if (Buckets[Pos] == NULL)
+                continue;
+
+            for (DIC_LinkList *Link = *Buckets[Pos]; Link != NULL; Link = Link->next)
+                if (Link->key == GroupKeys[Pos] || (Link->hash == HashKeys[Pos] && strcmp(Link->key, GroupKeys[Pos]) == 0))
+                {
+                    OutValues[Start + Pos] = Link->value;
+                    break;
+                }
+        }
+    }
+
+    return true;
+}
+
 bool DIC_RemoveItem(DIC_Dict *Dict, const char *Key)
 {
     extern HAS_Hash *_DIC_HashTable;
-    extern size_t _DIC_DictCount;
+    extern _Atomic size_t _DIC_DictCount;
 
     if (_DIC_HashTable == NULL)
     {
@@ -348,13 +1007,20 @@ bool DIC_RemoveItem(DIC_Dict *Dict, const char *Key)
     size_t KeyLength = strlen(Key);
     uint64_t HashKey = HAS_HashValue(_DIC_HashTable, (uint8_t *)Key, KeyLength);
 
+    // Check the bloom filter
+    if (!_DIC_BloomCheck(Dict, HashKey))
+    {
+        _DIC_SetError(_DIC_ERRORID_REMOVEITEM_NOITEM, _DIC_ERRORMES_NOITEM);
+        return false;
+    }
+
     // Find the item
     DIC_LinkList **ItemPos = Dict->list + HashKey % Dict->length;
 
     while (*ItemPos != NULL)
     {
         // Check if it found it
-        if (strcmp((*ItemPos)->key, Key) == 0)
+        if ((*ItemPos)->key == Key || ((*ItemPos)->hash == HashKey && strcmp((*ItemPos)->key, Key) == 0))
             break;
 
         // Get the next item
@@ -368,12 +1034,25 @@ bool DIC_RemoveItem(DIC_Dict *Dict, const char *Key)
         return false;
     }
 
+    // Remove it from the order
+    if (Dict->order != NULL)
+    {
+        DIC_LinkList **Order = Dict->order + Dict->count - 1;
+
+        for (; *Order != *ItemPos; --Order)
+            ;
+
+        memmove(Order, Order + 1, sizeof(DIC_LinkList *) * (Dict->order + Dict->count - Order - 1));
+    }
+
     // Remove the item
     DIC_LinkList *NextList = (*ItemPos)->next;
     (*ItemPos)->next = NULL;
 
-    DIC_DestroyLinkList(*ItemPos);
+    if (Dict->arena == NULL)
+        DIC_DestroyLinkList(*ItemPos);
     *ItemPos = NextList;
+    --Dict->count;
 
     return true;
 }
@@ -381,7 +1060,7 @@ bool DIC_RemoveItem(DIC_Dict *Dict, const char *Key)
 bool DIC_CheckItem(DIC_Dict *Dict, const char *Key)
 {
     extern HAS_Hash *_DIC_HashTable;
-    extern size_t _DIC_DictCount;
+    extern _Atomic size_t _DIC_DictCount;
 
     if (_DIC_HashTable == NULL)
     {
@@ -393,13 +1072,17 @@ bool DIC_CheckItem(DIC_Dict *Dict, const char *Key)
     size_t KeyLength = strlen(Key);
     uint64_t HashKey = HAS_HashValue(_DIC_HashTable, (uint8_t *)Key, KeyLength);
 
+    // Check the bloom filter
+    if (!_DIC_BloomCheck(Dict, HashKey))
+        return false;
+
     // Find the item
     DIC_LinkList **ItemPos = Dict->list + HashKey % Dict->length;
 
     while (*ItemPos != NULL)
     {
         // Check if it found it
-        if (strcmp((*ItemPos)->key, Key) == 0)
+        if ((*ItemPos)->key == Key || ((*ItemPos)->hash == HashKey && strcmp((*ItemPos)->key, Key) == 0))
             return true;
 
         // Get the next item
@@ -412,7 +1095,7 @@ bool DIC_CheckItem(DIC_Dict *Dict, const char *Key)
 DIC_Dict *DIC_CopyDict(DIC_Dict *Dict)
 {
     // Create a new dict
-    DIC_Dict *NewDict = DIC_CreateDict(Dict->length);
+    DIC_Dict *NewDict = ((Dict->order != NULL) ? (DIC_CreateOrderedDict(Dict->length)) : (DIC_CreateDict(Dict->length)));
 
     if (NewDict == NULL)
     {
@@ -420,6 +1103,30 @@ DIC_Dict *DIC_CopyDict(DIC_Dict *Dict)
         return NULL;
     }
 
+    NewDict->intern = Dict->intern;
+
+    // Give it the same bloom filter, it is filled when the items are added
+    if (Dict->bloom != NULL && !DIC_AddBloomFilter(NewDict, Dict->bloomCapacity))
+    {
+        _DIC_AddError(_DIC_ERRORID_COPYDICT_BLOOM, _DIC_ERRORMES_BLOOM);
+        DIC_DestroyDict(NewDict);
+        return NULL;
+    }
+
+    // Add the items of an ordered dict in order, this gives the same buckets since items are added to the end of the bucket
+    if (Dict->order != NULL)
+    {
+        for (DIC_LinkList **Order = Dict->order, **EndOrder = Dict->order + Dict->count; Order < EndOrder; ++Order)
+            if (!DIC_AddItem(NewDict, (*Order)->key, (*Order)->value, (*Order)->size, (((*Order)->pointer) ? (DIC_MODE_POINTER) : (DIC_MODE_COPY))))
+            {
+                _DIC_AddError(_DIC_ERRORID_COPYDICT_ADDITEM, _DIC_ERRORMES_ADDITEM);
+                DIC_DestroyDict(NewDict);
+                return NULL;
+            }
+
+        return NewDict;
+    }
+
     // Go through and copy all of the items
     for (DIC_LinkList **SrcList = Dict->list, **DstList = NewDict->list, **EndList = Dict->list + Dict->length; SrcList < EndList; ++SrcList, ++DstList)
         for (DIC_LinkList *SrcLink = *SrcList, **DstLink = DstList; SrcLink != NULL; SrcLink = SrcLink->next, DstLink = &(*DstLink)->next)
@@ -436,8 +1143,15 @@ DIC_Dict *DIC_CopyDict(DIC_Dict *Dict)
 
             DIC_InitLinkList(NewLink);
 
-            // Copy key
-            NewLink->key = (char *)malloc(sizeof(char) * (strlen(SrcLink->key) + 1));
+            // Copy key, interned keys are shared
+            if (SrcLink->interned)
+            {
+                NewLink->key = (char *)_DIC_Retain(SrcLink->key);
+                NewLink->interned = true;
+            }
+
+            else
+                NewLink->key = (char *)malloc(sizeof(char) * (strlen(SrcLink->key) + 1));
 
             if (NewLink->key == NULL)
             {
@@ -447,12 +1161,21 @@ DIC_Dict *DIC_CopyDict(DIC_Dict *Dict)
                 return NULL;
             }
 
-            strcpy(NewLink->key, SrcLink->key);
+            if (!SrcLink->interned)
+                strcpy(NewLink->key, SrcLink->key);
+
+            NewLink->hash = SrcLink->hash;
 
             // Copy value
             if (SrcLink->pointer)
                 NewLink->value = SrcLink->value;
 
+            else if (_DIC_ISINLINE(SrcLink))
+            {
+                memcpy(NewLink->inlineValue, SrcLink->inlineValue, sizeof(NewLink->inlineValue));
+                NewLink->value = (void *)NewLink->inlineValue;
+            }
+
             else
             {
                 NewLink->value = malloc(SrcLink->size);
@@ -475,27 +1198,632 @@ DIC_Dict *DIC_CopyDict(DIC_Dict *Dict)
             *DstLink = NewLink;
         }
 
+    NewDict->count = Dict->count;
+
+    if (Dict->bloom != NULL)
+        memcpy(NewDict->bloom, Dict->bloom, sizeof(DIC_BloomBlock) * Dict->bloomLength);
+
     return NewDict;
 }
 
 size_t DIC_DictLength(DIC_Dict *Dict)
 {
-    size_t Length = 0;
+    return Dict->count;
+}
+
+bool DIC_AddBloomFilter(DIC_Dict *Dict, size_t Capacity)
+{
+    if (Capacity < Dict->count)
+        Capacity = Dict->count;
+
+    // Get memory for the new filter, the old one is kept until this succeeds
+    size_t Length = (Capacity + DIC_BLOOMITEMS - 1) / DIC_BLOOMITEMS;
+
+    if (Length == 0)
+        Length = 1;
+
+    DIC_BloomBlock *Bloom;
+
+    if (Dict->arena != NULL)
+    {
+        Bloom = (DIC_BloomBlock *)ARN_AllocAligned(Dict->arena, sizeof(DIC_BloomBlock) * Length, sizeof(DIC_BloomBlock));
+
+        if (Bloom == NULL)
+        {
+            _DIC_AddErrorForeign(_DIC_ERRORID_ADDBLOOMFILTER_ARENA, ARN_GetError(), _DIC_ERRORMES_ARENA, sizeof(DIC_BloomBlock) * Length);
+            return false;
+        }
+    }
+
+    else
+    {
+        Bloom = (DIC_BloomBlock *)aligned_alloc(sizeof(DIC_BloomBlock), sizeof(DIC_BloomBlock) * Length);
+
+        if (Bloom == NULL)
+        {
+            _DIC_AddErrorForeign(_DIC_ERRORID_ADDBLOOMFILTER_MALLOC, strerror(errno), _DIC_ERRORMES_MALLOC, sizeof(DIC_BloomBlock) * Length);
+            return false;
+        }
+    }
+
+    memset(Bloom, 0, sizeof(DIC_BloomBlock) * Length);
+
+    if (Dict->bloom != NULL && Dict->arena == NULL)
+        free(Dict->bloom);
+
+    Dict->bloom = Bloom;
+    Dict->bloomLength = Length;
+    Dict->bloomCapacity = Length * DIC_BLOOMITEMS;
+
+    // Add all of the items
+    for (DIC_LinkList **List = Dict->list, **EndList = Dict->list + Dict->length; List < EndList; ++List)
+        for (DIC_LinkList *Link = *List; Link != NULL; Link = Link->next)
+            _DIC_BloomAdd(Dict, Link->hash);
+
+    return true;
+}
+
+static inline DIC_BloomBlock *_DIC_BloomFind(const DIC_Dict *Dict, uint64_t HashKey)
+{
+    // The upper half of the hash picks the block and the lower half the bits
+    return Dict->bloom + (((HashKey >> 32) * Dict->bloomLength) >> 32);
+}
+
+static inline void _DIC_BloomAdd(DIC_Dict *Dict, uint64_t HashKey)
+{
+    extern const uint32_t _DIC_BloomSalts[8];
+
+    DIC_BloomBlock *Block = _DIC_BloomFind(Dict, HashKey);
+
+    for (size_t Pos = 0; Pos < 8; ++Pos)
+        Block->bits[Pos] |= (uint64_t)1 << (((uint32_t)HashKey * _DIC_BloomSalts[Pos]) >> 26);
+}
+
+static inline bool _DIC_BloomCheck(const DIC_Dict *Dict, uint64_t HashKey)
+{
+    extern const uint32_t _DIC_BloomSalts[8];
+
+    if (Dict->bloom == NULL)
+        return true;
+
+    const DIC_BloomBlock *Block = _DIC_BloomFind(Dict, HashKey);
+
+    for (size_t Pos = 0; Pos < 8; ++Pos)
+        if ((Block->bits[Pos] & ((uint64_t)1 << (((uint32_t)HashKey * _DIC_BloomSalts[Pos]) >> 26))) == 0)
+            return false;
+
+    return true;
+}
+
+DIC_Iterator DIC_Iterate(DIC_Dict *Dict)
+{
+    DIC_Iterator Iterator;
+
+    Iterator.dict = Dict;
+    Iterator.bucket = Dict->list;
+    Iterator.endBucket = Dict->list + Dict->length;
+    Iterator.link = NULL;
+    Iterator.pos = 0;
+    Iterator.key = NULL;
+    Iterator.value = NULL;
+    Iterator.size = 0;
+
+    return Iterator;
+}
+
+bool DIC_Next(DIC_Iterator *Iterator)
+{
+    // Ordered dicts are a scan of the order list
+    if (Iterator->dict->order != NULL)
+    {
+        if (Iterator->pos >= Iterator->dict->count)
+            return false;
+
+        Iterator->link = Iterator->dict->order[Iterator->pos++];
+    }
+
+    else
+    {
+        // Go to the next item in the bucket
+        if (Iterator->link != NULL)
+            Iterator->link = Iterator->link->next;
+
+        // Find the next bucket with items
+        for (; Iterator->link == NULL; ++Iterator->bucket)
+        {
+            if (Iterator->bucket >= Iterator->endBucket)
+                return false;
+
+            Iterator->link = *Iterator->bucket;
+        }
+    }
+
+    Iterator->key = Iterator->link->key;
+    Iterator->value = Iterator->link->value;
+    Iterator->size = Iterator->link->size;
+
+    return true;
+}
+
+bool DIC_Save(DIC_Dict *Dict, const char *FileName)
+{
+    extern HAS_Hash *_DIC_HashTable;
+    extern _Atomic size_t _DIC_DictCount;
+
+    if (_DIC_HashTable == NULL)
+    {
+        _DIC_SetError(_DIC_ERRORID_SAVE_HASHTABLE, _DIC_ERRORMES_NOHASHTABLE, _DIC_DictCount);
+        return false;
+    }
+
+    // Setup the header, entries are placed bucket by bucket after the bucket list, each followed by its key and value
+    DIC_FileHeader Header;
+    Header.magic = _DIC_FILEMAGIC;
+    Header.length = Dict->length;
+    Header.count = 0;
+    Header.depth = _DIC_HashTable->depth;
+    Header.table = sizeof(DIC_FileHeader);
+    Header.buckets = Header.table + sizeof(uint64_t) * _HAS_HASHBASESIZE * Header.depth;
+    Header.size = Header.buckets + sizeof(uint64_t) * Header.length;
 
-    // Go through the entire dict
+    // Open the file
+    FILE *File = fopen(FileName, "wb");
+
+    if (File == NULL)
+    {
+        _DIC_AddErrorForeign(_DIC_ERRORID_SAVE_FILE, strerror(errno), _DIC_ERRORMES_OPENFILE, FileName);
+        return false;
+    }
+
+    // Find the size of the file and write the header and hash table
     for (DIC_LinkList **List = Dict->list, **EndList = Dict->list + Dict->length; List < EndList; ++List)
         for (DIC_LinkList *Link = *List; Link != NULL; Link = Link->next)
-            ++Length;
+        {
+            Header.size += sizeof(DIC_FileEntry) + _DIC_ALIGN(strlen(Link->key) + 1) + _DIC_ALIGN(Link->size);
+            ++Header.count;
+        }
+
+    if (fwrite(&Header, sizeof(DIC_FileHeader), 1, File) != 1 || fwrite(_DIC_HashTable->table, sizeof(uint64_t) * _HAS_HASHBASESIZE, Header.depth, File) != Header.depth)
+    {
+        _DIC_AddErrorForeign(_DIC_ERRORID_SAVE_WRITE, strerror(errno), _DIC_ERRORMES_WRITEFILE, FileName);
+        fclose(File);
+        return false;
+    }
+
+    // Write the bucket list
+    uint64_t Offset = Header.buckets + sizeof(uint64_t) * Header.length;
+
+    for (DIC_LinkList **List = Dict->list, **EndList = Dict->list + Dict->length; List < EndList; ++List)
+    {
+        uint64_t BucketOffset = ((*List == NULL) ? (0) : (Offset));
+
+        if (fwrite(&BucketOffset, sizeof(uint64_t), 1, File) != 1)
+        {
+            _DIC_AddErrorForeign(_DIC_ERRORID_SAVE_WRITE, strerror(errno), _DIC_ERRORMES_WRITEFILE, FileName);
+            fclose(File);
+            return false;
+        }
+
+        for (DIC_LinkList *Link = *List; Link != NULL; Link = Link->next)
+            Offset += sizeof(DIC_FileEntry) + _DIC_ALIGN(strlen(Link->key) + 1) + _DIC_ALIGN(Link->size);
+    }
+
+    // Write the entries, the entries of a bucket are placed right after each other
+    static const uint8_t Padding[sizeof(uint64_t)] = {0};
+    Offset = Header.buckets + sizeof(uint64_t) * Header.length;
+
+    for (DIC_LinkList **List = Dict->list, **EndList = Dict->list + Dict->length; List < EndList; ++List)
+        for (DIC_LinkList *Link = *List; Link != NULL; Link = Link->next)
+        {
+            size_t KeyLength = strlen(Link->key) + 1;
+            DIC_FileEntry Entry;
+            Entry.key = Offset + sizeof(DIC_FileEntry);
+            Entry.value = Entry.key + _DIC_ALIGN(KeyLength);
+            Entry.size = Link->size;
+            Offset = Entry.value + _DIC_ALIGN(Link->size);
+            Entry.next = ((Link->next == NULL) ? (0) : (Offset));
+
+            if (fwrite(&Entry, sizeof(DIC_FileEntry), 1, File) != 1 || fwrite(Link->key, sizeof(char), KeyLength, File) != KeyLength || fwrite(Padding, sizeof(uint8_t), _DIC_ALIGN(KeyLength) - KeyLength, File) != _DIC_ALIGN(KeyLength) - KeyLength || (Link->size > 0 && fwrite(Link->value, sizeof(uint8_t), Link->size, File) != Link->size) || fwrite(Padding, sizeof(uint8_t), _DIC_ALIGN(Link->size) - Link->size, File) != _DIC_ALIGN(Link->size) - Link->size)
+            {
+                _DIC_AddErrorForeign(_DIC_ERRORID_SAVE_WRITE, strerror(errno), _DIC_ERRORMES_WRITEFILE, FileName);
+                fclose(File);
+                return false;
+            }
+        }
+
+    if (fclose(File) != 0)
+    {
+        _DIC_AddErrorForeign(_DIC_ERRORID_SAVE_WRITE, strerror(errno), _DIC_ERRORMES_WRITEFILE, FileName);
+        return false;
+    }
+
+    return true;
+}
+
+DIC_MappedDict *DIC_Map(const char *FileName)
+{
+    // Open the file
+    int FileID = open(FileName, O_RDONLY);
+
+    if (FileID == -1)
+    {
+        _DIC_AddErrorForeign(_DIC_ERRORID_MAP_OPEN, strerror(errno), _DIC_ERRORMES_OPENFILE, FileName);
+        return NULL;
+    }
+
+    // Get the size
+    struct stat FileStat;
 
-    return Length;
+    if (fstat(FileID, &FileStat) == -1)
+    {
+        _DIC_AddErrorForeign(_DIC_ERRORID_MAP_STAT, strerror(errno), _DIC_ERRORMES_STATFILE, FileName);
+        close(FileID);
+        return NULL;
+    }
+
+    size_t Size = (size_t)FileStat.st_size;
+
+    if (Size < sizeof(DIC_FileHeader))
+    {
+        _DIC_SetError(_DIC_ERRORID_MAP_SMALL, _DIC_ERRORMES_SMALLFILE, FileName, Size);
+        close(FileID);
+        return NULL;
+    }
+
+    // Map it, the file can be closed afterwards
+    void *Data = mmap(NULL, Size, PROT_READ, MAP_SHARED, FileID, 0);
+    close(FileID);
+
+    if (Data == MAP_FAILED)
+    {
+        _DIC_AddErrorForeign(_DIC_ERRORID_MAP_MMAP, strerror(errno), _DIC_ERRORMES_MAPFILE, FileName);
+        return NULL;
+    }
+
+    // Make sure the header is valid
+    const DIC_FileHeader *Header = (const DIC_FileHeader *)Data;
+
+    // The sizes are compared by dividing so a corrupt header cannot make them wrap around
+    if (Header->magic != _DIC_FILEMAGIC || Header->size != Size || Header->length == 0 || Header->depth == 0 || Header->table != sizeof(DIC_FileHeader) || Header->depth > (Size - Header->table) / (sizeof(uint64_t) * _HAS_HASHBASESIZE) || Header->buckets != Header->table + sizeof(uint64_t) * _HAS_HASHBASESIZE * Header->depth || Header->length > (Size - Header->buckets) / sizeof(uint64_t) || Header->count > Size / sizeof(DIC_FileEntry))
+    {
+        _DIC_SetError(_DIC_ERRORID_MAP_FORMAT, _DIC_ERRORMES_FORMAT, FileName);
+        munmap(Data, Size);
+        return NULL;
+    }
+
+    // Create the dict
+    DIC_MappedDict *Dict = (DIC_MappedDict *)malloc(sizeof(DIC_MappedDict));
+
+    if (Dict == NULL)
+    {
+        _DIC_AddErrorForeign(_DIC_ERRORID_MAP_MALLOC, strerror(errno), _DIC_ERRORMES_MALLOC, sizeof(DIC_MappedDict));
+        munmap(Data, Size);
+        return NULL;
+    }
+
+    DIC_InitMappedDict(Dict);
+
+    Dict->data = (uint8_t *)Data;
+    Dict->size = Size;
+    Dict->header = Header;
+    Dict->buckets = (const uint64_t *)(Dict->data + Header->buckets);
+    Dict->hash.table = (uint64_t *)(Dict->data + Header->table);
+    Dict->hash.depth = (uint32_t)Header->depth;
+
+    return Dict;
+}
+
+const DIC_FileEntry *_DIC_MapFind(const DIC_MappedDict *Dict, const char *Key)
+{
+    // Hash the key using the saved hash
+    uint64_t HashKey = HAS_HashValue((HAS_Hash *)&Dict->hash, (const uint8_t *)Key, strlen(Key));
+
+    // Go through the bucket, it cannot hold more entries than the file so a longer bucket goes in circles
+    uint64_t Steps = 0;
+
+    for (uint64_t Offset = Dict->buckets[HashKey % Dict->header->length]; Offset != 0; ++Steps)
+    {
+        // Make sure it is inside the file
+        if (Steps >= Dict->header->count || Offset % sizeof(uint64_t) != 0 || Offset > Dict->size - sizeof(DIC_FileEntry))
+        {
+            _DIC_SetError(_DIC_ERRORID_MAPGETITEM_CORRUPT, _DIC_ERRORMES_CORRUPT, Offset);
+            return NULL;
+        }
+
+        const DIC_FileEntry *Entry = (const DIC_FileEntry *)(Dict->data + Offset);
+
+        if (Entry->key >= Dict->size || memchr(Dict->data + Entry->key, '\0', Dict->size - Entry->key) == NULL)
+        {
+            _DIC_SetError(_DIC_ERRORID_MAPGETITEM_CORRUPT, _DIC_ERRORMES_CORRUPT, Entry->key);
+            return NULL;
+        }
+
+        // Check if it found it
+        if (strcmp((const char *)(Dict->data + Entry->key), Key) == 0)
+        {
+            if (Entry->value > Dict->size || Entry->size > Dict->size - Entry->value)
+            {
+                _DIC_SetError(_DIC_ERRORID_MAPGETITEM_CORRUPT, _DIC_ERRORMES_CORRUPT, Entry->value);
+                return NULL;
+            }
+
+            return Entry;
+        }
+
+        Offset = Entry->next;
+    }
+
+    _DIC_SetError(_DIC_ERRORID_MAPGETITEM_NOITEM, _DIC_ERRORMES_NOITEM);
+    return NULL;
+}
+
+const void *DIC_MapGetItem(const DIC_MappedDict *Dict, const char *Key, size_t *Size)
+{
+    // Find the entry
+    const DIC_FileEntry *Entry = _DIC_MapFind(Dict, Key);
+
+    if (Entry == NULL)
+        return NULL;
+
+    if (Size != NULL)
+        *Size = Entry->size;
+
+    return (const void *)(Dict->data + Entry->value);
+}
+
+bool DIC_MapCheckItem(const DIC_MappedDict *Dict, const char *Key)
+{
+    return _DIC_MapFind(Dict, Key) != NULL;
+}
+
+size_t DIC_MapLength(const DIC_MappedDict *Dict)
+{
+    return Dict->header->count;
+}
+
+static inline uint64_t DIC_HashUint64(uint64_t Key)
+{
+    return Key * _DIC_HASHMULTIPLIER;
+}
+
+uint64_t DIC_HashBinary(DIC_BinaryKey Key)
+{
+    uint64_t HashValue = (uint64_t)Key.length * _DIC_HASHMULTIPLIER;
+    const uint8_t *Data = Key.data;
+    uint64_t Word;
+
+    // Go through 8 bytes at a time
+    for (const uint8_t *EndData = Key.data + (Key.length & ~(sizeof(uint64_t) - 1)); Data < EndData; Data += sizeof(uint64_t))
+    {
+        memcpy(&Word, Data, sizeof(uint64_t));
+        HashValue = (HashValue ^ Word) * _DIC_HASHMULTIPLIER;
+        HashValue ^= HashValue >> 32;
+    }
+
+    // Add the remaining bytes, an empty key may have no data so nothing is copied then
+    size_t Rest = Key.length & (sizeof(uint64_t) - 1);
+    Word = 0;
+
+    if (Rest > 0)
+        memcpy(&Word, Data, Rest);
+
+    HashValue = (HashValue ^ Word) * _DIC_HASHMULTIPLIER;
+
+    // Mix the lower bits into the upper bits
+    HashValue ^= HashValue >> 29;
+    return HashValue * _DIC_HASHMULTIPLIER;
+}
+
+static inline bool DIC_EqualBinary(DIC_BinaryKey Key1, DIC_BinaryKey Key2)
+{
+    return Key1.length == Key2.length && memcmp(Key1.data, Key2.data, Key1.length) == 0;
+}
+
+bool _DIC_CopyBinaryKey(DIC_BinaryKey *Dst, DIC_BinaryKey Src)
+{
+    // Allocate at least one byte so an empty key is not NULL
+    uint8_t *Data = (uint8_t *)malloc(sizeof(uint8_t) * ((Src.length > 0) ? (Src.length) : (1)));
+
+    if (Data == NULL)
+        return false;
+
+    memcpy(Data, Src.data, Src.length);
+    Dst->data = Data;
+    Dst->length = Src.length;
+
+    return true;
+}
+
+const char *DIC_Intern(const char *String)
+{
+    extern DIC_InternPool *_DIC_InternPool;
+    extern pthread_mutex_t _DIC_InternLock;
+
+    pthread_mutex_lock(&_DIC_InternLock);
+
+    // Create the pool
+    if (_DIC_InternPool == NULL)
+    {
+        DIC_InternPool *Pool = (DIC_InternPool *)malloc(sizeof(DIC_InternPool));
+
+        if (Pool == NULL)
+        {
+            _DIC_AddErrorForeign(_DIC_ERRORID_INTERN_MALLOCPOOL, strerror(errno), _DIC_ERRORMES_MALLOC, sizeof(DIC_InternPool));
+            pthread_mutex_unlock(&_DIC_InternLock);
+            return NULL;
+        }
+
+        DIC_InitInternPool(Pool);
+        Pool->length = 64;
+        Pool->list = (DIC_InternEntry **)calloc(Pool->length, sizeof(DIC_InternEntry *));
+
+        if (Pool->list == NULL)
+        {
+            _DIC_AddErrorForeign(_DIC_ERRORID_INTERN_MALLOCPOOL, strerror(errno), _DIC_ERRORMES_MALLOC, sizeof(DIC_InternEntry *) * Pool->length);
+            free(Pool);
+            pthread_mutex_unlock(&_DIC_InternLock);
+            return NULL;
+        }
+
+        _DIC_InternPool = Pool;
+    }
+
+    // Look for the string
+    size_t Length = strlen(String);
+    uint64_t HashKey = DIC_HashBinary(DIC_BINARYKEY(String, Length));
+    DIC_InternEntry **EntryPos = _DIC_InternPool->list + (HashKey & (_DIC_InternPool->length - 1));
+
+    for (DIC_InternEntry *Entry = *EntryPos; Entry != NULL; Entry = Entry->next)
+        if (Entry->string == String || (Entry->hash == HashKey && strcmp(Entry->string, String) == 0))
+        {
+            atomic_fetch_add(&Entry->refCount, 1);
+            pthread_mutex_unlock(&_DIC_InternLock);
+            return Entry->string;
+        }
+
+    // Add a new entry
+    DIC_InternEntry *Entry = (DIC_InternEntry *)malloc(sizeof(DIC_InternEntry) + sizeof(char) * (Length + 1));
+
+    if (Entry == NULL)
+    {
+        _DIC_AddErrorForeign(_DIC_ERRORID_INTERN_MALLOCENTRY, strerror(errno), _DIC_ERRORMES_MALLOC, sizeof(DIC_InternEntry) + sizeof(char) * (Length + 1));
+
+        if (_DIC_InternPool->count == 0)
+        {
+            free(_DIC_InternPool->list);
+            free(_DIC_InternPool);
+            _DIC_InternPool = NULL;
+        }
+
+        pthread_mutex_unlock(&_DIC_InternLock);
+        return NULL;
+    }
+
+    Entry->hash = HashKey;
+    atomic_init(&Entry->refCount, 1);
+    memcpy(Entry->string, String, Length + 1);
+    Entry->next = *EntryPos;
+    *EntryPos = Entry;
+    ++_DIC_InternPool->count;
+
+    // Double the number of buckets when it gets full, if there is no memory the chains just get longer
+    if (_DIC_InternPool->count > _DIC_InternPool->length)
+    {
+        size_t NewLength = _DIC_InternPool->length * 2;
+        DIC_InternEntry **NewList = (DIC_InternEntry **)calloc(NewLength, sizeof(DIC_InternEntry *));
+
+        if (NewList != NULL)
+        {
+            for (DIC_InternEntry **List = _DIC_InternPool->list, **EndList = _DIC_InternPool->list + _DIC_InternPool->length; List < EndList; ++List)
+                for (DIC_InternEntry *Move = *List, *Next; Move != NULL; Move = Next)
+                {
+                    Next = Move->next;
+                    Move->next = NewList[Move->hash & (NewLength - 1)];
+                    NewList[Move->hash & (NewLength - 1)] = Move;
+                }
+
+            free(_DIC_InternPool->list);
+            _DIC_InternPool->list = NewList;
+            _DIC_InternPool->length = NewLength;
+        }
+    }
+
+    pthread_mutex_unlock(&_DIC_InternLock);
+    return Entry->string;
+}
+
+void DIC_Release(const char *String)
+{
+    extern DIC_InternPool *_DIC_InternPool;
+    extern pthread_mutex_t _DIC_InternLock;
+
+    DIC_InternEntry *Entry = (DIC_InternEntry *)(String - offsetof(DIC_InternEntry, string));
+
+    // The count must only reach 0 while locked so DIC_Intern cannot find the entry while it is removed
+    pthread_mutex_lock(&_DIC_InternLock);
+
+    if (atomic_fetch_sub(&Entry->refCount, 1) > 1)
+    {
+        pthread_mutex_unlock(&_DIC_InternLock);
+        return;
+    }
+
+    // Remove it from the pool
+    DIC_InternEntry **EntryPos = _DIC_InternPool->list + (Entry->hash & (_DIC_InternPool->length - 1));
+
+    for (; *EntryPos != Entry; EntryPos = &(*EntryPos)->next)
+        ;
+
+    *EntryPos = Entry->next;
+    free(Entry);
+
+    // Destroy the pool when it is empty
+    if (--_DIC_InternPool->count == 0)
+    {
+        free(_DIC_InternPool->list);
+        free(_DIC_InternPool);
+        _DIC_InternPool = NULL;
+    }
+
+    pthread_mutex_unlock(&_DIC_InternLock);
+}
+
+static inline const char *_DIC_Retain(const char *String)
+{
+    // The caller holds a reference so the entry cannot be removed meanwhile and no lock is needed
+    atomic_fetch_add(&((DIC_InternEntry *)(String - offsetof(DIC_InternEntry, string)))->refCount, 1);
+
+    return String;
+}
+
+bool DIC_InternKeys(DIC_Dict *Dict)
+{
+    // The keys of arena dicts are released with the arena, so they cannot hold references into the pool
+    if (Dict->arena != NULL)
+        return true;
+
+    Dict->intern = true;
+    Dict->borrow = false;
+
+    // Replace the existing keys
+    for (DIC_LinkList **List = Dict->list, **EndList = Dict->list + Dict->length; List < EndList; ++List)
+        for (DIC_LinkList *Link = *List; Link != NULL; Link = Link->next)
+            if (!Link->interned)
+            {
+                const char *Key = DIC_Intern(Link->key);
+
+                if (Key == NULL)
+                {
+                    _DIC_AddError(_DIC_ERRORID_INTERNKEYS_INTERN, _DIC_ERRORMES_INTERN, Link->key);
+                    return false;
+                }
+
+                if (!Link->borrowed)
+                    free(Link->key);
+
+                Link->key = (char *)Key;
+                Link->interned = true;
+                Link->borrowed = false;
+            }
+
+    return true;
+}
+
+void DIC_BorrowKeys(DIC_Dict *Dict)
+{
+    Dict->borrow = true;
+    Dict->intern = false;
 }
 
 void DIC_InitLinkList(DIC_LinkList *Struct)
 {
     Struct->key = NULL;
+    Struct->hash = 0;
     Struct->value = NULL;
     Struct->size = 0;
     Struct->pointer = true;
+    Struct->interned = false;
+    Struct->borrowed = false;
     Struct->next = NULL;
 }
 
@@ -503,15 +1831,47 @@ void DIC_InitDict(DIC_Dict *Struct)
 {
     Struct->list = NULL;
     Struct->length = 0;
+    Struct->count = 0;
+    Struct->order = NULL;
+    Struct->orderLength = 0;
+    Struct->bloom = NULL;
+    Struct->bloomLength = 0;
+    Struct->bloomCapacity = 0;
+    Struct->intern = false;
+    Struct->arena = NULL;
+    Struct->borrow = false;
+}
+
+void DIC_InitInternPool(DIC_InternPool *Struct)
+{
+    Struct->list = NULL;
+    Struct->length = 0;
+    Struct->count = 0;
+}
+
+void DIC_InitMappedDict(DIC_MappedDict *Struct)
+{
+    Struct->data = NULL;
+    Struct->size = 0;
+    Struct->header = NULL;
+    Struct->buckets = NULL;
+    Struct->hash.table = NULL;
+    Struct->hash.depth = 0;
 }
 
 void DIC_DestroyLinkList(DIC_LinkList *LinkList)
 {
     // Destroy the key
     if (LinkList->key != NULL)
-        free(LinkList->key);
+    {
+        if (LinkList->interned)
+            DIC_Release(LinkList->key);
 
-    if (!LinkList->pointer && LinkList->value != NULL)
+        else if (!LinkList->borrowed)
+            free(LinkList->key);
+    }
+
+    if (!LinkList->pointer && LinkList->value != NULL && !_DIC_ISINLINE(LinkList))
         free(LinkList->value);
 
     if (LinkList->next != NULL)
@@ -522,6 +1882,10 @@ void DIC_DestroyLinkList(DIC_LinkList *LinkList)
 
 void DIC_DestroyDict(DIC_Dict *Dict)
 {
+    // Everything in an arena dict is freed with the arena
+    if (Dict->arena != NULL)
+        return;
+
     // Destroy the dict
     if (Dict->list != NULL)
     {
@@ -532,26 +1896,60 @@ void DIC_DestroyDict(DIC_Dict *Dict)
         free(Dict->list);
     }
 
+    if (Dict->order != NULL)
+        free(Dict->order);
+
+    if (Dict->bloom != NULL)
+        free(Dict->bloom);
+
     free(Dict);
 
     // Destroy the hash if needed
-    extern HAS_Hash *_DIC_HashTable;
-    extern size_t _DIC_DictCount;
-
-    if (_DIC_DictCount == 0)
-    {
-        _DIC_SetError(_DIC_ERRORID_DESTROYDICT_NODICT, _DIC_ERRORMES_WRONGDICTCOUNT);
-        return;
-    }
+    DIC_ReleaseHash();
+}
 
-    --_DIC_DictCount;
+void DIC_Unmap(DIC_MappedDict *Dict)
+{
+    if (Dict->data != NULL && munmap(Dict->data, Dict->size) == -1)
+        _DIC_AddErrorForeign(_DIC_ERRORID_UNMAP_MUNMAP, strerror(errno), _DIC_ERRORMES_UNMAP);
 
-    // Destroy hash
-    if (_DIC_DictCount == 0 && _DIC_HashTable != NULL)
-    {
-        HAS_DestroyHash(_DIC_HashTable);
-        _DIC_HashTable = NULL;
-    }
+    free(Dict);
 }
 
+// The settings of a typed dictionary the includer is about to create are kept aside while the built in ones are made
+#pragma push_macro("TDIC_PREFIX")
+#pragma push_macro("TDIC_KEYTYPE")
+#pragma push_macro("TDIC_HASH")
+#pragma push_macro("TDIC_EQUAL")
+#pragma push_macro("TDIC_COPYKEY")
+#pragma push_macro("TDIC_FREEKEY")
+#undef TDIC_PREFIX
+#undef TDIC_KEYTYPE
+#undef TDIC_HASH
+#undef TDIC_EQUAL
+#undef TDIC_COPYKEY
+#undef TDIC_FREEKEY
+
+// Dictionaries with uint64 keys
+#define TDIC_PREFIX DICU64
+#define TDIC_KEYTYPE uint64_t
+#define TDIC_HASH(Key) DIC_HashUint64(Key)
+#include <TypedDictionary.h>
+
+// Dictionaries with binary keys given as a pointer and a length
+#define TDIC_PREFIX DICBIN
+#define TDIC_KEYTYPE DIC_BinaryKey
+#define TDIC_HASH(Key) DIC_HashBinary(Key)
+#define TDIC_EQUAL(Key1, Key2) DIC_EqualBinary(Key1, Key2)
+#define TDIC_COPYKEY(Dst, Src) _DIC_CopyBinaryKey(&(Dst), Src)
+#define TDIC_FREEKEY(Key) free((void *)(Key).data)
+#include <TypedDictionary.h>
+
+#pragma pop_macro("TDIC_PREFIX")
+#pragma pop_macro("TDIC_KEYTYPE")
+#pragma pop_macro("TDIC_HASH")
+#pragma pop_macro("TDIC_EQUAL")
+#pragma pop_macro("TDIC_COPYKEY")
+#pragma pop_macro("TDIC_FREEKEY")
+
 #endif
\ No newline at end of file
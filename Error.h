@@ -54,6 +54,10 @@ void ERR_SETUPNAMEPRE(ERR_PREFIX, ExitFunc)(uint64_t ErrorID) {exit((int32_t)Err
 #define ERR_ERRORTYPE_REDUCE 0x00000100 // How to reduce an ID to get the error type
 #endif
 
+#ifndef ERR_THREADLOCAL
+#define ERR_THREADLOCAL _Thread_local // Every thread has its own error messages like errno, define it as nothing to share them between threads
+#endif
+
 // Gets the error message
 // Returns a copy of the error string
 #define ERR_GETERROR ERR_SETUPNAME(ERR_PREFIX, GetError)
@@ -215,28 +219,28 @@ void (*ERR_EXIT)(uint64_t ErrorID) = ERR_EXITFUNC;
 void ERR_SETLOGFILE(FILE *LogFile);
 
 // The current error message
-static char ERR_CURRENTMES[ERR_MAXLENGTH] = "No error has occured";
+static ERR_THREADLOCAL char ERR_CURRENTMES[ERR_MAXLENGTH] = "No error has occured";
 
 // The string which the error message is copied to when given to the user
-static char ERR_RETURNMES[ERR_MAXLENGTH] = "";
+static ERR_THREADLOCAL char ERR_RETURNMES[ERR_MAXLENGTH] = "";
 
 // A temperary string used in the add error functions
-static char ERR_TEMPMES[ERR_MAXLENGTH] = "";
+static ERR_THREADLOCAL char ERR_TEMPMES[ERR_MAXLENGTH] = "";
 
 // The worst error type that has yet occured
-static uint64_t ERR_ERRORTYPE = 0;
+static ERR_THREADLOCAL uint64_t ERR_ERRORTYPE = 0;
 
 // The last error ID
-static uint64_t ERR_ERRORID = 0;
+static ERR_THREADLOCAL uint64_t ERR_ERRORID = 0;
 
 // List of old error messages
-static char ERR_ERRORMESLIST[ERR_MAXARCHIVED * ERR_MAXLENGTH] = "";
+static ERR_THREADLOCAL char ERR_ERRORMESLIST[ERR_MAXARCHIVED * ERR_MAXLENGTH] = "";
 
 // Number of archived error messages
-static uint32_t ERR_ERRORMESCOUNT = 0;
+static ERR_THREADLOCAL uint32_t ERR_ERRORMESCOUNT = 0;
 
 // Where the first archived error message is
-static uint32_t ERR_ERRORMESSTART = 0;
+static ERR_THREADLOCAL uint32_t ERR_ERRORMESSTART = 0;
 
 // The log file
 static FILE *ERR_LOGFILE = NULL;
@@ -250,22 +254,22 @@ void ERR_SETLOGFILE(FILE *LogFile)
 
 uint64_t ERR_GETERRORTYPE(void)
 {
-    extern uint64_t ERR_ERRORTYPE;
+    extern ERR_THREADLOCAL uint64_t ERR_ERRORTYPE;
     
     return ERR_ERRORTYPE;
 }
 
 uint64_t ERR_GETERRORID(void)
 {
-    extern uint64_t ERR_ERRORID;
+    extern ERR_THREADLOCAL uint64_t ERR_ERRORID;
 
     return ERR_ERRORID;
 }
 
 char *ERR_GETERROR(void)
 {
-    extern char ERR_CURRENTMES[];
-    extern char ERR_RETURNMES[];
+    extern ERR_THREADLOCAL char ERR_CURRENTMES[];
+    extern ERR_THREADLOCAL char ERR_RETURNMES[];
 
     snprintf(ERR_RETURNMES, ERR_MAXLENGTH, "%s", ERR_CURRENTMES);
 
@@ -286,7 +290,7 @@ void ERR_SETERROR(uint64_t ErrorID, const char *Format, ...)
 
 void __ERR_ADDERROR(uint64_t ErrorID, const char *ErrorMes, const char *Format, va_list *VarArgs, bool OverwriteMessage)
 {
-    extern char ERR_TEMPMES[];
+    extern ERR_THREADLOCAL char ERR_TEMPMES[];
     extern FILE *ERR_LOGFILE;
 
     // Change write position in error file if it should overwrite the last message
@@ -348,7 +352,7 @@ void __ERR_ADDERROR(uint64_t ErrorID, const char *ErrorMes, const char *Format,
 
 void ERR_ADDERROR(uint64_t ErrorID, const char *Format, ...)
 {
-    extern char ERR_TEMPMES[];
+    extern ERR_THREADLOCAL char ERR_TEMPMES[];
 
     // Setup to get the error messages
     va_list VarArgs;
@@ -361,7 +365,7 @@ void ERR_ADDERROR(uint64_t ErrorID, const char *Format, ...)
 
 void ERR_ADDERRORFOREIGN(uint64_t ErrorID, const char *ErrorMes, const char *Format, ...)
 {
-    extern char ERR_TEMPMES[];
+    extern ERR_THREADLOCAL char ERR_TEMPMES[];
 
     // Setup to get the error messages
     va_list VarArgs;
@@ -374,9 +378,9 @@ void ERR_ADDERRORFOREIGN(uint64_t ErrorID, const char *ErrorMes, const char *For
 
 void __ERR_SETERROR(uint64_t ErrorID, const char *Format, va_list *VarArgs, bool OverwriteMessage)
 {
-    extern char ERR_CURRENTMES[];
-    extern uint64_t ERR_ERRORTYPE;
-    extern uint64_t ERR_ERRORID;
+    extern ERR_THREADLOCAL char ERR_CURRENTMES[];
+    extern ERR_THREADLOCAL uint64_t ERR_ERRORTYPE;
+    extern ERR_THREADLOCAL uint64_t ERR_ERRORID;
 
     // Set error ID
     ERR_ERRORID = ErrorID;
@@ -424,9 +428,9 @@ void __ERR_SETERROR(uint64_t ErrorID, const char *Format, va_list *VarArgs, bool
     }
 
     // Add error message to error message list
-    extern char ERR_ERRORMESLIST[];
-    extern uint32_t ERR_ERRORMESCOUNT;
-    extern uint32_t ERR_ERRORMESSTART;
+    extern ERR_THREADLOCAL char ERR_ERRORMESLIST[];
+    extern ERR_THREADLOCAL uint32_t ERR_ERRORMESCOUNT;
+    extern ERR_THREADLOCAL uint32_t ERR_ERRORMESSTART;
 
     // Find the position if there is space
     int32_t Pos = ERR_ERRORMESCOUNT - ((OverwriteMessage) ? (1) : (0));
@@ -457,9 +461,9 @@ void __ERR_SETERROR(uint64_t ErrorID, const char *Format, va_list *VarArgs, bool
 
 char *ERR_GETARCHIVEDERROR(void)
 {
-    extern char ERR_ERRORMESLIST[];
-    extern uint32_t ERR_ERRORMESCOUNT;
-    extern uint32_t ERR_ERRORMESSTART;
+    extern ERR_THREADLOCAL char ERR_ERRORMESLIST[];
+    extern ERR_THREADLOCAL uint32_t ERR_ERRORMESCOUNT;
+    extern ERR_THREADLOCAL uint32_t ERR_ERRORMESSTART;
 
     if (ERR_ERRORMESCOUNT == 0)
         return NULL;
@@ -476,8 +480,8 @@ char *ERR_GETARCHIVEDERROR(void)
 
 void ERR_CLEARARCHIVE(void)
 {
-    extern uint32_t ERR_ERRORMESCOUNT;
-    extern uint32_t ERR_ERRORMESSTART;
+    extern ERR_THREADLOCAL uint32_t ERR_ERRORMESCOUNT;
+    extern ERR_THREADLOCAL uint32_t ERR_ERRORMESSTART;
 
     ERR_ERRORMESSTART = 0;
     ERR_ERRORMESCOUNT = 0;
@@ -492,6 +496,7 @@ void ERR_CLEARARCHIVE(void)
 #undef ERR_MERGE
 #undef ERR_ERRORTYPE_MASK
 #undef ERR_ERRORTYPE_REDUCE
+#undef ERR_THREADLOCAL
 #undef ERR_GETERROR
 #undef ERR_SETERROR
 #undef __ERR_ADDERROR
@@ -23,7 +23,11 @@ enum ___FIL_ErrorID {
     _FIL_ERRORID_SAVECSV_TYPE = 0x400020202,
     _FIL_ERRORID_SAVECSV_FILE = 0x400020203,
     _FIL_ERRORID_SAVECSV_HEADER = 0x400020204,
-    _FIL_ERRORID_SAVECSV_NUMBER = 0x400020205
+    _FIL_ERRORID_SAVECSV_NUMBER = 0x400020205,
+    _FIL_ERRORID_LOADBUFFER_FILE = 0x400030200,
+    _FIL_ERRORID_LOADBUFFER_SEEKEND = 0x400030201,
+    _FIL_ERRORID_LOADBUFFER_FTELL = 0x400030202,
+    _FIL_ERRORID_LOADBUFFER_REALLOC = 0x400030203
 };
 
 #define _FIL_ERRORMES_MALLOC "Unable to allocate memory (Size: %lu)"
@@ -82,6 +86,13 @@ char *FIL_Load(const char *FileName);
 // ...: [Pointer to array long enough to hold all values, then the size of the elements]
 bool FIL_SaveCSV(const char *FileName, const char *Header, const char *Delimiter, size_t Length, size_t Count, ...);
 
+// Loads the entirety of the file into a buffer which is only reallocated if the file does not fit, returns false on error
+// On error the buffer is kept and must still be freed by the caller
+// FileName: The path of the file
+// Buffer: The buffer to load into, it may point to NULL, it is terminated after the file
+// BufferSize: The number of bytes allocated for the buffer, it is updated if the buffer grows
+bool FIL_LoadBuffer(const char *FileName, char **Buffer, size_t *BufferSize);
+
 char *FIL_Load(const char *FileName)
 {
     // Open the file
@@ -141,6 +152,60 @@ char *FIL_Load(const char *FileName)
     return String;
 }
 
+bool FIL_LoadBuffer(const char *FileName, char **Buffer, size_t *BufferSize)
+{
+    // Open the file
+    FILE *File = fopen(FileName, "r");
+
+    if (File == NULL)
+    {
+        _FIL_AddErrorForeign(_FIL_ERRORID_LOADBUFFER_FILE, strerror(errno), _FIL_ERRORMES_OPENFILE, FileName);
+        return false;
+    }
+
+    // Get length of file
+    if (fseek(File, 0, SEEK_END) != 0)
+    {
+        _FIL_AddErrorForeign(_FIL_ERRORID_LOADBUFFER_SEEKEND, strerror(errno), _FIL_ERRORMES_FILESEEK, STR(SEEK_END), 0);
+        fclose(File);
+        return false;
+    }
+
+    int64_t Size = ftell(File);
+
+    if (Size == -1)
+    {
+        _FIL_AddErrorForeign(_FIL_ERRORID_LOADBUFFER_FTELL, strerror(errno), _FIL_ERRORMES_FILETELL);
+        fclose(File);
+        return false;
+    }
+
+    rewind(File);
+
+    // Get more memory if it does not fit
+    if (*Buffer == NULL || *BufferSize < (size_t)Size + 1)
+    {
+        char *NewBuffer = (char *)realloc(*Buffer, sizeof(char) * (Size + 1));
+
+        if (NewBuffer == NULL)
+        {
+            _FIL_AddErrorForeign(_FIL_ERRORID_LOADBUFFER_REALLOC, strerror(errno), _FIL_ERRORMES_REALLOC, sizeof(char) * (Size + 1));
+            fclose(File);
+            return false;
+        }
+
+        *Buffer = NewBuffer;
+        *BufferSize = Size + 1;
+    }
+
+    // Read file
+    Size = fread(*Buffer, sizeof(char), Size, File);
+    (*Buffer)[Size] = '\0';
+    fclose(File);
+
+    return true;
+}
+
 bool FIL_SaveCSV(const char *FileName, const char *Header, const char *Delimiter, size_t Length, size_t Count, ...)
 {
     // Allocate memory for list of lists and types
@@ -285,8 +350,10 @@ bool FIL_SaveCSV(const char *FileName, const char *Header, const char *Delimiter
                     return false;
             }
 
-            // Print
-            if (fprintf(File, Format, Delim, Value, Value) < 0)
+            // Print, the member is passed since floating point values are passed differently than integers
+            int Written = ((*TempTypeList == FIL_DATATYPE_FLOAT || *TempTypeList == FIL_DATATYPE_DOUBLE) ? (fprintf(File, Format, Delim, Value.f)) : (fprintf(File, Format, Delim, Value.i)));
+
+            if (Written < 0)
             {
                     _FIL_AddErrorForeign(_FIL_ERRORID_SAVECSV_NUMBER, strerror(errno), _FIL_ERRORMES_WRITENUMBER, FileName);
                     free(VariableList);
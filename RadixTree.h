@@ -0,0 +1,1192 @@
+#ifndef RADIXTREE_H_INCLUDED
+#define RADIXTREE_H_INCLUDED
+
+// Adaptive radix tree for string keys, lookups take time proportional to the length of the key and all keys sharing a prefix are stored below the same node
+// Inner nodes hold 4, 16, 48 or 256 children and grow or shrink as needed, chains of nodes with one child are compressed into a prefix
+// Keys are stored including the NULL terminator so no key is a prefix of another, values are only stored as pointers
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <stdbool.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#define ERR_PREFIX RDX
+#include <Error.h>
+
+#ifndef RDX_PREFIXSIZE
+#define RDX_PREFIXSIZE 10 // The number of bytes of a compressed prefix stored in the node, longer prefixes are checked against a leaf
+#endif
+
+enum _RDX_ErrorID {
+    _RDX_ERRORID_NONE = 0x700000000,
+    _RDX_ERRORID_CREATETREE_MALLOC = 0x700010200,
+    _RDX_ERRORID_ADDITEM_MALLOCLEAF = 0x700020200,
+    _RDX_ERRORID_ADDITEM_MALLOCNODE = 0x700020201,
+    _RDX_ERRORID_GETITEM_NOITEM = 0x700030200,
+    _RDX_ERRORID_REMOVEITEM_NOITEM = 0x700040200,
+    _RDX_ERRORID_LONGESTPREFIX_NOITEM = 0x700050200,
+    _RDX_ERRORID_NEXT_REALLOC = 0x700060200
+};
+
+#define _RDX_ERRORMES_MALLOC "Unable to allocate memory (Size: %lu)"
+#define _RDX_ERRORMES_REALLOC "Unable to reallocate memory (Size: %lu)"
+#define _RDX_ERRORMES_NOITEM "Unable to locate item"
+
+// Leaves are stored in the child pointers with the lowest bit set
+#define _RDX_ISLEAF(Node) (((uintptr_t)(Node) & 1) == 1)
+#define _RDX_GETLEAF(Node) ((RDX_Leaf *)((uintptr_t)(Node) & ~(uintptr_t)1))
+#define _RDX_SETLEAF(Leaf) ((RDX_Node *)((uintptr_t)(Leaf) | 1))
+
+enum __RDX_NodeType {
+    RDX_NODETYPE_4,
+    RDX_NODETYPE_16,
+    RDX_NODETYPE_48,
+    RDX_NODETYPE_256
+};
+
+typedef enum __RDX_NodeType RDX_NodeType;
+typedef struct __RDX_Node RDX_Node;
+typedef struct __RDX_Node4 RDX_Node4;
+typedef struct __RDX_Node16 RDX_Node16;
+typedef struct __RDX_Node48 RDX_Node48;
+typedef struct __RDX_Node256 RDX_Node256;
+typedef struct __RDX_Leaf RDX_Leaf;
+typedef struct __RDX_Tree RDX_Tree;
+typedef struct __RDX_IteratorFrame RDX_IteratorFrame;
+typedef struct __RDX_Iterator RDX_Iterator;
+
+// The start of every inner node
+struct __RDX_Node {
+    uint8_t type; // The RDX_NodeType of the node
+    uint16_t count; // The number of children
+    uint32_t prefixLength; // The length of the compressed prefix
+    uint8_t prefix[RDX_PREFIXSIZE]; // The first bytes of the compressed prefix
+};
+
+struct __RDX_Node4 {
+    RDX_Node node; // The header
+    uint8_t keys[4]; // The byte of each child, sorted
+    RDX_Node *children[4]; // The children
+};
+
+struct __RDX_Node16 {
+    RDX_Node node; // The header
+    uint8_t keys[16]; // The byte of each child, sorted
+    RDX_Node *children[16]; // The children
+};
+
+struct __RDX_Node48 {
+    RDX_Node node; // The header
+    uint8_t index[256]; // For each byte the position of the child plus one, 0 if there is no child
+    RDX_Node *children[48]; // The children, unused ones are NULL
+};
+
+struct __RDX_Node256 {
+    RDX_Node node; // The header
+    RDX_Node *children[256]; // The child for each byte, NULL if there is none
+};
+
+struct __RDX_Leaf {
+    void *value; // The value of the item
+    size_t length; // The length of the key including the NULL terminator
+    char key[]; // The key
+};
+
+struct __RDX_Tree {
+    RDX_Node *root; // The root node, it may be a leaf, NULL if the tree is empty
+    size_t count; // The number of items
+};
+
+struct __RDX_IteratorFrame {
+    RDX_Node *node; // The node being gone through
+    uint16_t pos; // The position of the next child to look at
+};
+
+struct __RDX_Iterator {
+    RDX_Node *start; // The root of the subtree to go through, it is cleared when it has been started
+    RDX_IteratorFrame *stack; // The path from the root of the subtree to the current node
+    size_t stackCount; // The number of frames on the stack
+    size_t stackLength; // The number of frames there is space for
+    const char *key; // The key of the current item
+    void *value; // The value of the current item
+};
+
+// Goes through all items with keys starting with a prefix in sorted order
+// The iterator is declared before the loop so RDX_StopIterator can be called on it after breaking out of the loop, it frees itself when the loop ends normally
+// Tree: The tree to go through, it must not be changed while doing this
+// Prefix: The prefix of the keys
+// Iterator: An RDX_Iterator variable declared before the loop, it holds the current item
+#define RDX_ForEachPrefix(Tree, Prefix, Iterator) for (Iterator = RDX_IteratePrefix(Tree, Prefix); RDX_Next(&Iterator);)
+
+// Creates a new empty tree
+RDX_Tree *RDX_CreateTree(void);
+
+// Adds an item to the tree, if the key already exists the value is replaced
+// Returns false on error, the tree is unchanged in that case
+// Tree: The tree to add the item to
+// Key: The key for the item, it is copied
+// Value: The value, only the pointer is stored
+bool RDX_AddItem(RDX_Tree *Tree, const char *Key, void *Value);
+
+// Removes an item from the tree, returns false if it does not exist
+// Tree: The tree to remove the item from
+// Key: The key for the item
+bool RDX_RemoveItem(RDX_Tree *Tree, const char *Key);
+
+// Gets an item from the tree, returns NULL if it does not exist
+// Tree: The tree to get the item from
+// Key: The key for the item
+void *RDX_GetItem(RDX_Tree *Tree, const char *Key);
+
+// Checks if an item exists in the tree
+// Tree: The tree to look in
+// Key: The key for the item
+bool RDX_CheckItem(RDX_Tree *Tree, const char *Key);
+
+// Finds the item with the longest key which is a prefix of Key, Key itself included, returns NULL if there is none
+// Tree: The tree to look in
+// Key: The key to match
+// Match: If not NULL, it receives the key of the item found or NULL if there is none, it is owned by the tree
+void *RDX_LongestPrefix(RDX_Tree *Tree, const char *Key, const char **Match);
+
+// Returns the number of items in the tree
+// Tree: The tree to get the length of
+size_t RDX_TreeLength(RDX_Tree *Tree);
+
+// Starts iterating through all items with keys starting with Prefix, use RDX_Next to get each item
+// Tree: The tree to go through
+// Prefix: The prefix of the keys, use "" for all items
+RDX_Iterator RDX_IteratePrefix(RDX_Tree *Tree, const char *Prefix);
+
+// Moves the iterator to the next item in sorted order, returns false when there are no more items or on error
+// The memory of the iterator is freed when it returns false, RDX_StopIterator is only needed when stopping before that
+// Iterator: The iterator to move
+bool RDX_Next(RDX_Iterator *Iterator);
+
+// Frees the memory used by an iterator which has not reached the end, it does not free the iterator itself
+// It can also be called on an iterator which has reached the end
+// Iterator: The iterator to stop
+void RDX_StopIterator(RDX_Iterator *Iterator);
+
+// Finds the position of the child pointer for a byte, returns NULL if there is no child
+// Node: The node to look in
+// Byte: The byte of the child
+RDX_Node **_RDX_FindChild(RDX_Node *Node, uint8_t Byte);
+
+// Finds the child at or after a position in sorted order, returns NULL if there is none
+// Node: The node to look in
+// Pos: The position to start at, it is set to the position after the child found
+RDX_Node *_RDX_NextChild(RDX_Node *Node, uint16_t *Pos);
+
+// Finds the leaf with the smallest key in a subtree
+// Node: The root of the subtree
+RDX_Leaf *_RDX_Minimum(RDX_Node *Node);
+
+// Checks if a leaf has a key
+// Leaf: The leaf to check
+// Key: The key including the NULL terminator
+// Length: The length of the key
+static inline bool _RDX_LeafMatches(const RDX_Leaf *Leaf, const char *Key, size_t Length);
+
+// Returns the number of bytes of the stored prefix of a node which match the key, only the first RDX_PREFIXSIZE bytes are compared
+// Node: The node with the prefix
+// Key: The key to compare with
+// Length: The length of the key
+// Depth: The position in the key matching the start of the prefix
+size_t _RDX_CheckPrefix(const RDX_Node *Node, const char *Key, size_t Length, size_t Depth);
+
+// Returns the position of the first byte of the full prefix of a node which does not match the key, bytes not stored in the node are read from a leaf
+// Node: The node with the prefix
+// Key: The key to compare with
+// Length: The length of the key
+// Depth: The position in the key matching the start of the prefix
+size_t _RDX_PrefixMismatch(RDX_Node *Node, const char *Key, size_t Length, size_t Depth);
+
+// Allocates an inner node, returns NULL on error
+// Type: The type of the node
+RDX_Node *_RDX_CreateNode(RDX_NodeType Type);
+
+// Copies the count and prefix of a node into another
+// Dst: The node to copy to
+// Src: The node to copy from
+static inline void _RDX_CopyHeader(RDX_Node *Dst, const RDX_Node *Src);
+
+// Adds a child to a node, growing it if it is full, returns false on error
+// Node: The node to add to
+// Ref: The position of the pointer to the node, it is changed if the node is replaced
+// Byte: The byte of the child
+// Child: The child to add
+bool _RDX_AddChild(RDX_Node *Node, RDX_Node **Ref, uint8_t Byte, RDX_Node *Child);
+
+// Inserts an item below a node, returns false on error
+// Ref: The position of the pointer to the node
+// Key: The key including the NULL terminator
+// Length: The length of the key
+// Depth: The number of bytes of the key used to get to this node
+// Leaf: The new leaf, it is freed by the caller if this fails
+// Replaced: Set to true if the key already existed, the value is moved into the existing leaf in that case
+bool _RDX_Insert(RDX_Node **Ref, const char *Key, size_t Length, size_t Depth, RDX_Leaf *Leaf, bool *Replaced);
+
+// Removes a child from a node, shrinking it if it gets small enough
+// Node: The node to remove from
+// Ref: The position of the pointer to the node, it is changed if the node is replaced
+// Byte: The byte of the child
+// Child: The position of the child pointer in the node
+void _RDX_RemoveChild(RDX_Node *Node, RDX_Node **Ref, uint8_t Byte, RDX_Node **Child);
+
+// Removes an item below a node, returns the leaf removed or NULL if it was not found
+// Ref: The position of the pointer to the node
+// Key: The key including the NULL terminator
+// Length: The length of the key
+// Depth: The number of bytes of the key used to get to this node
+RDX_Leaf *_RDX_Remove(RDX_Node **Ref, const char *Key, size_t Length, size_t Depth);
+
+void RDX_InitTree(RDX_Tree *Struct);
+void RDX_InitIterator(RDX_Iterator *Struct);
+
+void RDX_DestroyTree(RDX_Tree *Tree);
+
+// Destroys a node and all of its children
+// Node: The node to destroy, it may be a leaf
+void _RDX_DestroyNode(RDX_Node *Node);
+
+RDX_Tree *RDX_CreateTree(void)
+{
+    RDX_Tree *Tree = (RDX_Tree *)malloc(sizeof(RDX_Tree));
+
+    if (Tree == NULL)
+    {
+        _RDX_AddErrorForeign(_RDX_ERRORID_CREATETREE_MALLOC, strerror(errno), _RDX_ERRORMES_MALLOC, sizeof(RDX_Tree));
+        return NULL;
+    }
+
+    RDX_InitTree(Tree);
+
+    return Tree;
+}
+
+bool RDX_AddItem(RDX_Tree *Tree, const char *Key, void *Value)
+{
+    // Create the leaf
+    size_t Length = strlen(Key) + 1;
+    RDX_Leaf *Leaf = (RDX_Leaf *)malloc(sizeof(RDX_Leaf) + sizeof(char) * Length);
+
+    if (Leaf == NULL)
+    {
+        _RDX_AddErrorForeign(_RDX_ERRORID_ADDITEM_MALLOCLEAF, strerror(errno), _RDX_ERRORMES_MALLOC, sizeof(RDX_Leaf) + sizeof(char) * Length);
+        return false;
+    }
+
+    Leaf->value = Value;
+    Leaf->length = Length;
+    memcpy(Leaf->key, Key, Length);
+
+    // Insert it
+    bool Replaced = false;
+
+    if (!_RDX_Insert(&Tree->root, Leaf->key, Length, 0, Leaf, &Replaced))
+    {
+        _RDX_AddErrorForeign(_RDX_ERRORID_ADDITEM_MALLOCNODE, strerror(errno), _RDX_ERRORMES_MALLOC, sizeof(RDX_Node256));
+        free(Leaf);
+        return false;
+    }
+
+    if (Replaced)
+        free(Leaf);
+
+    else
+        ++Tree->count;
+
+    return true;
+}
+
+bool RDX_RemoveItem(RDX_Tree *Tree, const char *Key)
+{
+    RDX_Leaf *Leaf = _RDX_Remove(&Tree->root, Key, strlen(Key) + 1, 0);
+
+    if (Leaf == NULL)
+    {
+        _RDX_SetError(_RDX_ERRORID_REMOVEITEM_NOITEM, _RDX_ERRORMES_NOITEM);
+        return false;
+    }
+
+    free(Leaf);
+    --Tree->count;
+
+    return true;
+}
+
+void *RDX_GetItem(RDX_Tree *Tree, const char *Key)
+{
+    size_t Length = strlen(Key) + 1;
+    size_t Depth = 0;
+    RDX_Node *Node = Tree->root;
+
+    while (Node != NULL)
+    {
+        // Check if it found it
+        if (_RDX_ISLEAF(Node))
+        {
+            if (_RDX_LeafMatches(_RDX_GETLEAF(Node), Key, Length))
+                return _RDX_GETLEAF(Node)->value;
+
+            break;
+        }
+
+        // Skip the prefix, the leaf is checked at the end so only the stored part has to match
+        if (Node->prefixLength > 0)
+        {
+            if (_RDX_CheckPrefix(Node, Key, Length, Depth) != ((Node->prefixLength < RDX_PREFIXSIZE) ? (Node->prefixLength) : (RDX_PREFIXSIZE)))
+                break;
+
+            Depth += Node->prefixLength;
+        }
+
+        if (Depth >= Length)
+            break;
+
+        // Go to the child
+        RDX_Node **Child = _RDX_FindChild(Node, (uint8_t)Key[Depth++]);
+        Node = ((Child != NULL) ? (*Child) : (NULL));
+    }
+
+    _RDX_SetError(_RDX_ERRORID_GETITEM_NOITEM, _RDX_ERRORMES_NOITEM);
+    return NULL;
+}
+
+bool RDX_CheckItem(RDX_Tree *Tree, const char *Key)
+{
+    size_t Length = strlen(Key) + 1;
+    size_t Depth = 0;
+    RDX_Node *Node = Tree->root;
+
+    while (Node != NULL)
+    {
+        if (_RDX_ISLEAF(Node))
+            return _RDX_LeafMatches(_RDX_GETLEAF(Node), Key, Length);
+
+        if (Node->prefixLength > 0)
+        {
+            if (_RDX_CheckPrefix(Node, Key, Length, Depth) != ((Node->prefixLength < RDX_PREFIXSIZE) ? (Node->prefixLength) : (RDX_PREFIXSIZE)))
+                return false;
+
+            Depth += Node->prefixLength;
+        }
+
+        if (Depth >= Length)
+            return false;
+
+        RDX_Node **Child = _RDX_FindChild(Node, (uint8_t)Key[Depth++]);
+        Node = ((Child != NULL) ? (*Child) : (NULL));
+    }
+
+    return false;
+}
+
+void *RDX_LongestPrefix(RDX_Tree *Tree, const char *Key, const char **Match)
+{
+    size_t KeyLength = strlen(Key);
+    size_t Depth = 0;
+    RDX_Node *Node = Tree->root;
+    RDX_Leaf *Best = NULL;
+
+    // Go down the path of the key, every key ending on the way is stored as the child for the NULL terminator
+    while (Node != NULL)
+    {
+        if (_RDX_ISLEAF(Node))
+        {
+            RDX_Leaf *Leaf = _RDX_GETLEAF(Node);
+
+            if (Leaf->length - 1 <= KeyLength && memcmp(Leaf->key, Key, Leaf->length - 1) == 0)
+                Best = Leaf;
+
+            break;
+        }
+
+        if (Node->prefixLength > 0)
+        {
+            if (_RDX_CheckPrefix(Node, Key, KeyLength, Depth) != ((Node->prefixLength < RDX_PREFIXSIZE) ? (Node->prefixLength) : (RDX_PREFIXSIZE)))
+                break;
+
+            Depth += Node->prefixLength;
+        }
+
+        if (Depth > KeyLength)
+            break;
+
+        // Check if a key ends here, it has to be checked since only part of the prefixes have been compared
+        RDX_Node **End = _RDX_FindChild(Node, 0);
+
+        if (End != NULL && _RDX_ISLEAF(*End))
+        {
+            RDX_Leaf *Leaf = _RDX_GETLEAF(*End);
+
+            if (Leaf->length - 1 <= KeyLength && memcmp(Leaf->key, Key, Leaf->length - 1) == 0)
+                Best = Leaf;
+        }
+
+        if (Depth == KeyLength)
+            break;
+
+        RDX_Node **Child = _RDX_FindChild(Node, (uint8_t)Key[Depth++]);
+        Node = ((Child != NULL) ? (*Child) : (NULL));
+    }
+
+    if (Match != NULL)
+        *Match = ((Best != NULL) ? (Best->key) : (NULL));
+
+    if (Best == NULL)
+    {
+        _RDX_SetError(_RDX_ERRORID_LONGESTPREFIX_NOITEM, _RDX_ERRORMES_NOITEM);
+        return NULL;
+    }
+
+    return Best->value;
+}
+
+size_t RDX_TreeLength(RDX_Tree *Tree)
+{
+    return Tree->count;
+}
+
+RDX_Iterator RDX_IteratePrefix(RDX_Tree *Tree, const char *Prefix)
+{
+    RDX_Iterator Iterator;
+    RDX_InitIterator(&Iterator);
+
+    size_t Length = strlen(Prefix);
+    size_t Depth = 0;
+    RDX_Node *Node = Tree->root;
+
+    // Find the root of the subtree holding all keys starting with the prefix
+    while (Node != NULL && !_RDX_ISLEAF(Node) && Depth + Node->prefixLength < Length)
+    {
+        if (_RDX_CheckPrefix(Node, Prefix, Length, Depth) != ((Node->prefixLength < RDX_PREFIXSIZE) ? (Node->prefixLength) : (RDX_PREFIXSIZE)))
+            return Iterator;
+
+        Depth += Node->prefixLength;
+
+        RDX_Node **Child = _RDX_FindChild(Node, (uint8_t)Prefix[Depth++]);
+        Node = ((Child != NULL) ? (*Child) : (NULL));
+    }
+
+    // All keys in the subtree share the same start, so checking one of them checks the parts of the prefixes which were skipped
+    if (Node == NULL)
+        return Iterator;
+
+    RDX_Leaf *Leaf = _RDX_Minimum(Node);
+
+    if (Leaf->length - 1 < Length || memcmp(Leaf->key, Prefix, Length) != 0)
+        return Iterator;
+
+    Iterator.start = Node;
+
+    return Iterator;
+}
+
+bool RDX_Next(RDX_Iterator *Iterator)
+{
+    // Start the subtree
+    if (Iterator->start != NULL)
+    {
+        RDX_Node *Start = Iterator->start;
+        Iterator->start = NULL;
+
+        if (_RDX_ISLEAF(Start))
+        {
+            Iterator->key = _RDX_GETLEAF(Start)->key;
+            Iterator->value = _RDX_GETLEAF(Start)->value;
+            return true;
+        }
+
+        Iterator->stackLength = 16;
+        Iterator->stack = (RDX_IteratorFrame *)malloc(sizeof(RDX_IteratorFrame) * Iterator->stackLength);
+
+        if (Iterator->stack == NULL)
+        {
+            _RDX_AddErrorForeign(_RDX_ERRORID_NEXT_REALLOC, strerror(errno), _RDX_ERRORMES_MALLOC, sizeof(RDX_IteratorFrame) * Iterator->stackLength);
+            return false;
+        }
+
+        Iterator->stack->node = Start;
+        Iterator->stack->pos = 0;
+        Iterator->stackCount = 1;
+    }
+
+    while (Iterator->stackCount > 0)
+    {
+        RDX_IteratorFrame *Frame = Iterator->stack + Iterator->stackCount - 1;
+        RDX_Node *Child = _RDX_NextChild(Frame->node, &Frame->pos);
+
+        // Go back up when the node is done
+        if (Child == NULL)
+        {
+            --Iterator->stackCount;
+            continue;
+        }
+
+        if (_RDX_ISLEAF(Child))
+        {
+            Iterator->key = _RDX_GETLEAF(Child)->key;
+            Iterator->value = _RDX_GETLEAF(Child)->value;
+            return true;
+        }
+
+        // Go down into the child
+        if (Iterator->stackCount == Iterator->stackLength)
+        {
+            RDX_IteratorFrame *NewStack = (RDX_IteratorFrame *)realloc(Iterator->stack, sizeof(RDX_IteratorFrame) * Iterator->stackLength * 2);
+
+            if (NewStack == NULL)
+            {
+                _RDX_AddErrorForeign(_RDX_ERRORID_NEXT_REALLOC, strerror(errno), _RDX_ERRORMES_REALLOC, sizeof(RDX_IteratorFrame) * Iterator->stackLength * 2);
+                RDX_StopIterator(Iterator);
+                return false;
+            }
+
+            Iterator->stack = NewStack;
+            Iterator->stackLength *= 2;
+        }
+
+        Iterator->stack[Iterator->stackCount].node = Child;
+        Iterator->stack[Iterator->stackCount].pos = 0;
+        ++Iterator->stackCount;
+    }
+
+    RDX_StopIterator(Iterator);
+
+    return false;
+}
+
+void RDX_StopIterator(RDX_Iterator *Iterator)
+{
+    if (Iterator->stack != NULL)
+        free(Iterator->stack);
+
+    RDX_InitIterator(Iterator);
+}
+
+RDX_Node **_RDX_FindChild(RDX_Node *Node, uint8_t Byte)
+{
+    switch (Node->type)
+    {
+        case (RDX_NODETYPE_4):
+        {
+            RDX_Node4 *Node4 = (RDX_Node4 *)Node;
+
+            for (uint8_t *Keys = Node4->keys, *EndKeys = Node4->keys + Node->count; Keys < EndKeys; ++Keys)
+                if (*Keys == Byte)
+                    return Node4->children + (Keys - Node4->keys);
+
+            return NULL;
+        }
+
+        case (RDX_NODETYPE_16):
+        {
+            RDX_Node16 *Node16 = (RDX_Node16 *)Node;
+
+#ifdef __SSE2__
+            // Compare all keys at once
+            __m128i Compare = _mm_cmpeq_epi8(_mm_set1_epi8((char)Byte), _mm_loadu_si128((const __m128i *)Node16->keys));
+            uint32_t Mask = (uint32_t)_mm_movemask_epi8(Compare) & ((1U << Node->count) - 1);
+
+            if (Mask != 0)
+                return Node16->children + __builtin_ctz(Mask);
+#else
+            for (uint8_t *Keys = Node16->keys, *EndKeys = Node16->keys + Node->count; Keys < EndKeys; ++Keys)
+                if (*Keys == Byte)
+                    return Node16->children + (Keys - Node16->keys);
+#endif
+
+            return NULL;
+        }
+
+        case (RDX_NODETYPE_48):
+        {
+            RDX_Node48 *Node48 = (RDX_Node48 *)Node;
+
+            if (Node48->index[Byte] == 0)
+                return NULL;
+
+            return Node48->children + Node48->index[Byte] - 1;
+        }
+
+        default:
+        {
+            RDX_Node256 *Node256 = (RDX_Node256 *)Node;
+
+            if (Node256->children[Byte] == NULL)
+                return NULL;
+
+            return Node256->children + Byte;
+        }
+    }
+}
+
+RDX_Node *_RDX_NextChild(RDX_Node *Node, uint16_t *Pos)
+{
+    switch (Node->type)
+    {
+        case (RDX_NODETYPE_4):
+            if (*Pos >= Node->count)
+                return NULL;
+
+            return ((RDX_Node4 *)Node)->children[(*Pos)++];
+
+        case (RDX_NODETYPE_16):
+            if (*Pos >= Node->count)
+                return NULL;
+
+            return ((RDX_Node16 *)Node)->children[(*Pos)++];
+
+        case (RDX_NODETYPE_48):
+        {
+            RDX_Node48 *Node48 = (RDX_Node48 *)Node;
+
+            for (; *Pos < 256; ++*Pos)
+                if (Node48->index[*Pos] != 0)
+                    return Node48->children[Node48->index[(*Pos)++] - 1];
+
+            return NULL;
+        }
+
+        default:
+        {
+            RDX_Node256 *Node256 = (RDX_Node256 *)Node;
+
+            for (; *Pos < 256; ++*Pos)
+                if (Node256->children[*Pos] != NULL)
+                    return Node256->children[(*Pos)++];
+
+            return NULL;
+        }
+    }
+}
+
+RDX_Leaf *_RDX_Minimum(RDX_Node *Node)
+{
+    while (!_RDX_ISLEAF(Node))
+    {
+        uint16_t Pos = 0;
+        Node = _RDX_NextChild(Node, &Pos);
+    }
+
+    return _RDX_GETLEAF(Node);
+}
+
+static inline bool _RDX_LeafMatches(const RDX_Leaf *Leaf, const char *Key, size_t Length)
+{
+    return Leaf->length == Length && memcmp(Leaf->key, Key, Length) == 0;
+}
+
+size_t _RDX_CheckPrefix(const RDX_Node *Node, const char *Key, size_t Length, size_t Depth)
+{
+    size_t Max = ((Node->prefixLength < RDX_PREFIXSIZE) ? (Node->prefixLength) : (RDX_PREFIXSIZE));
+
+    if (Depth >= Length)
+        return 0;
+
+    if (Length - Depth < Max)
+        Max = Length - Depth;
+
+    for (size_t Pos = 0; Pos < Max; ++Pos)
+        if (Node->prefix[Pos] != (uint8_t)Key[Depth + Pos])
+            return Pos;
+
+    return Max;
+}
+
+size_t _RDX_PrefixMismatch(RDX_Node *Node, const char *Key, size_t Length, size_t Depth)
+{
+    size_t Max = ((Node->prefixLength < RDX_PREFIXSIZE) ? (Node->prefixLength) : (RDX_PREFIXSIZE));
+
+    if (Length - Depth < Max)
+        Max = Length - Depth;
+
+    size_t Pos = 0;
+
+    for (; Pos < Max; ++Pos)
+        if (Node->prefix[Pos] != (uint8_t)Key[Depth + Pos])
+            return Pos;
+
+    // Compare the rest with a leaf
+    if (Node->prefixLength > RDX_PREFIXSIZE)
+    {
+        RDX_Leaf *Leaf = _RDX_Minimum(Node);
+        Max = ((Leaf->length < Length) ? (Leaf->length) : (Length)) - Depth;
+
+        if (Max > Node->prefixLength)
+            Max = Node->prefixLength;
+
+        for (; Pos < Max; ++Pos)
+            if (Leaf->key[Depth + Pos] != Key[Depth + Pos])
+                return Pos;
+    }
+
+    return Pos;
+}
+
+RDX_Node *_RDX_CreateNode(RDX_NodeType Type)
+{
+    static const size_t Sizes[] = {sizeof(RDX_Node4), sizeof(RDX_Node16), sizeof(RDX_Node48), sizeof(RDX_Node256)};
+
+    RDX_Node *Node = (RDX_Node *)malloc(Sizes[Type]);
+
+    if (Node == NULL)
+        return NULL;
+
+    // Only the index of node48 and the children of node256 have to be cleared, the rest are only read up to count
+    if (Type == RDX_NODETYPE_48)
+    {
+        memset(((RDX_Node48 *)Node)->index, 0, sizeof(((RDX_Node48 *)Node)->index));
+        memset(((RDX_Node48 *)Node)->children, 0, sizeof(((RDX_Node48 *)Node)->children));
+    }
+
+    else if (Type == RDX_NODETYPE_256)
+        memset(((RDX_Node256 *)Node)->children, 0, sizeof(((RDX_Node256 *)Node)->children));
+
+    Node->type = Type;
+    Node->count = 0;
+    Node->prefixLength = 0;
+
+    return Node;
+}
+
+static inline void _RDX_CopyHeader(RDX_Node *Dst, const RDX_Node *Src)
+{
+    Dst->count = Src->count;
+    Dst->prefixLength = Src->prefixLength;
+    memcpy(Dst->prefix, Src->prefix, ((Src->prefixLength < RDX_PREFIXSIZE) ? (Src->prefixLength) : (RDX_PREFIXSIZE)));
+}
+
+bool _RDX_AddChild(RDX_Node *Node, RDX_Node **Ref, uint8_t Byte, RDX_Node *Child)
+{
+    switch (Node->type)
+    {
+        case (RDX_NODETYPE_4):
+        case (RDX_NODETYPE_16):
+        {
+            size_t Size = ((Node->type == RDX_NODETYPE_4) ? (4) : (16));
+            uint8_t *Keys = ((Node->type == RDX_NODETYPE_4) ? (((RDX_Node4 *)Node)->keys) : (((RDX_Node16 *)Node)->keys));
+            RDX_Node **Children = ((Node->type == RDX_NODETYPE_4) ? (((RDX_Node4 *)Node)->children) : (((RDX_Node16 *)Node)->children));
+
+            // Insert it sorted if there is room
+            if (Node->count < Size)
+            {
+                size_t Pos = 0;
+
+                for (; Pos < Node->count && Keys[Pos] < Byte; ++Pos)
+                    ;
+
+                memmove(Keys + Pos + 1, Keys + Pos, sizeof(uint8_t) * (Node->count - Pos));
+                memmove(Children + Pos + 1, Children + Pos, sizeof(RDX_Node *) * (Node->count - Pos));
+                Keys[Pos] = Byte;
+                Children[Pos] = Child;
+                ++Node->count;
+
+                return true;
+            }
+
+            // Grow into a node16 from a node4
+            if (Node->type == RDX_NODETYPE_4)
+            {
+                RDX_Node16 *NewNode = (RDX_Node16 *)_RDX_CreateNode(RDX_NODETYPE_16);
+
+                if (NewNode == NULL)
+                    return false;
+
+                _RDX_CopyHeader(&NewNode->node, Node);
+                memcpy(NewNode->keys, Keys, sizeof(uint8_t) * Node->count);
+                memcpy(NewNode->children, Children, sizeof(RDX_Node *) * Node->count);
+                *Ref = &NewNode->node;
+                free(Node);
+
+                return _RDX_AddChild(&NewNode->node, Ref, Byte, Child);
+            }
+
+            // Grow into a node48 from a node16
+            RDX_Node48 *NewNode = (RDX_Node48 *)_RDX_CreateNode(RDX_NODETYPE_48);
+
+            if (NewNode == NULL)
+                return false;
+
+            _RDX_CopyHeader(&NewNode->node, Node);
+            memcpy(NewNode->children, Children, sizeof(RDX_Node *) * Node->count);
+
+            for (size_t Pos = 0; Pos < Node->count; ++Pos)
+                NewNode->index[Keys[Pos]] = Pos + 1;
+
+            *Ref = &NewNode->node;
+            free(Node);
+
+            return _RDX_AddChild(&NewNode->node, Ref, Byte, Child);
+        }
+
+        case (RDX_NODETYPE_48):
+        {
+            RDX_Node48 *Node48 = (RDX_Node48 *)Node;
+
+            // Use the first free slot
+            if (Node->count < 48)
+            {
+                size_t Pos = 0;
+
+                for (; Node48->children[Pos] != NULL; ++Pos)
+                    ;
+
+                Node48->children[Pos] = Child;
+                Node48->index[Byte] = Pos + 1;
+                ++Node->count;
+
+                return true;
+            }
+
+            // Grow into a node256
+            RDX_Node256 *NewNode = (RDX_Node256 *)_RDX_CreateNode(RDX_NODETYPE_256);
+
+            if (NewNode == NULL)
+                return false;
+
+            _RDX_CopyHeader(&NewNode->node, Node);
+
+            for (size_t Pos = 0; Pos < 256; ++Pos)
+                if (Node48->index[Pos] != 0)
+                    NewNode->children[Pos] = Node48->children[Node48->index[Pos] - 1];
+
+            *Ref = &NewNode->node;
+            free(Node);
+
+            return _RDX_AddChild(&NewNode->node, Ref, Byte, Child);
+        }
+
+        default:
+            ((RDX_Node256 *)Node)->children[Byte] = Child;
+            ++Node->count;
+
+            return true;
+    }
+}
+
+bool _RDX_Insert(RDX_Node **Ref, const char *Key, size_t Length, size_t Depth, RDX_Leaf *Leaf, bool *Replaced)
+{
+    RDX_Node *Node = *Ref;
+
+    // Empty spot
+    if (Node == NULL)
+    {
+        *Ref = _RDX_SETLEAF(Leaf);
+        return true;
+    }
+
+    // Split a leaf
+    if (_RDX_ISLEAF(Node))
+    {
+        RDX_Leaf *OldLeaf = _RDX_GETLEAF(Node);
+
+        if (_RDX_LeafMatches(OldLeaf, Key, Length))
+        {
+            OldLeaf->value = Leaf->value;
+            *Replaced = true;
+            return true;
+        }
+
+        RDX_Node4 *NewNode = (RDX_Node4 *)_RDX_CreateNode(RDX_NODETYPE_4);
+
+        if (NewNode == NULL)
+            return false;
+
+        // The keys are different and neither is a prefix of the other because of the NULL terminator
+        size_t Common = 0;
+
+        for (; OldLeaf->key[Depth + Common] == Key[Depth + Common]; ++Common)
+            ;
+
+        NewNode->node.prefixLength = Common;
+        memcpy(NewNode->node.prefix, Key + Depth, ((Common < RDX_PREFIXSIZE) ? (Common) : (RDX_PREFIXSIZE)));
+        *Ref = &NewNode->node;
+        _RDX_AddChild(&NewNode->node, Ref, (uint8_t)OldLeaf->key[Depth + Common], Node);
+        _RDX_AddChild(&NewNode->node, Ref, (uint8_t)Key[Depth + Common], _RDX_SETLEAF(Leaf));
+
+        return true;
+    }
+
+    // Split the prefix if the key leaves it
+    if (Node->prefixLength > 0)
+    {
+        size_t Mismatch = _RDX_PrefixMismatch(Node, Key, Length, Depth);
+
+        if (Mismatch < Node->prefixLength)
+        {
+            RDX_Node4 *NewNode = (RDX_Node4 *)_RDX_CreateNode(RDX_NODETYPE_4);
+
+            if (NewNode == NULL)
+                return false;
+
+            NewNode->node.prefixLength = Mismatch;
+            memcpy(NewNode->node.prefix, Node->prefix, ((Mismatch < RDX_PREFIXSIZE) ? (Mismatch) : (RDX_PREFIXSIZE)));
+            *Ref = &NewNode->node;
+
+            // Shorten the prefix of the old node, the bytes are taken from a leaf if they are not stored
+            uint8_t Byte;
+
+            if (Node->prefixLength <= RDX_PREFIXSIZE)
+            {
+                Byte = Node->prefix[Mismatch];
+                Node->prefixLength -= Mismatch + 1;
+                memmove(Node->prefix, Node->prefix + Mismatch + 1, ((Node->prefixLength < RDX_PREFIXSIZE) ? (Node->prefixLength) : (RDX_PREFIXSIZE)));
+            }
+
+            else
+            {
+                RDX_Leaf *MinLeaf = _RDX_Minimum(Node);
+                Byte = (uint8_t)MinLeaf->key[Depth + Mismatch];
+                Node->prefixLength -= Mismatch + 1;
+                memcpy(Node->prefix, MinLeaf->key + Depth + Mismatch + 1, ((Node->prefixLength < RDX_PREFIXSIZE) ? (Node->prefixLength) : (RDX_PREFIXSIZE)));
+            }
+
+            _RDX_AddChild(&NewNode->node, Ref, Byte, Node);
+            _RDX_AddChild(&NewNode->node, Ref, (uint8_t)Key[Depth + Mismatch], _RDX_SETLEAF(Leaf));
+
+            return true;
+        }
+
+        Depth += Node->prefixLength;
+    }
+
+    // Go to the child or add a new one
+    RDX_Node **Child = _RDX_FindChild(Node, (uint8_t)Key[Depth]);
+
+    if (Child != NULL)
+        return _RDX_Insert(Child, Key, Length, Depth + 1, Leaf, Replaced);
+
+    return _RDX_AddChild(Node, Ref, (uint8_t)Key[Depth], _RDX_SETLEAF(Leaf));
+}
+
+void _RDX_RemoveChild(RDX_Node *Node, RDX_Node **Ref, uint8_t Byte, RDX_Node **Child)
+{
+    switch (Node->type)
+    {
+        case (RDX_NODETYPE_4):
+        case (RDX_NODETYPE_16):
+        {
+            uint8_t *Keys = ((Node->type == RDX_NODETYPE_4) ? (((RDX_Node4 *)Node)->keys) : (((RDX_Node16 *)Node)->keys));
+            RDX_Node **Children = ((Node->type == RDX_NODETYPE_4) ? (((RDX_Node4 *)Node)->children) : (((RDX_Node16 *)Node)->children));
+            size_t Pos = Child - Children;
+
+            memmove(Keys + Pos, Keys + Pos + 1, sizeof(uint8_t) * (Node->count - Pos - 1));
+            memmove(Children + Pos, Children + Pos + 1, sizeof(RDX_Node *) * (Node->count - Pos - 1));
+            --Node->count;
+
+            // Shrink a node16 into a node4
+            if (Node->type == RDX_NODETYPE_16)
+            {
+                if (Node->count > 3)
+                    return;
+
+                RDX_Node4 *NewNode = (RDX_Node4 *)_RDX_CreateNode(RDX_NODETYPE_4);
+
+                // It is fine to keep the large node if there is no memory
+                if (NewNode == NULL)
+                    return;
+
+                _RDX_CopyHeader(&NewNode->node, Node);
+                memcpy(NewNode->keys, Keys, sizeof(uint8_t) * Node->count);
+                memcpy(NewNode->children, Children, sizeof(RDX_Node *) * Node->count);
+                *Ref = &NewNode->node;
+                free(Node);
+
+                return;
+            }
+
+            // Merge a node4 with one child into the child
+            if (Node->count > 1)
+                return;
+
+            RDX_Node *Last = Children[0];
+
+            if (!_RDX_ISLEAF(Last))
+            {
+                // The new prefix is the prefix of the node, the byte of the child and the prefix of the child
+                size_t Prefix = Node->prefixLength;
+
+                if (Prefix < RDX_PREFIXSIZE)
+                    Node->prefix[Prefix++] = Keys[0];
+
+                if (Prefix < RDX_PREFIXSIZE)
+                {
+                    size_t SubPrefix = ((Last->prefixLength < RDX_PREFIXSIZE - Prefix) ? (Last->prefixLength) : (RDX_PREFIXSIZE - Prefix));
+                    memcpy(Node->prefix + Prefix, Last->prefix, SubPrefix);
+                    Prefix += SubPrefix;
+                }
+
+                memcpy(Last->prefix, Node->prefix, ((Prefix < RDX_PREFIXSIZE) ? (Prefix) : (RDX_PREFIXSIZE)));
+                Last->prefixLength += Node->prefixLength + 1;
+            }
+
+            *Ref = Last;
+            free(Node);
+
+            return;
+        }
+
+        case (RDX_NODETYPE_48):
+        {
+            RDX_Node48 *Node48 = (RDX_Node48 *)Node;
+
+            Node48->children[Node48->index[Byte] - 1] = NULL;
+            Node48->index[Byte] = 0;
+            --Node->count;
+
+            // Shrink into a node16
+            if (Node->count > 12)
+                return;
+
+            RDX_Node16 *NewNode = (RDX_Node16 *)_RDX_CreateNode(RDX_NODETYPE_16);
+
+            if (NewNode == NULL)
+                return;
+
+            _RDX_CopyHeader(&NewNode->node, Node);
+
+            for (size_t Pos = 0, NewPos = 0; Pos < 256; ++Pos)
+                if (Node48->index[Pos] != 0)
+                {
+                    NewNode->keys[NewPos] = Pos;
+                    NewNode->children[NewPos++] = Node48->children[Node48->index[Pos] - 1];
+                }
+
+            *Ref = &NewNode->node;
+            free(Node);
+
+            return;
+        }
+
+        default:
+        {
+            RDX_Node256 *Node256 = (RDX_Node256 *)Node;
+
+            Node256->children[Byte] = NULL;
+            --Node->count;
+
+            // Shrink into a node48
+            if (Node->count > 37)
+                return;
+
+            RDX_Node48 *NewNode = (RDX_Node48 *)_RDX_CreateNode(RDX_NODETYPE_48);
+
+            if (NewNode == NULL)
+                return;
+
+            _RDX_CopyHeader(&NewNode->node, Node);
+
+            for (size_t Pos = 0, NewPos = 0; Pos < 256; ++Pos)
+                if (Node256->children[Pos] != NULL)
+                {
+                    NewNode->children[NewPos] = Node256->children[Pos];
+                    NewNode->index[Pos] = ++NewPos;
+                }
+
+            *Ref = &NewNode->node;
+            free(Node);
+
+            return;
+        }
+    }
+}
+
+RDX_Leaf *_RDX_Remove(RDX_Node **Ref, const char *Key, size_t Length, size_t Depth)
+{
+    RDX_Node *Node = *Ref;
+
+    if (Node == NULL)
+        return NULL;
+
+    // The root is a leaf
+    if (_RDX_ISLEAF(Node))
+    {
+        if (!_RDX_LeafMatches(_RDX_GETLEAF(Node), Key, Length))
+            return NULL;
+
+        *Ref = NULL;
+        return _RDX_GETLEAF(Node);
+    }
+
+    if (Node->prefixLength > 0)
+    {
+        if (_RDX_CheckPrefix(Node, Key, Length, Depth) != ((Node->prefixLength < RDX_PREFIXSIZE) ? (Node->prefixLength) : (RDX_PREFIXSIZE)))
+            return NULL;
+
+        Depth += Node->prefixLength;
+    }
+
+    if (Depth >= Length)
+        return NULL;
+
+    RDX_Node **Child = _RDX_FindChild(Node, (uint8_t)Key[Depth]);
+
+    if (Child == NULL)
+        return NULL;
+
+    // Remove the leaf from this node
+    if (_RDX_ISLEAF(*Child))
+    {
+        RDX_Leaf *Leaf = _RDX_GETLEAF(*Child);
+
+        if (!_RDX_LeafMatches(Leaf, Key, Length))
+            return NULL;
+
+        _RDX_RemoveChild(Node, Ref, (uint8_t)Key[Depth], Child);
+
+        return Leaf;
+    }
+
+    return _RDX_Remove(Child, Key, Length, Depth + 1);
+}
+
+void RDX_InitTree(RDX_Tree *Struct)
+{
+    Struct->root = NULL;
+    Struct->count = 0;
+}
+
+void RDX_InitIterator(RDX_Iterator *Struct)
+{
+    Struct->start = NULL;
+    Struct->stack = NULL;
+    Struct->stackCount = 0;
+    Struct->stackLength = 0;
+    Struct->key = NULL;
+    Struct->value = NULL;
+}
+
+void RDX_DestroyTree(RDX_Tree *Tree)
+{
+    if (Tree->root != NULL)
+        _RDX_DestroyNode(Tree->root);
+
+    free(Tree);
+}
+
+void _RDX_DestroyNode(RDX_Node *Node)
+{
+    if (_RDX_ISLEAF(Node))
+    {
+        free(_RDX_GETLEAF(Node));
+        return;
+    }
+
+    uint16_t Pos = 0;
+
+    for (RDX_Node *Child = _RDX_NextChild(Node, &Pos); Child != NULL; Child = _RDX_NextChild(Node, &Pos))
+        _RDX_DestroyNode(Child);
+
+    free(Node);
+}
+
+#endif
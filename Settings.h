@@ -2,14 +2,29 @@
 #define SETTINGS_H_DEFINED
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <stdint.h>
 #include <string.h>
 #include <stdbool.h>
 #include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/inotify.h>
+#include <poll.h>
+#include <libgen.h>
+#include <pthread.h>
+#include <stdatomic.h>
 #include <Dictionary.h>
 #include <math.h>
+#include <locale.h>
 #include <Files.h>
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 #define ERR_PREFIX SET
 #include <Error.h>
 
@@ -40,10 +55,10 @@ enum _SET_ErrorID {
     _SET_ERRORID_CONVERTVALUE_LISTMATCH = 0x300050203,
     _SET_ERRORID_CONVERTVALUE_TYPEMATCH = 0x300050204,
     _SET_ERRORID_CONVERTVALUE_LISTMATCH2 = 0x300050205,
-    _SET_ERRORID_CONVERTVALUE_NUMBERMATCH = 0x300050206,
-    _SET_ERRORID_CONVERTVALUE_TYPE = 0x300050207,
+    _SET_ERRORID_CONVERTVALUE_NUMBERMATCH = 0x300050206, // Deprecated, _SET_ConvertValue reports _SET_ERRORID_CONVERTVALUE_TYPEMATCH
+    _SET_ERRORID_CONVERTVALUE_TYPE = 0x300050207, // Deprecated, _SET_ConvertValue reports _SET_ERRORID_CONVERTVALUE_TYPEMATCH
     _SET_ERRORID_CONVERTVALUE_NOVALUE = 0x300050208,
-    _SET_ERRORID_CONVERTVALUE_NOPOSSIBLEVALUE = 0x300050209,
+    _SET_ERRORID_CONVERTVALUE_NOPOSSIBLEVALUE = 0x300050209, // Deprecated, _SET_ConvertValue reports _SET_ERRORID_CONVERTVALUE_CONVERT
     _SET_ERRORID_CONVERTVALUE_CONVERT = 0x30005020A,
     _SET_ERRORID_READTYPE_DICT = 0x300060200,
     _SET_ERRORID_READTYPE_WRONGTYPE = 0x300060201,
@@ -76,15 +91,18 @@ enum _SET_ErrorID {
     _SET_ERRORID_CONVERTSTRUCT_VALUE = 0x3000B0202,
     _SET_ERRORID_CONVERTSTRUCT_ADDITEM = 0x3000B0203,
     _SET_ERRORID_CONVERTSTRUCT_DUBLICATE = 0x3000B0204,
+    _SET_ERRORID_CONVERTSTRUCT_BLOOM = 0x3000B0205,
+    _SET_ERRORID_CONVERTSTRUCT_INTERN = 0x3000B0206,
     _SET_ERRORID_CONVERTLIST_MALLOC = 0x3000C0200,
     _SET_ERRORID_CONVERTLIST_MALLOCLIST = 0x300C0201,
     _SET_ERRORID_CONVERTLIST_VALUE = 0x3000C0202,
-    _SET_ERRORID_CONVERTLIST_TYPE = 0x3000C0203,
-    _SET_ERRORID_CONVERTLIST_LISTELEMENT = 0x3000C0204,
+    _SET_ERRORID_CONVERTLIST_TYPE = 0x3000C0203, // Deprecated, _SET_ConvertList reports _SET_ERRORID_CONVERTLIST_FINISH
+    _SET_ERRORID_CONVERTLIST_LISTELEMENT = 0x3000C0204, // Deprecated, _SET_FinishList reports _SET_ERRORID_FINISHLIST_LISTELEMENT
     _SET_ERRORID_CONVERTLIST_NOELEMENTS = 0x3000C0205,
-    _SET_ERRORID_CONVERTLIST_LISTELEMENT2 = 0x3000C0206,
-    _SET_ERRORID_CONVERTLIST_TYPEELEMENT = 0x3000C0207,
-    _SET_ERRORID_CONVERTLIST_NUMBERELEMENT = 0x3000C0208,
+    _SET_ERRORID_CONVERTLIST_LISTELEMENT2 = 0x3000C0206, // Deprecated, _SET_FinishList reports _SET_ERRORID_FINISHLIST_LISTELEMENT2
+    _SET_ERRORID_CONVERTLIST_TYPEELEMENT = 0x3000C0207, // Deprecated, _SET_MergeType reports _SET_ERRORID_MERGETYPE_TYPEELEMENT
+    _SET_ERRORID_CONVERTLIST_NUMBERELEMENT = 0x3000C0208, // Deprecated, _SET_MergeType reports _SET_ERRORID_MERGETYPE_NUMBERELEMENT
+    _SET_ERRORID_CONVERTLIST_FINISH = 0x3000C0209,
     _SET_ERRORID_CONVERTTYPE_NOSTRUCT = 0x3000D0200,
     _SET_ERRORID_CONVERTTYPE_TYPEMATCH = 0x3000D0201,
     _SET_ERRORID_CONVERTTYPE_TYPEMATCH2 = 0x3000D0202,
@@ -113,9 +131,10 @@ enum _SET_ErrorID {
     _SET_ERRORID_LOADSETTINGS_LOAD = 0x300180200,
     _SET_ERRORID_LOADSETTINGS_CLEAN = 0x300180201,
     _SET_ERRORID_LOADSETTINGS_SPLIT = 0x300180202,
-    _SET_ERRORID_LOADSETTINGS_CREATEDICT = 0x300180203,
-    _SET_ERRORID_LOADSETTINGS_LOADDICT = 0x300180204,
+    _SET_ERRORID_LOADSETTINGS_CREATEDICT = 0x300180203, // Deprecated, the dict is created while parsing
+    _SET_ERRORID_LOADSETTINGS_LOADDICT = 0x300180204, // Deprecated, the dict is filled while parsing
     _SET_ERRORID_LOADSETTINGS_CONVERT = 0x300180205,
+    _SET_ERRORID_LOADSETTINGS_PARSE = 0x300180206,
     _SET_ERRORID_TRANSLATE_FILL = 0x300190200,
     _SET_ERRORID_TRANSLATE_GETITEM = 0x300190201,
     _SET_ERRORID_TRANSLATE_EMPTY = 0x300190202,
@@ -124,6 +143,7 @@ enum _SET_ErrorID {
     _SET_ERRORID_TRANSLATELIST_CONVERTLIST = 0x3001B0200,
     _SET_ERRORID_TRANSLATELIST_MALLOC1 = 0x3001B0201,
     _SET_ERRORID_TRANSLATELIST_UNKNOWNTYPE = 0x3001B0202,
+    _SET_ERRORID_TRANSLATELIST_CONVERTPACKED = 0x3001B0203,
     _SET_ERRORID_TRANSLATEELEMENT_LISTMATCH = 0x3001C0200,
     _SET_ERRORID_TRANSLATEELEMENT_LIST = 0x3001C0201,
     _SET_ERRORID_TRANSLATEELEMENT_STRUCTMATCH = 0x3001C0202,
@@ -133,7 +153,261 @@ enum _SET_ErrorID {
     _SET_ERRORID_TRANSLATEELEMENT_STRINGMALLOC = 0x3001C0206,
     _SET_ERRORID_TRANSLATEELEMENT_CONVERTVALUE = 0x3001C0207,
     _SET_ERRORID_TRANSLATEELEMENT_UNKNOWNTYPE = 0x3001C0208,
-    _SET_ERRORID_CONVERTBOOL_CORRECT = 0x3001D0200
+    _SET_ERRORID_CONVERTBOOL_CORRECT = 0x3001D0200,
+    _SET_ERRORID_PARSESTRUCT_MALLOC = 0x3001E0200,
+    _SET_ERRORID_PARSESTRUCT_FIELDS = 0x3001E0210,
+    _SET_ERRORID_PARSESTRUCT_CREATE = 0x3001E0211,
+    _SET_ERRORID_PARSEVALUE_MALLOC = 0x3001F0200,
+    _SET_ERRORID_PARSEVALUE_LISTMATCH = 0x3001F0201,
+    _SET_ERRORID_PARSEVALUE_LIST = 0x3001F0202,
+    _SET_ERRORID_PARSEVALUE_STRUCT = 0x3001F0203,
+    _SET_ERRORID_PARSEVALUE_CONVERT = 0x3001F0207,
+    _SET_ERRORID_PARSEVALUE_LISTMATCH2 = 0x3001F0208,
+    _SET_ERRORID_PARSEVALUE_TYPEMATCH = 0x3001F0209,
+    _SET_ERRORID_PARSELIST_MALLOC = 0x300200200,
+    _SET_ERRORID_PARSELIST_NOELEMENTS = 0x300200201,
+    _SET_ERRORID_PARSELIST_REALLOC = 0x300200202,
+    _SET_ERRORID_PARSELIST_VALUE = 0x300200203,
+    _SET_ERRORID_PARSELIST_ENDLIST = 0x300200204,
+    _SET_ERRORID_PARSELIST_UNEXPECTED = 0x300200205,
+    _SET_ERRORID_PARSELIST_FINISH = 0x300200206,
+    _SET_ERRORID_PARSELIST_SCALAR = 0x300200207,
+    _SET_ERRORID_CONVERTSCALAR_NOPOSSIBLEVALUE = 0x300210200,
+    _SET_ERRORID_CONVERTSCALAR_CONVERT = 0x300210201,
+    _SET_ERRORID_MATCHTYPE_TYPEMATCH = 0x300220200,
+    _SET_ERRORID_MATCHTYPE_NUMBERMATCH = 0x300220201,
+    _SET_ERRORID_MATCHTYPE_TYPE = 0x300220202,
+    _SET_ERRORID_FINISHLIST_LISTELEMENT = 0x300230201,
+    _SET_ERRORID_FINISHLIST_LISTELEMENT2 = 0x300230202,
+    _SET_ERRORID_FINISHLIST_MERGE = 0x300230205,
+    _SET_ERRORID_LOADSETTINGSARENA_LOAD = 0x300240200,
+    _SET_ERRORID_LOADSETTINGSARENA_MALLOC = 0x300240201,
+    _SET_ERRORID_LOADSETTINGSARENA_ARENA = 0x300240202,
+    _SET_ERRORID_LOADSETTINGSARENA_HASH = 0x300240203,
+    _SET_ERRORID_LOADSETTINGSARENA_PARSE = 0x300240204,
+    _SET_ERRORID_PARSETEXT_TYPEDICT = 0x300250200,
+    _SET_ERRORID_PARSETEXT_PARSE = 0x300250202,
+    _SET_ERRORID_COMPILESETTINGS_STAT = 0x300260200,
+    _SET_ERRORID_COMPILESETTINGS_LOAD = 0x300260201,
+    _SET_ERRORID_COMPILESETTINGS_PARSE = 0x300260202,
+    _SET_ERRORID_COMPILESETTINGS_NAME = 0x300260203,
+    _SET_ERRORID_COMPILESETTINGS_WRITE = 0x300260204,
+    _SET_ERRORID_WRITECACHE_HEADER = 0x300270200,
+    _SET_ERRORID_WRITECACHE_STRUCT = 0x300270201,
+    _SET_ERRORID_WRITECACHE_OPEN = 0x300270202,
+    _SET_ERRORID_WRITECACHE_WRITE = 0x300270203,
+    _SET_ERRORID_CACHERESERVE_REALLOC = 0x300280200,
+    _SET_ERRORID_CACHEWRITESTRUCT_RESERVE = 0x300290200,
+    _SET_ERRORID_CACHEWRITESTRUCT_NAME = 0x300290201,
+    _SET_ERRORID_CACHEWRITESTRUCT_VALUE = 0x300290202,
+    _SET_ERRORID_CACHEWRITEVALUE_RESERVE = 0x3002A0200,
+    _SET_ERRORID_CACHEWRITEVALUE_STRUCT = 0x3002A0201,
+    _SET_ERRORID_CACHEWRITEVALUE_LIST = 0x3002A0202,
+    _SET_ERRORID_CACHEWRITEVALUE_TYPE = 0x3002A0203,
+    _SET_ERRORID_CACHENAME_MALLOC = 0x3002B0200,
+    _SET_ERRORID_LOADCACHE_HASH = 0x3002C0200,
+    _SET_ERRORID_LOADCACHE_READ = 0x3002C0201,
+    _SET_ERRORID_LOADCACHE_ROOT = 0x3002C0202,
+    _SET_ERRORID_READCACHESTRUCT_CORRUPT = 0x3002D0200,
+    _SET_ERRORID_READCACHESTRUCT_CREATEDICT = 0x3002D0201,
+    _SET_ERRORID_READCACHESTRUCT_BLOOM = 0x3002D0202,
+    _SET_ERRORID_READCACHESTRUCT_INTERN = 0x3002D0203,
+    _SET_ERRORID_READCACHESTRUCT_MALLOC = 0x3002D0204,
+    _SET_ERRORID_READCACHESTRUCT_VALUE = 0x3002D0205,
+    _SET_ERRORID_READCACHESTRUCT_ADDITEM = 0x3002D0206,
+    _SET_ERRORID_READCACHEVALUE_CORRUPT = 0x3002E0200,
+    _SET_ERRORID_READCACHEVALUE_MALLOC = 0x3002E0201,
+    _SET_ERRORID_READCACHEVALUE_STRUCT = 0x3002E0202,
+    _SET_ERRORID_READCACHEVALUE_VALUE = 0x3002E0203,
+    _SET_ERRORID_READCACHEVALUE_TYPE = 0x3002E0204,
+    _SET_ERRORID_READCACHEVALUE_PACKED = 0x3002E0205,
+    _SET_ERRORID_CREATEWATCHER_MALLOC = 0x3002F0200,
+    _SET_ERRORID_CREATEWATCHER_INIT = 0x3002F0201,
+    _SET_ERRORID_CREATEWATCHER_WATCH = 0x3002F0202,
+    _SET_ERRORID_CREATEWATCHER_LOAD = 0x3002F0203,
+    _SET_ERRORID_UPDATEWATCHER_EVENTS = 0x300300200,
+    _SET_ERRORID_UPDATEWATCHER_RELOAD = 0x300300201,
+    _SET_ERRORID_READWATCHEREVENTS_POLL = 0x300310200,
+    _SET_ERRORID_READWATCHEREVENTS_READ = 0x300310201,
+    _SET_ERRORID_RELOADWATCHER_LOAD = 0x300320200,
+    _SET_ERRORID_RELOADWATCHER_SPLIT = 0x300320201,
+    _SET_ERRORID_RELOADWATCHER_MALLOC = 0x300320202,
+    _SET_ERRORID_RELOADWATCHER_CREATEDICT = 0x300320203,
+    _SET_ERRORID_RELOADWATCHER_DUBLICATE = 0x300320204,
+    _SET_ERRORID_RELOADWATCHER_ADDITEM = 0x300320205,
+    _SET_ERRORID_RELOADWATCHER_PARSE = 0x300320206,
+    _SET_ERRORID_RELOADWATCHER_BLOOM = 0x300320207,
+    _SET_ERRORID_RELOADWATCHER_INTERN = 0x300320208,
+    _SET_ERRORID_SPLITFIELDS_REALLOC = 0x300330200,
+    _SET_ERRORID_SPLITFIELDS_MALLOC = 0x300330201,
+    _SET_ERRORID_SPLITFIELDS_NOVALUE = 0x300330202,
+    _SET_ERRORID_SPLITFIELDS_SKIP = 0x300330205,
+    _SET_ERRORID_TRANSLATEDIFF_MALLOC = 0x300340200,
+    _SET_ERRORID_TRANSLATEDIFF_EMPTY = 0x300340201,
+    _SET_ERRORID_TRANSLATEDIFF_TRANSLATE = 0x300340202,
+    _SET_ERRORID_COMPILETRANSLATIONTABLE_MALLOC = 0x300350200,
+    _SET_ERRORID_COMPILETRANSLATIONTABLE_HASH = 0x300350201,
+    _SET_ERRORID_COMPILETRANSLATIONTABLE_COMPILE = 0x300350202,
+    _SET_ERRORID_COMPILETABLE_MALLOC = 0x300360200,
+    _SET_ERRORID_COMPILETABLE_DUBLICATE = 0x300360201,
+    _SET_ERRORID_COMPILETABLE_SUB = 0x300360202,
+    _SET_ERRORID_COMPILETABLE_INDEX = 0x300360203,
+    _SET_ERRORID_PARSENAME_END = 0x300370200,
+    _SET_ERRORID_PARSENAME_NOVALUE = 0x300370201,
+    _SET_ERRORID_PARSENAME_TYPETWICE = 0x300370202,
+    _SET_ERRORID_PARSENAME_UNEXPECTED = 0x300370203,
+    _SET_ERRORID_PARSENAME_TYPE = 0x300370204,
+    _SET_ERRORID_PARSESCALAR_ENDSTRING = 0x300380200,
+    _SET_ERRORID_PARSESCALAR_STOPCHAR = 0x300380201,
+    _SET_ERRORID_PARSESCALAR_NOVALUE = 0x300380202,
+    _SET_ERRORID_PARSESCALAR_CONVERT = 0x300380203,
+    _SET_ERRORID_LOADINTO_LOAD = 0x3003A0200,
+    _SET_ERRORID_LOADINTO_TYPEDICT = 0x3003A0201,
+    _SET_ERRORID_LOADINTO_STRUCT = 0x3003A0202,
+    _SET_ERRORID_LOADSTRUCT_MALLOC = 0x3003B0200,
+    _SET_ERRORID_LOADSTRUCT_ENDSTRUCT = 0x3003B0201,
+    _SET_ERRORID_LOADSTRUCT_UNEXPECTED = 0x3003B0202,
+    _SET_ERRORID_LOADSTRUCT_NAME = 0x3003B0203,
+    _SET_ERRORID_LOADSTRUCT_EMPTY = 0x3003B0204,
+    _SET_ERRORID_LOADSTRUCT_SKIP = 0x3003B0205,
+    _SET_ERRORID_LOADSTRUCT_DUBLICATE = 0x3003B0206,
+    _SET_ERRORID_LOADSTRUCT_DEPTH = 0x3003B0207,
+    _SET_ERRORID_LOADSTRUCT_VALUE = 0x3003B0208,
+    _SET_ERRORID_LOADSTRUCT_END = 0x3003B0209,
+    _SET_ERRORID_LOADSTRUCT_ENDVALUE = 0x3003B020A,
+    _SET_ERRORID_LOADSTRUCT_FILL = 0x3003B020B,
+    _SET_ERRORID_LOADSTRUCT_CREATEDICT = 0x3003B020C,
+    _SET_ERRORID_LOADSTRUCT_DUBLICATE2 = 0x3003B020D,
+    _SET_ERRORID_LOADSTRUCT_ADDITEM = 0x3003B020E,
+    _SET_ERRORID_LOADVALUE_LISTMATCH = 0x3003C0200,
+    _SET_ERRORID_LOADVALUE_LIST = 0x3003C0201,
+    _SET_ERRORID_LOADVALUE_LISTMATCH2 = 0x3003C0202,
+    _SET_ERRORID_LOADVALUE_STRUCTMATCH = 0x3003C0203,
+    _SET_ERRORID_LOADVALUE_NOSTRUCT = 0x3003C0204,
+    _SET_ERRORID_LOADVALUE_STRUCT = 0x3003C0205,
+    _SET_ERRORID_LOADVALUE_UNKNOWNTYPE = 0x3003C0206,
+    _SET_ERRORID_LOADVALUE_SCALAR = 0x3003C0207,
+    _SET_ERRORID_LOADVALUE_TYPEMATCH = 0x3003C0208,
+    _SET_ERRORID_LOADVALUE_STRINGMATCH = 0x3003C0209,
+    _SET_ERRORID_LOADVALUE_ALLOC = 0x3003C020A,
+    _SET_ERRORID_LOADVALUE_CONVERT = 0x3003C020B,
+    _SET_ERRORID_LOADLIST_UNKNOWNTYPE = 0x3003D0200,
+    _SET_ERRORID_LOADLIST_NOELEMENTS = 0x3003D0201,
+    _SET_ERRORID_LOADLIST_REALLOC = 0x3003D0202,
+    _SET_ERRORID_LOADLIST_VALUE = 0x3003D0203,
+    _SET_ERRORID_LOADLIST_ENDLIST = 0x3003D0204,
+    _SET_ERRORID_LOADLIST_UNEXPECTED = 0x3003D0205,
+    _SET_ERRORID_LOADLIST_ALLOC = 0x3003D0206,
+    _SET_ERRORID_LOADLIST_LISTELEMENT = 0x3003D0207,
+    _SET_ERRORID_LOADLIST_MERGE = 0x3003D0208,
+    _SET_ERRORID_ADDLOADALLOC_REALLOC = 0x3003E0200,
+    _SET_ERRORID_PARSESCALARLIST_REALLOC = 0x3003F0200,
+    _SET_ERRORID_PARSESCALARLIST_LISTELEMENT = 0x3003F0201,
+    _SET_ERRORID_PARSESCALARLIST_TYPEELEMENT = 0x3003F0202,
+    _SET_ERRORID_PARSESCALARLIST_VALUE = 0x3003F0203,
+    _SET_ERRORID_PARSESCALARLIST_LISTMATCH = 0x3003F0204,
+    _SET_ERRORID_PARSESCALARLIST_TYPEMATCH = 0x3003F0205,
+    _SET_ERRORID_PARSESCALARLIST_MERGE = 0x3003F0206,
+    _SET_ERRORID_PARSESCALARLIST_ENDLIST = 0x3003F0207,
+    _SET_ERRORID_PARSESCALARLIST_UNEXPECTED = 0x3003F0208,
+    _SET_ERRORID_PARSESCALARLIST_MALLOC = 0x3003F0209,
+    _SET_ERRORID_PARSESCALARLIST_CONVERT = 0x3003F020A,
+    _SET_ERRORID_PARSESCALARLIST_MALLOC2 = 0x3003F020B,
+    _SET_ERRORID_MERGETYPE_TYPEELEMENT = 0x300400200,
+    _SET_ERRORID_MERGETYPE_NUMBERELEMENT = 0x300400201,
+    _SET_ERRORID_MERGETYPE_TYPE = 0x300400202,
+    _SET_ERRORID_PARSEFIELDS_ENDSTRUCT = 0x300410200,
+    _SET_ERRORID_PARSEFIELDS_UNEXPECTED = 0x300410201,
+    _SET_ERRORID_PARSEFIELDS_NAME = 0x300410202,
+    _SET_ERRORID_PARSEFIELDS_REALLOC = 0x300410203,
+    _SET_ERRORID_PARSEFIELDS_VALUE = 0x300410204,
+    _SET_ERRORID_PARSEFIELDS_END = 0x300410205,
+    _SET_ERRORID_PARSEFIELDS_ENDVALUE = 0x300410206,
+    _SET_ERRORID_CREATESTRUCT_CREATEDICT = 0x300420200,
+    _SET_ERRORID_CREATESTRUCT_BLOOM = 0x300420201,
+    _SET_ERRORID_CREATESTRUCT_INTERN = 0x300420202,
+    _SET_ERRORID_CREATESTRUCT_DUBLICATE = 0x300420203,
+    _SET_ERRORID_CREATESTRUCT_ADDITEM = 0x300420204,
+    _SET_ERRORID_SKIPVALUE_END = 0x300430200,
+    _SET_ERRORID_SKIPVALUE_UNEXPECTED = 0x300430201,
+    _SET_ERRORID_SPLITTEXT_SKIP = 0x300440200,
+    _SET_ERRORID_SPLITTEXT_REALLOC = 0x300440201,
+    _SET_ERRORID_INTERNVALUE_INTERN = 0x300450200,
+    _SET_ERRORID_INTERNVALUE_FIELD = 0x300450201,
+    _SET_ERRORID_INTERNVALUE_ELEMENT = 0x300450202,
+    _SET_ERRORID_PARSETEXTPARALLEL_PARSE = 0x300460200,
+    _SET_ERRORID_PARSETEXTPARALLEL_MALLOC = 0x300460201,
+    _SET_ERRORID_PARSETEXTPARALLEL_MALLOCTHREADS = 0x300460202,
+    _SET_ERRORID_PARSETEXTPARALLEL_TYPEDICT = 0x300460203,
+    _SET_ERRORID_PARSETEXTPARALLEL_HASH = 0x300460204,
+    _SET_ERRORID_LOADSETTINGSPARALLEL_LOAD = 0x300470200,
+    _SET_ERRORID_LOADSETTINGSPARALLEL_PARSE = 0x300470201,
+    _SET_ERRORID_LOADSETTINGSLAZY_LOAD = 0x300480200,
+    _SET_ERRORID_LOADSETTINGSLAZY_MALLOC = 0x300480201,
+    _SET_ERRORID_LOADSETTINGSLAZY_NAME = 0x300480202,
+    _SET_ERRORID_LOADSETTINGSLAZY_SKIP = 0x300480203,
+    _SET_ERRORID_LOADSETTINGSLAZY_REALLOC = 0x300480204,
+    _SET_ERRORID_LOADSETTINGSLAZY_CREATEDICT = 0x300480205,
+    _SET_ERRORID_LOADSETTINGSLAZY_DUBLICATE = 0x300480206,
+    _SET_ERRORID_LOADSETTINGSLAZY_ADDITEM = 0x300480207,
+    _SET_ERRORID_LOADSETTINGSLAZY_TYPEDICT = 0x300480208,
+    _SET_ERRORID_LAZYGET_MISSING = 0x300490200,
+    _SET_ERRORID_LAZYGET_MALLOC = 0x300490201,
+    _SET_ERRORID_LAZYGET_VALUE = 0x300490203,
+    _SET_ERRORID_LAZYGET_ENDVALUE = 0x300490204,
+    _SET_ERRORID_BUILDTYPEDICT_CREATEDICT = 0x3004A0200,
+    _SET_ERRORID_BUILDTYPEDICT_LOADDICT = 0x3004A0201,
+    _SET_ERRORID_CREATEPARSER_MALLOC = 0x3004B0200,
+    _SET_ERRORID_CREATEPARSER_TYPEDICT = 0x3004B0201,
+    _SET_ERRORID_PARSERLOAD_LOAD = 0x3004C0200,
+    _SET_ERRORID_PARSERLOAD_PARSE = 0x3004C0201,
+    _SET_ERRORID_SAVESETTINGS_MALLOC = 0x3004D0200,
+    _SET_ERRORID_SAVESETTINGS_OPEN = 0x3004D0201,
+    _SET_ERRORID_SAVESETTINGS_SAVE = 0x3004D0202,
+    _SET_ERRORID_SAVESETTINGS_WRITE = 0x3004D0203,
+    _SET_ERRORID_WRITEFLUSH_WRITE = 0x3004E0200,
+    _SET_ERRORID_SAVEFIELDS_NAME = 0x3004F0200,
+    _SET_ERRORID_SAVEFIELDS_WRITE = 0x3004F0201,
+    _SET_ERRORID_SAVEFIELDS_VALUE = 0x3004F0202,
+    _SET_ERRORID_SAVEVALUE_WRITE = 0x300500200,
+    _SET_ERRORID_SAVEVALUE_FINITE = 0x300500201,
+    _SET_ERRORID_SAVEVALUE_CHAR = 0x300500202,
+    _SET_ERRORID_SAVEVALUE_TYPE = 0x300500203,
+    _SET_ERRORID_SAVEVALUE_STRUCT = 0x300500204,
+    _SET_ERRORID_SAVEVALUE_ELEMENT = 0x300500205,
+    _SET_ERRORID_SAVEVALUE_NOELEMENTS = 0x300500206,
+    _SET_ERRORID_REVERSETRANSLATE_STRUCT = 0x300510200,
+    _SET_ERRORID_REVERSESTRUCT_CREATEDICT = 0x300520200,
+    _SET_ERRORID_REVERSESTRUCT_BLOOM = 0x300520201,
+    _SET_ERRORID_REVERSESTRUCT_INTERN = 0x300520202,
+    _SET_ERRORID_REVERSESTRUCT_DUBLICATE = 0x300520203,
+    _SET_ERRORID_REVERSESTRUCT_ELEMENT = 0x300520204,
+    _SET_ERRORID_REVERSESTRUCT_ADDITEM = 0x300520205,
+    _SET_ERRORID_REVERSEELEMENT_MALLOC = 0x300530200,
+    _SET_ERRORID_REVERSEELEMENT_LIST = 0x300530201,
+    _SET_ERRORID_REVERSEELEMENT_NOSTRUCT = 0x300530202,
+    _SET_ERRORID_REVERSEELEMENT_STRUCT = 0x300530203,
+    _SET_ERRORID_REVERSEELEMENT_NULL = 0x300530204,
+    _SET_ERRORID_REVERSEELEMENT_MALLOC2 = 0x300530205,
+    _SET_ERRORID_REVERSEELEMENT_TYPE = 0x300530206,
+    _SET_ERRORID_REVERSELIST_NULL = 0x300540200,
+    _SET_ERRORID_REVERSELIST_LENGTH = 0x300540201,
+    _SET_ERRORID_REVERSELIST_MALLOC = 0x300540202,
+    _SET_ERRORID_REVERSELIST_MALLOC2 = 0x300540203,
+    _SET_ERRORID_REVERSELIST_ELEMENT = 0x300540204,
+    _SET_ERRORID_SAVENAME_NAME = 0x300550200,
+    _SET_ERRORID_SAVENAME_WRITE = 0x300550201,
+    _SET_ERRORID_COMPILEPATH_MALLOC = 0x300560200,
+    _SET_ERRORID_COMPILEPATH_HASH = 0x300560201,
+    _SET_ERRORID_COMPILEPATH_MALLOC2 = 0x300560202,
+    _SET_ERRORID_COMPILEPATH_NAME = 0x300560203,
+    _SET_ERRORID_COMPILEPATH_INTERN = 0x300560204,
+    _SET_ERRORID_COMPILEPATH_INDEX = 0x300560205,
+    _SET_ERRORID_COMPILEPATH_SEPARATOR = 0x300560206,
+    _SET_ERRORID_QUERY_STRUCT = 0x300570200,
+    _SET_ERRORID_QUERY_FIELD = 0x300570201,
+    _SET_ERRORID_QUERY_LIST = 0x300570202,
+    _SET_ERRORID_QUERY_INDEX = 0x300570203
 };
 
 #define _SET_ERRORMES_MALLOC "Unable to allocate memory (Size: %lu)"
@@ -164,6 +438,8 @@ enum _SET_ErrorID {
 #define _SET_ERRORMES_ILLIGALDOT2 "Dound a dot in definition of the potentiation of a floating point number (%s)"
 #define _SET_ERRORMES_ILLIGALEXP "Found to potentiations in definition of floating point number (%s)"
 #define _SET_ERRORMES_CREATEDICT "Unable to create a dictionary"
+#define _SET_ERRORMES_BLOOM "Unable to add a bloom filter to the dictionary"
+#define _SET_ERRORMES_INTERN "Unable to intern the keys of the dictionary"
 #define _SET_ERRORMES_CONVERTLIST "Unable to convert list"
 #define _SET_ERRORMES_CONVERTSTRUCT "Unable to convert struct"
 #define _SET_ERRORMES_DICTEXIST "The dict has not been initialised"
@@ -214,6 +490,64 @@ enum _SET_ErrorID {
 #define _SET_ERRORMES_TRANSLATELIST "Unable to translate list"
 #define _SET_ERRORMES_TRANSLATEITEM "Unable to translate item (%s)"
 #define _SET_ERRORMES_ILLIGALBOOL "A bool should be either false (0) or true (1) (Received: %s)"
+#define _SET_ERRORMES_UNEXPECTED "Found unexpected character (%s: %u, received: %c)"
+#define _SET_ERRORMES_ENDVALUE "Expected %c after value (%s: %u, received: %c)"
+#define _SET_ERRORMES_PARSEFILE "Unable to parse file (%s)"
+#define _SET_ERRORMES_COMMONTYPE "Unable to find a common type for the elements of the list"
+#define _SET_ERRORMES_MATCHTYPE "Value does not match the declared type (Expected: %u)"
+#define _SET_ERRORMES_CREATEARENA "Unable to create arena"
+#define _SET_ERRORMES_ACQUIREHASH "Unable to get the hash table for the dictionaries"
+#define _SET_ERRORMES_PARSETEXT "Unable to parse text"
+#define _SET_ERRORMES_STATFILE "Unable to get the status of file (%s)"
+#define _SET_ERRORMES_OPENFILE "Unable to open file (%s)"
+#define _SET_ERRORMES_WRITEFILE "Unable to write to file (%s)"
+#define _SET_ERRORMES_CACHENAME "Unable to create the name of the cache"
+#define _SET_ERRORMES_WRITECACHE "Unable to write cache (%s)"
+#define _SET_ERRORMES_WRITESTRUCT "Unable to write struct to cache"
+#define _SET_ERRORMES_WRITELIST "Unable to write list to cache"
+#define _SET_ERRORMES_WRITEVALUE "Unable to write value to cache (%s)"
+#define _SET_ERRORMES_READCACHE "Unable to read cache of file (%s)"
+#define _SET_ERRORMES_CORRUPTCACHE "The cache is corrupt (Offset: %lu)"
+#define _SET_ERRORMES_READCACHEVALUE "Unable to read value from cache (Field: %s)"
+#define _SET_ERRORMES_INOTIFY "Unable to watch for changes of file (%s)"
+#define _SET_ERRORMES_POLL "Unable to wait for changes"
+#define _SET_ERRORMES_READEVENTS "Unable to read the changes"
+#define _SET_ERRORMES_RELOAD "Unable to reload file (%s)"
+#define _SET_ERRORMES_SPLITFIELDS "Unable to find the fields of the file"
+#define _SET_ERRORMES_TRANSLATEDIFF "Unable to translate the changed fields"
+#define _SET_ERRORMES_COMPILETABLE "Unable to compile translation table"
+#define _SET_ERRORMES_TABLEDUBLICATE "2 entries of the translation table have the same name (%s)"
+#define _SET_ERRORMES_TABLEINDEX "2 names of the translation table have the same hash (%s, %s)"
+#define _SET_ERRORMES_TYPEDICT "Unable to create the dict of types"
+#define _SET_ERRORMES_PARSENAME "Unable to read the name of the field (%s: %lu)"
+#define _SET_ERRORMES_LOADEMPTY "File has a field which is not in the translation table which must not be the case in EMPTY mode (%s)"
+#define _SET_ERRORMES_LOADFILL "File is missing a field which must be included in FILL mode (%s)"
+#define _SET_ERRORMES_EXPECTLIST "Expected a list (%s: %u, received: %c)"
+#define _SET_ERRORMES_EXPECTSTRUCT "Expected a struct (%s: %u, received: %c)"
+#define _SET_ERRORMES_LOADALLOC "Unable to remember allocated memory"
+#define _SET_ERRORMES_PARSEFIELDS "Unable to read the fields of the struct"
+#define _SET_ERRORMES_CREATESTRUCT "Unable to create the struct from its fields"
+#define _SET_ERRORMES_SKIPVALUE "Unable to find the end of the field (%s: %lu)"
+#define _SET_ERRORMES_INTERNVALUE "Unable to intern the keys of the field (%s)"
+#define _SET_ERRORMES_INTERNELEMENT "Unable to intern the keys of the element (%s: %lu)"
+#define _SET_ERRORMES_MISSINGFIELD "The field does not exist (%s)"
+#define _SET_ERRORMES_SAVEFILE "Unable to save file (%s)"
+#define _SET_ERRORMES_SAVENAME "The name cannot be read back as the name of a field (%s)"
+#define _SET_ERRORMES_SAVEFIELD "Unable to save the field (%s)"
+#define _SET_ERRORMES_SAVEVALUE "Unable to save the value (Type: %u)"
+#define _SET_ERRORMES_SAVEELEMENT "Unable to save the element (%s: %lu)"
+#define _SET_ERRORMES_SAVEFINITE "Floating point number is not finite (%g)"
+#define _SET_ERRORMES_SAVECHAR "A char with the value 0 cannot be saved"
+#define _SET_ERRORMES_REVERSEFIELD "Unable to read the field from the struct (%s)"
+#define _SET_ERRORMES_REVERSELIST "Unable to read the list from the struct"
+#define _SET_ERRORMES_LISTLENGTH "The translation table does not give a valid length for the list (%s: %lu)"
+#define _SET_ERRORMES_PATHNAME "Expected the name of a field in the path (%s: %lu)"
+#define _SET_ERRORMES_PATHINDEX "Expected a list index of at most 4294967295 followed by ] in the path (%s: %lu)"
+#define _SET_ERRORMES_PATHSEPARATOR "Expected . or [ in the path (%s: %lu, received: %c)"
+#define _SET_ERRORMES_INTERNNAME "Unable to intern the name (%s)"
+#define _SET_ERRORMES_QUERYSTRUCT "The value is not a struct so it has no fields (%s)"
+#define _SET_ERRORMES_QUERYLIST "The value is not a list so it has no elements (Index: %u)"
+#define _SET_ERRORMES_QUERYINDEX "The index is outside of the list (Index: %u, Length: %u)"
 
 enum __SET_ValueType {
     SET_VALUETYPE_VALUE,
@@ -225,13 +559,13 @@ enum __SET_DataType {
     SET_DATATYPE_NONE,
     SET_DATATYPE_INT,
     SET_DATATYPE_BOOL,
-    SET_DATATYPE_INT8,
+    SET_DATATYPE_INT8, // Declared as uint7
     SET_DATATYPE_UINT8,
-    SET_DATATYPE_INT16,
+    SET_DATATYPE_INT16, // Declared as uint15
     SET_DATATYPE_UINT16,
-    SET_DATATYPE_INT32,
+    SET_DATATYPE_INT32, // Declared as uint31
     SET_DATATYPE_UINT32,
-    SET_DATATYPE_INT64,
+    SET_DATATYPE_INT64, // Declared as uint63
     SET_DATATYPE_UINT64,
     SET_DATATYPE_SINT8,
     SET_DATATYPE_SINT16,
@@ -255,6 +589,13 @@ enum __SET_DataTypeBase {
     SET_DATATYPEBASE_STRING = 0x20
 };
 
+enum __SET_ChangeType {
+    SET_CHANGETYPE_NONE = 0x0, // No change
+    SET_CHANGETYPE_ADDED = 0x1, // The field is new
+    SET_CHANGETYPE_REMOVED = 0x2, // The field is gone, the old value is in the diff
+    SET_CHANGETYPE_CHANGED = 0x3 // The text of the field has changed, the old value is in the diff
+};
+
 enum __SET_TranslationMode {
     SET_TRANSLATIONMODE_NONE = 0x0, // No mode activated
     SET_TRANSLATIONMODE_FILL = 0x1, // The struct must be filled completely
@@ -269,12 +610,37 @@ typedef enum __SET_DataType SET_DataType;
 typedef enum __SET_ValueType SET_ValueType;
 typedef enum __SET_DataTypeBase SET_DataTypeBase;
 typedef enum __SET_TranslationMode SET_TranslationMode;
+typedef enum __SET_ChangeType SET_ChangeType;
 typedef struct __SET_CodeName SET_CodeName;
 typedef struct __SET_CodeValue SET_CodeValue;
 typedef union ___SET_CodeValue _SET_CodeValue;
 typedef struct __SET_CodeStruct SET_CodeStruct;
 typedef struct __SET_CodeList SET_CodeList;
 typedef struct __SET_TranslationTable SET_TranslationTable;
+typedef struct __SET_CompiledTable SET_CompiledTable;
+typedef struct __SET_Stream SET_Stream;
+typedef struct __SET_StreamField SET_StreamField;
+typedef struct __SET_Settings SET_Settings;
+typedef struct __SET_CacheHeader SET_CacheHeader;
+typedef struct __SET_CacheValue SET_CacheValue;
+typedef struct __SET_CacheField SET_CacheField;
+typedef struct __SET_CacheWriter SET_CacheWriter;
+typedef struct __SET_CacheReader SET_CacheReader;
+typedef struct __SET_WatchField SET_WatchField;
+typedef struct __SET_Change SET_Change;
+typedef struct __SET_Diff SET_Diff;
+typedef struct __SET_Watcher SET_Watcher;
+typedef struct __SET_LoadAlloc SET_LoadAlloc;
+typedef struct __SET_Loader SET_Loader;
+typedef struct __SET_ParseChunk SET_ParseChunk;
+typedef struct __SET_ParseJob SET_ParseJob;
+typedef struct __SET_LazyField SET_LazyField;
+typedef struct __SET_LazySettings SET_LazySettings;
+typedef struct __SET_Parser SET_Parser;
+typedef struct __SET_ScanBlock SET_ScanBlock;
+typedef struct __SET_TextWriter SET_TextWriter;
+typedef struct __SET_PathSegment SET_PathSegment;
+typedef struct __SET_Path SET_Path;
 
 union ___SET_Data {
     bool b;
@@ -301,9 +667,10 @@ struct __SET_Data {
 
 struct __SET_DataList {
     uint32_t count; // The number of items in the list
-    SET_Data **list; // The list of values
+    SET_Data **list; // The list of values, NULL if the list is packed which only happens after SET_PackLists(true)
     SET_DataType type; // The type of the list
     uint32_t depth; // The depth of the list
+    void *packed; // If not NULL the list has a depth of 1 and the values are numbers, bools or chars stored after each other as the C type of type, SET_ListElement reads both kinds of lists
 };
 
 struct __SET_CodeName {
@@ -342,20 +709,1100 @@ struct __SET_TranslationTable {
     size_t offset; // The offset of the location
     SET_TranslationTable *sub; // The sub translation table list used if Type is struct
     size_t count; // The number of elements in the sub table
+    size_t length; // The number of elements in each level of the list, only used by SET_ReverseTranslate since the struct does not store the length of its lists
+};
+
+struct __SET_CompiledTable {
+    const SET_TranslationTable *table; // The table it was compiled from, it must not be changed while this exists
+    size_t count; // The number of entries in table
+    uint64_t *hashes; // The DIC_HashKey of the name of each entry
+    uint32_t *seeds; // The seed of each bucket of the name index, it is mixed into the _SET_HashText of the names in the bucket so they get their own slots
+    uint32_t *slots; // The name index, each slot holds the position of an entry plus 1, 0 if it is empty
+    uint32_t bucketShift; // The bucket of a hash is found from its top bits, the number of buckets is 2^(64 - bucketShift)
+    uint32_t slotShift; // The slot of a hash is found from the top bits of it mixed with the seed, the number of slots is 2^(64 - slotShift)
+    SET_CompiledTable *sub; // The compiled sub tables, one for each entry, only filled in for structs
+};
+
+struct __SET_Stream {
+    char *pos; // The current position in the text, it must be writable since names and values are terminated in place
+    uint32_t line; // The line of pos, used for error messages
+    ARN_Arena *arena; // If not NULL the data is allocated from this arena instead of with malloc
+    bool view; // If true names and strings without special characters point into the text instead of being copied, it requires an arena
+    bool parallel; // If true the stream is read by a worker thread and the keys of structs are not interned
+    DIC_Dict *types; // The names of the types, it must be set before any names are read
+};
+
+// Everything allocated while loading into a struct is remembered so it can be freed if the load fails
+struct __SET_LoadAlloc {
+    void *pointer; // The allocated memory
+    void **location; // Where the pointer is stored, NULL if it is stored inside a list since the list is freed too
+};
+
+struct __SET_Loader {
+    SET_Stream stream; // The text being loaded
+    SET_LoadAlloc *allocs; // The memory allocated so far
+    size_t count; // The number of entries in allocs
+    size_t capacity; // The number of entries allocs has room for
+};
+
+// A part of the top level of a text which is parsed by one of the threads of a parallel load
+struct __SET_ParseChunk {
+    SET_Stream stream; // The stream to read the chunk with, the chunk ends with the end of the text
+    SET_StreamField *fields; // The fields read from the chunk, NULL until they have been read
+    size_t count; // The number of fields
+};
+
+// The chunks shared by the threads of a parallel load
+struct __SET_ParseJob {
+    SET_ParseChunk *chunks; // All of the chunks in the order of the text
+    size_t count; // The number of chunks
+    _Atomic size_t next; // The next chunk which has not been taken by a thread
+    _Atomic bool failed; // Set when a chunk could not be read so the other threads stop
+};
+
+// A top level field of a lazily loaded file, the value is parsed the first time it is used
+struct __SET_LazyField {
+    char *name; // The name of the field, points into the text
+    const char *start; // The first character of the value in the text
+    size_t length; // The number of characters of the value, the ending ; is not included
+    uint32_t line; // The line the value starts on
+    SET_DataType type; // The declared type, SET_DATATYPE_NONE if there was no type
+    uint8_t depth; // The declared list depth
+    SET_Data *value; // The parsed value, NULL until it has been used
+};
+
+// A settings file where only the names of the top level fields have been read
+struct __SET_LazySettings {
+    char *text; // The text of the file, the names and values of the fields point into it
+    SET_LazyField *fields; // All of the top level fields
+    size_t count; // The number of fields
+    DIC_Dict *index; // Finds the SET_LazyField of a name
+    DIC_Dict *types; // The names of the types, it is kept for the values which have not been parsed yet
+};
+
+// Everything needed to load settings files which can be reused between loads, each thread may use its own parser at the same time
+struct __SET_Parser {
+    DIC_Dict *types; // The names of the types, it is created once and only read afterwards
+    char *buffer; // The text of the last file loaded, it is reused for the next file
+    size_t bufferSize; // The number of bytes allocated for buffer
+};
+
+// The characters of an aligned block of text sorted into classes, a bit is set for every character in the class
+struct __SET_ScanBlock {
+    const char *start; // The first character of the block, NULL if no block has been read
+    uint64_t structural; // Characters which matter when skipping a value
+    uint64_t string; // Characters which cannot just be copied inside a string
+    uint64_t newline; // Newlines
+};
+
+// A settings file being written by SET_SaveSettings, the text is collected in a buffer and written in large pieces
+struct __SET_TextWriter {
+    FILE *file; // The file being written
+    const char *fileName; // The name of the file, used for error messages
+    char *buffer; // The text which has not been written to the file yet, it has room for _SET_WRITESIZE characters
+    size_t size; // The number of characters in buffer
+};
+
+// One step of a compiled path, either a field of a struct or an element of a list
+struct __SET_PathSegment {
+    const char *name; // The name of the field interned with DIC_Intern, NULL if the segment is an element of a list
+    uint64_t hash; // The DIC_HashKey of name
+    uint32_t index; // The position of the element, only used if name is NULL
+};
+
+// A path like render.lights[3].color read by SET_CompilePath so SET_Query does not have to read or hash it again
+struct __SET_Path {
+    SET_PathSegment *segments; // The fields and elements to go through in order
+    size_t count; // The number of segments
+};
+
+struct __SET_StreamField {
+    char *name; // The name of the field, points into the text of the stream
+    SET_Data *value; // The value of the field
+    uint32_t line; // The line the field was defined on
+};
+
+struct __SET_Settings {
+    SET_DataStruct *data; // The loaded settings, it must not be destroyed on its own
+    ARN_Arena *arena; // The arena all of data is allocated from
+    char *text; // The text of the file, the names and strings of data point into it
+    uint8_t *map; // The mapped cache if it was loaded from a cache, the names and strings of data point into it instead of text
+    size_t mapSize; // The size of map
+};
+
+// All offsets in a cache are counted from the start of the file
+struct __SET_CacheHeader {
+    uint64_t magic; // Must be _SET_CACHEMAGIC
+    uint64_t size; // The total size of the file
+    uint64_t sourceSize; // The size of the settings file it was compiled from
+    int64_t sourceTime; // The modification time of the settings file in seconds
+    int64_t sourceTimeNano; // The nanoseconds of the modification time
+    uint64_t sourceHash; // The _SET_HashText of the settings file
+    uint64_t hashCheck; // The DIC_HashKey of _SET_CACHEHASHCHECK, the saved hashes of the names are only used if it is the same when loading
+    uint64_t root; // The offset of the top struct
+};
+
+// A struct is saved as the number of fields followed by the fields, a list is saved as the number of values, the type and the depth followed by the values
+struct __SET_CacheValue {
+    uint64_t type; // The SET_DataType of the value
+    uint64_t data; // The bits of the value for numbers and chars, the offset of the string, struct or list otherwise
+};
+
+struct __SET_CacheField {
+    uint64_t name; // The offset of the name
+    uint64_t hash; // The DIC_HashKey of the name
+    SET_CacheValue value; // The value of the field
+};
+
+struct __SET_CacheWriter {
+    uint8_t *data; // The cache being built
+    size_t size; // The number of bytes used in data
+    size_t capacity; // The number of bytes allocated for data
+};
+
+struct __SET_CacheReader {
+    const uint8_t *data; // The mapped cache
+    size_t size; // The size of the cache
+    ARN_Arena *arena; // If not NULL the tree is allocated from this arena and the names and strings point into the cache, otherwise they are copied
+    bool hashes; // True if the saved hashes of the names can be used
+};
+
+struct __SET_WatchField {
+    char *name; // The name of the field
+    size_t start; // The position of the first character of the field in the text
+    size_t length; // The number of characters in the field including the ending ;
+    uint64_t hash; // The _SET_HashText of the field
+    uint32_t line; // The line the field starts on
+};
+
+struct __SET_Change {
+    char *name; // The name of the field
+    SET_ChangeType type; // What happened to the field
+};
+
+struct __SET_Diff {
+    SET_Change *list; // The changed fields
+    size_t count; // The number of changed fields
+    SET_DataStruct *old; // The old values of the changed and removed fields
+};
+
+struct __SET_Watcher {
+    char *fileName; // The settings file
+    const char *baseName; // The name of the file inside its directory, points into fileName
+    int fileID; // The inotify instance, it can be polled to find out when to update
+    int watchID; // The watch of the directory, the directory is watched since editors often replace the file instead of writing to it
+    SET_DataStruct *data; // The current settings
+    char *text; // The text data was parsed from
+    SET_WatchField *fields; // The top level fields of text
+    size_t count; // The number of fields
+    DIC_Dict *index; // Finds the field with a given name
+    SET_Diff diff; // The changes made by the last update
+};
+
+// The classes a character can belong to, a character may be in several
+#define _SET_CHARCLASS_BLANK 0x01 // Spaces, tabs and carriage returns
+#define _SET_CHARCLASS_SPECIAL 0x02 // Special characters which should ignore spaces
+#define _SET_CHARCLASS_WORDEND 0x04 // Characters which end a word, comments also end a word but need the next character
+#define _SET_CHARCLASS_STRUCTURAL 0x08 // Characters which matter when skipping a value, newlines are counted separately
+#define _SET_CHARCLASS_STRING 0x10 // Characters inside strings and chars which cannot just be copied
+
+// The classes of every character
+const uint8_t _SET_CharClass[256] = {
+    ['\0'] = _SET_CHARCLASS_WORDEND | _SET_CHARCLASS_STRUCTURAL | _SET_CHARCLASS_STRING,
+    [' '] = _SET_CHARCLASS_BLANK | _SET_CHARCLASS_WORDEND,
+    ['\t'] = _SET_CHARCLASS_BLANK | _SET_CHARCLASS_WORDEND | _SET_CHARCLASS_STRING,
+    ['\r'] = _SET_CHARCLASS_BLANK | _SET_CHARCLASS_WORDEND | _SET_CHARCLASS_STRING,
+    ['\n'] = _SET_CHARCLASS_WORDEND | _SET_CHARCLASS_STRING,
+    ['\"'] = _SET_CHARCLASS_WORDEND | _SET_CHARCLASS_STRUCTURAL | _SET_CHARCLASS_STRING,
+    ['\''] = _SET_CHARCLASS_WORDEND | _SET_CHARCLASS_STRUCTURAL | _SET_CHARCLASS_STRING,
+    ['\\'] = _SET_CHARCLASS_SPECIAL | _SET_CHARCLASS_STRING,
+    [';'] = _SET_CHARCLASS_SPECIAL | _SET_CHARCLASS_WORDEND | _SET_CHARCLASS_STRUCTURAL,
+    ['['] = _SET_CHARCLASS_SPECIAL | _SET_CHARCLASS_WORDEND | _SET_CHARCLASS_STRUCTURAL,
+    [']'] = _SET_CHARCLASS_SPECIAL | _SET_CHARCLASS_WORDEND | _SET_CHARCLASS_STRUCTURAL,
+    ['{'] = _SET_CHARCLASS_SPECIAL | _SET_CHARCLASS_WORDEND | _SET_CHARCLASS_STRUCTURAL,
+    ['}'] = _SET_CHARCLASS_SPECIAL | _SET_CHARCLASS_WORDEND | _SET_CHARCLASS_STRUCTURAL,
+    ['/'] = _SET_CHARCLASS_SPECIAL | _SET_CHARCLASS_STRUCTURAL,
+    ['='] = _SET_CHARCLASS_SPECIAL | _SET_CHARCLASS_WORDEND,
+    [','] = _SET_CHARCLASS_SPECIAL | _SET_CHARCLASS_WORDEND,
+    ['*'] = _SET_CHARCLASS_SPECIAL | _SET_CHARCLASS_WORDEND,
+    [':'] = _SET_CHARCLASS_SPECIAL,
+    ['+'] = _SET_CHARCLASS_SPECIAL,
+    ['-'] = _SET_CHARCLASS_SPECIAL,
+    ['%'] = _SET_CHARCLASS_SPECIAL,
+    ['?'] = _SET_CHARCLASS_SPECIAL,
+    ['^'] = _SET_CHARCLASS_SPECIAL,
+    ['<'] = _SET_CHARCLASS_SPECIAL,
+    ['>'] = _SET_CHARCLASS_SPECIAL,
+    ['!'] = _SET_CHARCLASS_SPECIAL,
+    ['~'] = _SET_CHARCLASS_SPECIAL,
+    ['|'] = _SET_CHARCLASS_SPECIAL,
+    ['&'] = _SET_CHARCLASS_SPECIAL,
+    ['$'] = _SET_CHARCLASS_SPECIAL,
+    ['#'] = _SET_CHARCLASS_SPECIAL,
+    ['@'] = _SET_CHARCLASS_SPECIAL,
+    ['.'] = _SET_CHARCLASS_SPECIAL,
+    ['('] = _SET_CHARCLASS_SPECIAL,
+    [')'] = _SET_CHARCLASS_SPECIAL
 };
 
-// List of special characters which should ignore spaces
-uint32_t _SET_SpecialCharLength = 28;
-char _SET_SpecialChar[] = {';', ':', '=', '+', '-', '*', '/', '%', '?', '^', '<', '>', '!', '~', '|', '&', '\\', '$', '#', '@', '.', ',', '(', ')', '[', ']', '{', '}'};
+// The number of characters the scanners look at at once, blocks are aligned to this so they never cross a page
+#define _SET_SCANBLOCK 64
+
+// Reading a block may go past the end of the text, this is safe since the block is on the same page, but sanitizers do not know that
+#ifdef __SSE2__
+#define _SET_SCANATTRIBUTES __attribute__((no_sanitize("address", "thread")))
+#else
+#define _SET_SCANATTRIBUTES
+#endif
 
 // Types
-#define _SET_TYPECOUNT 15
-char *_SET_TypeNames[_SET_TYPECOUNT] = {"bool", "int", "uint8", "uint16", "uint32", "uint64", "int8", "int16", "int32", "int64", "float", "double", "char", "str", "struct"};
-SET_DataType _SET_Types[_SET_TYPECOUNT] = {SET_DATATYPE_BOOL, SET_DATATYPE_INT, SET_DATATYPE_UINT8, SET_DATATYPE_UINT16, SET_DATATYPE_UINT32, SET_DATATYPE_UINT64, SET_DATATYPE_SINT8, SET_DATATYPE_SINT16, SET_DATATYPE_SINT32, SET_DATATYPE_SINT64, SET_DATATYPE_FLOAT, SET_DATATYPE_DOUBLE, SET_DATATYPE_CHAR, SET_DATATYPE_STR, SET_DATATYPE_STRUCT};
-DIC_Dict *_SET_TypeDict = NULL;
+// Integers without a sign are named after the number of bits they can use, they fit both the signed and unsigned type of the size
+#define _SET_TYPECOUNT 19
+char *_SET_TypeNames[_SET_TYPECOUNT] = {"bool", "int", "uint8", "uint16", "uint32", "uint64", "int8", "int16", "int32", "int64", "float", "double", "char", "str", "struct", "uint7", "uint15", "uint31", "uint63"};
+SET_DataType _SET_Types[_SET_TYPECOUNT] = {SET_DATATYPE_BOOL, SET_DATATYPE_INT, SET_DATATYPE_UINT8, SET_DATATYPE_UINT16, SET_DATATYPE_UINT32, SET_DATATYPE_UINT64, SET_DATATYPE_SINT8, SET_DATATYPE_SINT16, SET_DATATYPE_SINT32, SET_DATATYPE_SINT64, SET_DATATYPE_FLOAT, SET_DATATYPE_DOUBLE, SET_DATATYPE_CHAR, SET_DATATYPE_STR, SET_DATATYPE_STRUCT, SET_DATATYPE_INT8, SET_DATATYPE_INT16, SET_DATATYPE_INT32, SET_DATATYPE_INT64};
 
 #define _SET_LINEPREMES "Line"
 #define _SET_ELEMENTPREMES "Element"
+#define _SET_POSITIONPREMES "Position"
+
+// The number of fields and list elements there is space for before the first reallocation while parsing
+#define _SET_STREAMSIZE 8
+
+// The smallest number of characters a chunk of a parallel load is split at, smaller texts are parsed by a single thread
+#define _SET_CHUNKSIZE 65536
+
+// The number of chunks a text is split into for each thread so threads with small fields can take more of them
+#define _SET_CHUNKSPERTHREAD 4
+
+#ifndef SET_CACHESUFFIX
+#define SET_CACHESUFFIX ".cache" // Added to the name of a settings file to get the name of its cache
+#endif
+
+// Identifies a cache written by SET_CompileSettings, the version is the last byte
+#define _SET_CACHEMAGIC 0x3148434143544553
+
+// The initial size of the buffer a cache is built in
+#define _SET_CACHESIZE 4096
+
+// The number of seeds tried for a bucket of the name index of a compiled table before the index is made larger
+#define _SET_COMPILETRIES 256
+
+// The key hashed to check that the saved hashes are still valid
+#define _SET_CACHEHASHCHECK "SET_CacheHashCheck"
+
+// Rounds a size up so that the next part of a cache is aligned
+#define _SET_CACHEALIGN(Size) (((Size) + sizeof(uint64_t) - 1) & ~(sizeof(uint64_t) - 1))
+
+// Checks that Size bytes at Offset are inside the cache, Offset must be aligned
+#define _SET_CACHEFITS(Reader, Offset, Size) ((Offset) % sizeof(uint64_t) == 0 && (Offset) <= (Reader)->size && (Size) <= (Reader)->size - (Offset))
+
+// The decimal exponents floats can be converted with without falling back to strtod
+#define _SET_POW5MIN -64
+#define _SET_POW5MAX 64
+
+// The locale strtod is used with so the decimal point is . whatever the locale of the program is, it is created the first time it is needed
+locale_t _SET_NumericLocale = (locale_t)0;
+pthread_mutex_t _SET_NumericLocaleLock = PTHREAD_MUTEX_INITIALIZER;
+
+// If true lists of numbers, bools and chars are packed, it is set with SET_PackLists
+_Atomic bool _SET_PackLists = false;
+
+// The powers of 10 which are exact as doubles
+const double _SET_Pow10[23] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+// 128 bit approximations of 5^q for q from _SET_POW5MIN to _SET_POW5MAX, shifted so the highest bit is set, the high word comes first
+const uint64_t _SET_Pow5Table[2 * (_SET_POW5MAX - _SET_POW5MIN + 1)] = {
+    0xA87FEA27A539E9A5, 0x3F2398D747B36224,
+    0xD29FE4B18E88640E, 0x8EEC7F0D19A03AAD,
+    0x83A3EEEEF9153E89, 0x1953CF68300424AC,
+    0xA48CEAAAB75A8E2B, 0x5FA8C3423C052DD7,
+    0xCDB02555653131B6, 0x3792F412CB06794D,
+    0x808E17555F3EBF11, 0xE2BBD88BBEE40BD0,
+    0xA0B19D2AB70E6ED6, 0x5B6ACEAEAE9D0EC4,
+    0xC8DE047564D20A8B, 0xF245825A5A445275,
+    0xFB158592BE068D2E, 0xEED6E2F0F0D56712,
+    0x9CED737BB6C4183D, 0x55464DD69685606B,
+    0xC428D05AA4751E4C, 0xAA97E14C3C26B886,
+    0xF53304714D9265DF, 0xD53DD99F4B3066A8,
+    0x993FE2C6D07B7FAB, 0xE546A8038EFE4029,
+    0xBF8FDB78849A5F96, 0xDE98520472BDD033,
+    0xEF73D256A5C0F77C, 0x963E66858F6D4440,
+    0x95A8637627989AAD, 0xDDE7001379A44AA8,
+    0xBB127C53B17EC159, 0x5560C018580D5D52,
+    0xE9D71B689DDE71AF, 0xAAB8F01E6E10B4A6,
+    0x9226712162AB070D, 0xCAB3961304CA70E8,
+    0xB6B00D69BB55C8D1, 0x3D607B97C5FD0D22,
+    0xE45C10C42A2B3B05, 0x8CB89A7DB77C506A,
+    0x8EB98A7A9A5B04E3, 0x77F3608E92ADB242,
+    0xB267ED1940F1C61C, 0x55F038B237591ED3,
+    0xDF01E85F912E37A3, 0x6B6C46DEC52F6688,
+    0x8B61313BBABCE2C6, 0x2323AC4B3B3DA015,
+    0xAE397D8AA96C1B77, 0xABEC975E0A0D081A,
+    0xD9C7DCED53C72255, 0x96E7BD358C904A21,
+    0x881CEA14545C7575, 0x7E50D64177DA2E54,
+    0xAA242499697392D2, 0xDDE50BD1D5D0B9E9,
+    0xD4AD2DBFC3D07787, 0x955E4EC64B44E864,
+    0x84EC3C97DA624AB4, 0xBD5AF13BEF0B113E,
+    0xA6274BBDD0FADD61, 0xECB1AD8AEACDD58E,
+    0xCFB11EAD453994BA, 0x67DE18EDA5814AF2,
+    0x81CEB32C4B43FCF4, 0x80EACF948770CED7,
+    0xA2425FF75E14FC31, 0xA1258379A94D028D,
+    0xCAD2F7F5359A3B3E, 0x096EE45813A04330,
+    0xFD87B5F28300CA0D, 0x8BCA9D6E188853FC,
+    0x9E74D1B791E07E48, 0x775EA264CF55347E,
+    0xC612062576589DDA, 0x95364AFE032A819E,
+    0xF79687AED3EEC551, 0x3A83DDBD83F52205,
+    0x9ABE14CD44753B52, 0xC4926A9672793543,
+    0xC16D9A0095928A27, 0x75B7053C0F178294,
+    0xF1C90080BAF72CB1, 0x5324C68B12DD6339,
+    0x971DA05074DA7BEE, 0xD3F6FC16EBCA5E04,
+    0xBCE5086492111AEA, 0x88F4BB1CA6BCF585,
+    0xEC1E4A7DB69561A5, 0x2B31E9E3D06C32E6,
+    0x9392EE8E921D5D07, 0x3AFF322E62439FD0,
+    0xB877AA3236A4B449, 0x09BEFEB9FAD487C3,
+    0xE69594BEC44DE15B, 0x4C2EBE687989A9B4,
+    0x901D7CF73AB0ACD9, 0x0F9D37014BF60A11,
+    0xB424DC35095CD80F, 0x538484C19EF38C95,
+    0xE12E13424BB40E13, 0x2865A5F206B06FBA,
+    0x8CBCCC096F5088CB, 0xF93F87B7442E45D4,
+    0xAFEBFF0BCB24AAFE, 0xF78F69A51539D749,
+    0xDBE6FECEBDEDD5BE, 0xB573440E5A884D1C,
+    0x89705F4136B4A597, 0x31680A88F8953031,
+    0xABCC77118461CEFC, 0xFDC20D2B36BA7C3E,
+    0xD6BF94D5E57A42BC, 0x3D32907604691B4D,
+    0x8637BD05AF6C69B5, 0xA63F9A49C2C1B110,
+    0xA7C5AC471B478423, 0x0FCF80DC33721D54,
+    0xD1B71758E219652B, 0xD3C36113404EA4A9,
+    0x83126E978D4FDF3B, 0x645A1CAC083126EA,
+    0xA3D70A3D70A3D70A, 0x3D70A3D70A3D70A4,
+    0xCCCCCCCCCCCCCCCC, 0xCCCCCCCCCCCCCCCD,
+    0x8000000000000000, 0x0000000000000000,
+    0xA000000000000000, 0x0000000000000000,
+    0xC800000000000000, 0x0000000000000000,
+    0xFA00000000000000, 0x0000000000000000,
+    0x9C40000000000000, 0x0000000000000000,
+    0xC350000000000000, 0x0000000000000000,
+    0xF424000000000000, 0x0000000000000000,
+    0x9896800000000000, 0x0000000000000000,
+    0xBEBC200000000000, 0x0000000000000000,
+    0xEE6B280000000000, 0x0000000000000000,
+    0x9502F90000000000, 0x0000000000000000,
+    0xBA43B74000000000, 0x0000000000000000,
+    0xE8D4A51000000000, 0x0000000000000000,
+    0x9184E72A00000000, 0x0000000000000000,
+    0xB5E620F480000000, 0x0000000000000000,
+    0xE35FA931A0000000, 0x0000000000000000,
+    0x8E1BC9BF04000000, 0x0000000000000000,
+    0xB1A2BC2EC5000000, 0x0000000000000000,
+    0xDE0B6B3A76400000, 0x0000000000000000,
+    0x8AC7230489E80000, 0x0000000000000000,
+    0xAD78EBC5AC620000, 0x0000000000000000,
+    0xD8D726B7177A8000, 0x0000000000000000,
+    0x878678326EAC9000, 0x0000000000000000,
+    0xA968163F0A57B400, 0x0000000000000000,
+    0xD3C21BCECCEDA100, 0x0000000000000000,
+    0x84595161401484A0, 0x0000000000000000,
+    0xA56FA5B99019A5C8, 0x0000000000000000,
+    0xCECB8F27F4200F3A, 0x0000000000000000,
+    0x813F3978F8940984, 0x4000000000000000,
+    0xA18F07D736B90BE5, 0x5000000000000000,
+    0xC9F2C9CD04674EDE, 0xA400000000000000,
+    0xFC6F7C4045812296, 0x4D00000000000000,
+    0x9DC5ADA82B70B59D, 0xF020000000000000,
+    0xC5371912364CE305, 0x6C28000000000000,
+    0xF684DF56C3E01BC6, 0xC732000000000000,
+    0x9A130B963A6C115C, 0x3C7F400000000000,
+    0xC097CE7BC90715B3, 0x4B9F100000000000,
+    0xF0BDC21ABB48DB20, 0x1E86D40000000000,
+    0x96769950B50D88F4, 0x1314448000000000,
+    0xBC143FA4E250EB31, 0x17D955A000000000,
+    0xEB194F8E1AE525FD, 0x5DCFAB0800000000,
+    0x92EFD1B8D0CF37BE, 0x5AA1CAE500000000,
+    0xB7ABC627050305AD, 0xF14A3D9E40000000,
+    0xE596B7B0C643C719, 0x6D9CCD05D0000000,
+    0x8F7E32CE7BEA5C6F, 0xE4820023A2000000,
+    0xB35DBF821AE4F38B, 0xDDA2802C8A800000,
+    0xE0352F62A19E306E, 0xD50B2037AD200000,
+    0x8C213D9DA502DE45, 0x4526F422CC340000,
+    0xAF298D050E4395D6, 0x9670B12B7F410000,
+    0xDAF3F04651D47B4C, 0x3C0CDD765F114000,
+    0x88D8762BF324CD0F, 0xA5880A69FB6AC800,
+    0xAB0E93B6EFEE0053, 0x8EEA0D047A457A00,
+    0xD5D238A4ABE98068, 0x72A4904598D6D880,
+    0x85A36366EB71F041, 0x47A6DA2B7F864750,
+    0xA70C3C40A64E6C51, 0x999090B65F67D924,
+    0xD0CF4B50CFE20765, 0xFFF4B4E3F741CF6D,
+    0x82818F1281ED449F, 0xBFF8F10E7A8921A4,
+    0xA321F2D7226895C7, 0xAFF72D52192B6A0D,
+    0xCBEA6F8CEB02BB39, 0x9BF4F8A69F764490,
+    0xFEE50B7025C36A08, 0x02F236D04753D5B4,
+    0x9F4F2726179A2245, 0x01D762422C946590,
+    0xC722F0EF9D80AAD6, 0x424D3AD2B7B97EF5,
+    0xF8EBAD2B84E0D58B, 0xD2E0898765A7DEB2,
+    0x9B934C3B330C8577, 0x63CC55F49F88EB2F,
+    0xC2781F49FFCFA6D5, 0x3CBF6B71C76B25FB
+};
+
+// The number of characters collected by SET_SaveSettings before they are written to the file
+#define _SET_WRITESIZE 65536
+
+// The largest number of characters a number can take when it is saved
+#define _SET_NUMBERSIZE 32
+
+// The number of spaces each level of a struct is indented with when it is saved
+#define _SET_INDENTSIZE 4
+
+// Fixed notation is used when saving floats if the decimal point is no further than this from the first digit, otherwise the exponent is written
+#define _SET_FIXEDMAX 21
+#define _SET_FIXEDMIN -5
+
+// The powers of 10 which fit in 64 bits
+const uint64_t _SET_Pow10Int[20] = {1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL, 1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL, 100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL};
+
+// All numbers from 00 to 99 so numbers can be written 2 digits at a time
+const char _SET_DigitPairs[200] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+// The number of bits of the powers of 5 used to find the shortest digits of a float, and the number of powers needed for doubles
+#define _SET_POW5BITS 125
+#define _SET_POW5INVBITS 125
+#define _SET_POW5SPLITCOUNT 326
+#define _SET_POW5INVSPLITCOUNT 292
+
+// 5^q for q from 0 to _SET_POW5SPLITCOUNT - 1, shifted so they have _SET_POW5BITS bits, the high word comes first
+const uint64_t _SET_Pow5Split[2 * _SET_POW5SPLITCOUNT] = {
+    0x1000000000000000, 0x0000000000000000,
+    0x1400000000000000, 0x0000000000000000,
+    0x1900000000000000, 0x0000000000000000,
+    0x1F40000000000000, 0x0000000000000000,
+    0x1388000000000000, 0x0000000000000000,
+    0x186A000000000000, 0x0000000000000000,
+    0x1E84800000000000, 0x0000000000000000,
+    0x1312D00000000000, 0x0000000000000000,
+    0x17D7840000000000, 0x0000000000000000,
+    0x1DCD650000000000, 0x0000000000000000,
+    0x12A05F2000000000, 0x0000000000000000,
+    0x174876E800000000, 0x0000000000000000,
+    0x1D1A94A200000000, 0x0000000000000000,
+    0x12309CE540000000, 0x0000000000000000,
+    0x16BCC41E90000000, 0x0000000000000000,
+    0x1C6BF52634000000, 0x0000000000000000,
+    0x11C37937E0800000, 0x0000000000000000,
+    0x16345785D8A00000, 0x0000000000000000,
+    0x1BC16D674EC80000, 0x0000000000000000,
+    0x1158E460913D0000, 0x0000000000000000,
+    0x15AF1D78B58C4000, 0x0000000000000000,
+    0x1B1AE4D6E2EF5000, 0x0000000000000000,
+    0x10F0CF064DD59200, 0x0000000000000000,
+    0x152D02C7E14AF680, 0x0000000000000000,
+    0x1A784379D99DB420, 0x0000000000000000,
+    0x108B2A2C28029094, 0x0000000000000000,
+    0x14ADF4B7320334B9, 0x0000000000000000,
+    0x19D971E4FE8401E7, 0x4000000000000000,
+    0x1027E72F1F128130, 0x8800000000000000,
+    0x1431E0FAE6D7217C, 0xAA00000000000000,
+    0x193E5939A08CE9DB, 0xD480000000000000,
+    0x1F8DEF8808B02452, 0xC9A0000000000000,
+    0x13B8B5B5056E16B3, 0xBE04000000000000,
+    0x18A6E32246C99C60, 0xAD85000000000000,
+    0x1ED09BEAD87C0378, 0xD8E6400000000000,
+    0x13426172C74D822B, 0x878FE80000000000,
+    0x1812F9CF7920E2B6, 0x6973E20000000000,
+    0x1E17B84357691B64, 0x03D0DA8000000000,
+    0x12CED32A16A1B11E, 0x8262889000000000,
+    0x178287F49C4A1D66, 0x22FB2AB400000000,
+    0x1D6329F1C35CA4BF, 0xABB9F56100000000,
+    0x125DFA371A19E6F7, 0xCB54395CA0000000,
+    0x16F578C4E0A060B5, 0xBE2947B3C8000000,
+    0x1CB2D6F618C878E3, 0x2DB399A0BA000000,
+    0x11EFC659CF7D4B8D, 0xFC90400474400000,
+    0x166BB7F0435C9E71, 0x7BB4500591500000,
+    0x1C06A5EC5433C60D, 0xDAA16406F5A40000,
+    0x118427B3B4A05BC8, 0xA8A4DE8459868000,
+    0x15E531A0A1C872BA, 0xD2CE16256FE82000,
+    0x1B5E7E08CA3A8F69, 0x87819BAECBE22800,
+    0x111B0EC57E6499A1, 0xF4B1014D3F6D5900,
+    0x1561D276DDFDC00A, 0x71DD41A08F48AF40,
+    0x1ABA4714957D300D, 0x0E549208B31ADB10,
+    0x10B46C6CDD6E3E08, 0x28F4DB456FF0C8EA,
+    0x14E1878814C9CD8A, 0x33321216CBECFB24,
+    0x1A19E96A19FC40EC, 0xBFFE969C7EE839ED,
+    0x105031E2503DA893, 0xF7FF1E21CF512434,
+    0x14643E5AE44D12B8, 0xF5FEE5AA43256D41,
+    0x197D4DF19D605767, 0x337E9F14D3EEC892,
+    0x1FDCA16E04B86D41, 0x005E46DA08EA7AB6,
+    0x13E9E4E4C2F34448, 0xA03AEC4845928CB2,
+    0x18E45E1DF3B0155A, 0xC849A75A56F72FDE,
+    0x1F1D75A5709C1AB1, 0x7A5C1130ECB4FBD6,
+    0x13726987666190AE, 0xEC798ABE93F11D65,
+    0x184F03E93FF9F4DA, 0xA797ED6E38ED64BF,
+    0x1E62C4E38FF87211, 0x517DE8C9C728BDEF,
+    0x12FDBB0E39FB474A, 0xD2EEB17E1C7976B5,
+    0x17BD29D1C87A191D, 0x87AA5DDDA397D462,
+    0x1DAC74463A989F64, 0xE994F5550C7DC97B,
+    0x128BC8ABE49F639F, 0x11FD195527CE9DED,
+    0x172EBAD6DDC73C86, 0xD67C5FAA71C24568,
+    0x1CFA698C95390BA8, 0x8C1B77950E32D6C2,
+    0x121C81F7DD43A749, 0x57912ABD28DFC639,
+    0x16A3A275D494911B, 0xAD75756C7317B7C8,
+    0x1C4C8B1349B9B562, 0x98D2D2C78FDDA5BA,
+    0x11AFD6EC0E14115D, 0x9F83C3BCB9EA8794,
+    0x161BCCA7119915B5, 0x0764B4ABE8652979,
+    0x1BA2BFD0D5FF5B22, 0x493DE1D6E27E73D7,
+    0x1145B7E285BF98F5, 0x6DC6AD264D8F0866,
+    0x159725DB272F7F32, 0xC938586FE0F2CA80,
+    0x1AFCEF51F0FB5EFF, 0x7B866E8BD92F7D20,
+    0x10DE1593369D1B5F, 0xAD34051767BDAE34,
+    0x15159AF804446237, 0x9881065D41AD19C1,
+    0x1A5B01B605557AC5, 0x7EA147F492186032,
+    0x1078E111C3556CBB, 0x6F24CCF8DB4F3C1F,
+    0x14971956342AC7EA, 0x4AEE003712230B27,
+    0x19BCDFABC13579E4, 0xDDA98044D6ABCDF0,
+    0x10160BCB58C16C2F, 0x0A89F02B062B60B6,
+    0x141B8EBE2EF1C73A, 0xCD2C6C35C7B638E4,
+    0x1922726DBAAE3909, 0x8077874339A3C71D,
+    0x1F6B0F092959C74B, 0xE0956914080CB8E4,
+    0x13A2E965B9D81C8F, 0x6C5D61AC8507F38E,
+    0x188BA3BF284E23B3, 0x4774BA17A649F072,
+    0x1EAE8CAEF261ACA0, 0x1951E89D8FDC6C8F,
+    0x132D17ED577D0BE4, 0x0FD3316279E9C3D9,
+    0x17F85DE8AD5C4EDD, 0x13C7FDBB186434CF,
+    0x1DF67562D8B36294, 0x58B9FD29DE7D4203,
+    0x12BA095DC7701D9C, 0xB7743E3A2B0E4942,
+    0x17688BB5394C2503, 0xE5514DC8B5D1DB92,
+    0x1D42AEA2879F2E44, 0xDEA5A13AE3465277,
+    0x1249AD2594C37CEB, 0x0B2784C4CE0BF38A,
+    0x16DC186EF9F45C25, 0xCDF165F6018EF06D,
+    0x1C931E8AB871732F, 0x416DBF7381F2AC88,
+    0x11DBF316B346E7FD, 0x88E497A83137ABD5,
+    0x1652EFDC6018A1FC, 0xEB1DBD923D8596CA,
+    0x1BE7ABD3781ECA7C, 0x25E52CF6CCE6FC7D,
+    0x1170CB642B133E8D, 0x97AF3C1A40105DCE,
+    0x15CCFE3D35D80E30, 0xFD9B0B20D0147542,
+    0x1B403DCC834E11BD, 0x3D01CDE904199292,
+    0x1108269FD210CB16, 0x462120B1A28FFB9B,
+    0x154A3047C694FDDB, 0xD7A968DE0B33FA82,
+    0x1A9CBC59B83A3D52, 0xCD93C3158E00F923,
+    0x10A1F5B813246653, 0xC07C59ED78C09BB6,
+    0x14CA732617ED7FE8, 0xB09B7068D6F0C2A3,
+    0x19FD0FEF9DE8DFE2, 0xDCC24C830CACF34C,
+    0x103E29F5C2B18BED, 0xC9F96FD1E7EC180F,
+    0x144DB473335DEEE9, 0x3C77CBC661E71E13,
+    0x1961219000356AA3, 0x8B95BEB7FA60E598,
+    0x1FB969F40042C54C, 0x6E7B2E65F8F91EFE,
+    0x13D3E2388029BB4F, 0xC50CFCFFBB9BB35F,
+    0x18C8DAC6A0342A23, 0xB6503C3FAA82A037,
+    0x1EFB1178484134AC, 0xA3E44B4F95234844,
+    0x135CEAEB2D28C0EB, 0xE66EAF11BD360D2B,
+    0x183425A5F872F126, 0xE00A5AD62C839075,
+    0x1E412F0F768FAD70, 0x980CF18BB7A47493,
+    0x12E8BD69AA19CC66, 0x5F0816F752C6C8DC,
+    0x17A2ECC414A03F7F, 0xF6CA1CB527787B13,
+    0x1D8BA7F519C84F5F, 0xF47CA3E2715699D7,
+    0x127748F9301D319B, 0xF8CDE66D86D62026,
+    0x17151B377C247E02, 0xF7016008E88BA830,
+    0x1CDA62055B2D9D83, 0xB4C1B80B22AE923C,
+    0x12087D4358FC8272, 0x50F91306F5AD1B65,
+    0x168A9C942F3BA30E, 0xE53757C8B318623F,
+    0x1C2D43B93B0A8BD2, 0x9E852DBADFDE7ACF,
+    0x119C4A53C4E69763, 0xA3133C94CBEB0CC1,
+    0x16035CE8B6203D3C, 0x8BD80BB9FEE5CFF1,
+    0x1B843422E3A84C8B, 0xAECE0EA87E9F43EE,
+    0x1132A095CE492FD7, 0x4D40C9294F238A75,
+    0x157F48BB41DB7BCD, 0x2090FB73A2EC6D12,
+    0x1ADF1AEA12525AC0, 0x68B53A508BA78856,
+    0x10CB70D24B7378B8, 0x417144725748B536,
+    0x14FE4D06DE5056E6, 0x51CD958EED1AE283,
+    0x1A3DE04895E46C9F, 0xE640FAF2A8619B24,
+    0x1066AC2D5DAEC3E3, 0xEFE89CD7A93D00F7,
+    0x14805738B51A74DC, 0xEBE2C40D938C4134,
+    0x19A06D06E2611214, 0x26DB7510F86F5181,
+    0x100444244D7CAB4C, 0x9849292A9B4592F1,
+    0x1405552D60DBD61F, 0xBE5B73754216F7AD,
+    0x1906AA78B912CBA7, 0xADF25052929CB598,
+    0x1F485516E7577E91, 0x996EE4673743E2FF,
+    0x138D352E5096AF1A, 0xFFE54EC0828A6DDF,
+    0x18708279E4BC5AE1, 0xBFDEA270A32D0957,
+    0x1E8CA3185DEB719A, 0x2FD64B0CCBF84BAD,
+    0x1317E5EF3AB32700, 0x5DE5EEE7FF7B2F4C,
+    0x17DDDF6B095FF0C0, 0x755F6AA1FF59FB1F,
+    0x1DD55745CBB7ECF0, 0x92B7454A7F3079E7,
+    0x12A5568B9F52F416, 0x5BB28B4E8F7E4C30,
+    0x174EAC2E8727B11B, 0xF29F2E22335DDF3C,
+    0x1D22573A28F19D62, 0xEF46F9AAC035570B,
+    0x123576845997025D, 0xD58C5C0AB8215667,
+    0x16C2D4256FFCC2F5, 0x4AEF730D6629AC01,
+    0x1C73892ECBFBF3B2, 0x9DAB4FD0BFB41701,
+    0x11C835BD3F7D784F, 0xA28B11E277D08E60,
+    0x163A432C8F5CD663, 0x8B2DD65B15C4B1F9,
+    0x1BC8D3F7B3340BFC, 0x6DF94BF1DB35DE77,
+    0x115D847AD000877D, 0xC4BBCF772901AB0A,
+    0x15B4E5998400A95D, 0x35EAC354F34215CD,
+    0x1B221EFFE500D3B4, 0x8365742A30129B40,
+    0x10F5535FEF208450, 0xD21F689A5E0BA108,
+    0x1532A837EAE8A565, 0x06A742C0F58E894A,
+    0x1A7F5245E5A2CEBE, 0x4851137132F22B9D,
+    0x108F936BAF85C136, 0xED32AC26BFD75B42,
+    0x14B378469B673184, 0xA87F57306FCD3212,
+    0x19E056584240FDE5, 0xD29F2CFC8BC07E97,
+    0x102C35F729689EAF, 0xA3A37C1DD7584F1E,
+    0x14374374F3C2C65B, 0x8C8C5B254D2E62E6,
+    0x1945145230B377F2, 0x6FAF71EEA079FB9F,
+    0x1F965966BCE055EF, 0x0B9B4E6A48987A87,
+    0x13BDF7E0360C35B5, 0x674111026D5F4C94,
+    0x18AD75D8438F4322, 0xC111554308B71FBA,
+    0x1ED8D34E547313EB, 0x7155AA93CAE4E7A8,
+    0x13478410F4C7EC73, 0x26D58A9C5ECF10C9,
+    0x1819651531F9E78F, 0xF08AED437682D4FB,
+    0x1E1FBE5A7E786173, 0xECADA89454238A3A,
+    0x12D3D6F88F0B3CE8, 0x73EC895CB4963664,
+    0x1788CCB6B2CE0C22, 0x90E7ABB3E1BBC3FD,
+    0x1D6AFFE45F818F2B, 0x352196A0DA2AB4FD,
+    0x1262DFEEBBB0F97B, 0x0134FE24885AB11E,
+    0x16FB97EA6A9D37D9, 0xC1823DADAA715D65,
+    0x1CBA7DE5054485D0, 0x31E2CD19150DB4BF,
+    0x11F48EAF234AD3A2, 0x1F2DC02FAD2890F7,
+    0x1671B25AEC1D888A, 0xA6F9303B9872B535,
+    0x1C0E1EF1A724EAAD, 0x50B77C4A7E8F6282,
+    0x1188D357087712AC, 0x5272ADAE8F199D91,
+    0x15EB082CCA94D757, 0x670F591A32E004F6,
+    0x1B65CA37FD3A0D2D, 0x40D32F60BF980633,
+    0x111F9E62FE44483C, 0x4883FD9C77BF03E0,
+    0x156785FBBDD55A4B, 0x5AA4FD0395AEC4D8,
+    0x1AC1677AAD4AB0DE, 0x314E3C447B1A760E,
+    0x10B8E0ACAC4EAE8A, 0xDED0E5AACCF089C9,
+    0x14E718D7D7625A2D, 0x96851F15802CAC3B,
+    0x1A20DF0DCD3AF0B8, 0xFC2666DAE037D74A,
+    0x10548B68A044D673, 0x9D980048CC22E68E,
+    0x1469AE42C8560C10, 0x84FE005AFF2BA032,
+    0x198419D37A6B8F14, 0xA63D8071BEF6883E,
+    0x1FE52048590672D9, 0xCFCCE08E2EB42A4E,
+    0x13EF342D37A407C8, 0x21E00C58DD309A70,
+    0x18EB0138858D09BA, 0x2A580F6F147CC10D,
+    0x1F25C186A6F04C28, 0xB4EE134AD99BF150,
+    0x137798F428562F99, 0x7114CC0EC80176D2,
+    0x18557F31326BBB7F, 0xCD59FF127A01D486,
+    0x1E6ADEFD7F06AA5F, 0xC0B07ED7188249A8,
+    0x1302CB5E6F642A7B, 0xD86E4F466F516E09,
+    0x17C37E360B3D351A, 0xCE89E3180B25C98B,
+    0x1DB45DC38E0C8261, 0x822C5BDE0DEF3BEE,
+    0x1290BA9A38C7D17C, 0xF15BB96AC8B58575,
+    0x1734E940C6F9C5DC, 0x2DB2A7C57AE2E6D2,
+    0x1D022390F8B83753, 0x391F51B6D99BA086,
+    0x1221563A9B732294, 0x03B3931248014454,
+    0x16A9ABC9424FEB39, 0x04A077D6DA019569,
+    0x1C5416BB92E3E607, 0x45C895CC9081FAC3,
+    0x11B48E353BCE6FC4, 0x8B9D5D9FDA513CBA,
+    0x1621B1C28AC20BB5, 0xAE84B507D0E58BE8,
+    0x1BAA1E332D728EA3, 0x1A25E249C51EEEE3,
+    0x114A52DFFC679925, 0xF057AD6E1B33554D,
+    0x159CE797FB817F6F, 0x6C6D98C9A2002AA1,
+    0x1B04217DFA61DF4B, 0x4788FEFC0A803549,
+    0x10E294EEBC7D2B8F, 0x0CB59F5D8690214E,
+    0x151B3A2A6B9C7672, 0xCFE30734E83429A1,
+    0x1A6208B50683940F, 0x83DBC9022241340A,
+    0x107D457124123C89, 0xB2695DA15568C086,
+    0x149C96CD6D16CBAC, 0x1F03B509AAC2F0A7,
+    0x19C3BC80C85C7E97, 0x26C4A24C1573ACD1,
+    0x101A55D07D39CF1E, 0x783AE56F8D684C03,
+    0x1420EB449C8842E6, 0x16499ECB70C25F03,
+    0x19292615C3AA539F, 0x9BDC067E4CF2F6C4,
+    0x1F736F9B3494E887, 0x82D3081DE02FB476,
+    0x13A825C100DD1154, 0xB1C3E512AC1DD0C9,
+    0x18922F31411455A9, 0xDE34DE57572544FC,
+    0x1EB6BAFD91596B14, 0x55C215ED2CEE963B,
+    0x133234DE7AD7E2EC, 0xB5994DB43C151DE5,
+    0x17FEC216198DDBA7, 0xE2FFA1214B1A655E,
+    0x1DFE729B9FF15291, 0xDBBF89699DE0FEB6,
+    0x12BF07A143F6D39B, 0x2957B5E202AC9F31,
+    0x176EC98994F48881, 0xF3ADA35A8357C6FE,
+    0x1D4A7BEBFA31AAA2, 0x70990C31242DB8BD,
+    0x124E8D737C5F0AA5, 0x865FA79EB69C9376,
+    0x16E230D05B76CD4E, 0xE7F791866443B854,
+    0x1C9ABD04725480A2, 0xA1F575E7FD54A669,
+    0x11E0B622C774D065, 0xA53969B0FE54E801,
+    0x1658E3AB7952047F, 0x0E87C41D3DEA2202,
+    0x1BEF1C9657A6859E, 0xD229B5248D64AA82,
+    0x117571DDF6C81383, 0x435A1136D85EEA91,
+    0x15D2CE55747A1864, 0x143095848E76A536,
+    0x1B4781EAD1989E7D, 0x193CBAE5B2144E83,
+    0x110CB132C2FF630E, 0x2FC5F4CF8F4CB112,
+    0x154FDD7F73BF3BD1, 0xBBB77203731FDD56,
+    0x1AA3D4DF50AF0AC6, 0x2AA54E844FE7D4AC,
+    0x10A6650B926D66BB, 0xDAA75112B1F0E4EB,
+    0x14CFFE4E7708C06A, 0xD15125575E6D1E26,
+    0x1A03FDE214CAF085, 0x85A56EAD360865B0,
+    0x10427EAD4CFED653, 0x7387652C41C53F8E,
+    0x14531E58A03E8BE8, 0x50693E7752368F71,
+    0x1967E5EEC84E2EE2, 0x64838E1526C4334E,
+    0x1FC1DF6A7A61BA9A, 0xFDA4719A70754022,
+    0x13D92BA28C7D14A0, 0xDE86C70086494815,
+    0x18CF768B2F9C59C9, 0x162878C0A7DB9A1A,
+    0x1F03542DFB83703B, 0x5BB296F0D1D280A1,
+    0x1362149CBD322625, 0x194F9E5683239064,
+    0x183A99C3EC7EAFAE, 0x5FA385EC23EC747E,
+    0x1E494034E79E5B99, 0xF78C67672CE7919D,
+    0x12EDC82110C2F940, 0x3AB7C0A07C10BB02,
+    0x17A93A2954F3B790, 0x4965B0C89B14E9C3,
+    0x1D9388B3AA30A574, 0x5BBF1CFAC1DA2433,
+    0x127C35704A5E6768, 0xB957721CB92856A0,
+    0x171B42CC5CF60142, 0xE7AD4EA3E7726C48,
+    0x1CE2137F74338193, 0xA198A24CE14F075A,
+    0x120D4C2FA8A030FC, 0x44FF65700CD16498,
+    0x16909F3B92C83D3B, 0x563F3ECC1005BDBE,
+    0x1C34C70A777A4C8A, 0x2BCF0E7F14072D2E,
+    0x11A0FC668AAC6FD6, 0x5B61690F6C847C3D,
+    0x16093B802D578BCB, 0xF239C35347A59B4C,
+    0x1B8B8A6038AD6EBE, 0xEEC83428198F021F,
+    0x1137367C236C6537, 0x553D20990FF96153,
+    0x1585041B2C477E85, 0x2A8C68BF53F7B9A8,
+    0x1AE64521F7595E26, 0x752F82EF28F5A812,
+    0x10CFEB353A97DAD8, 0x093DB1D57999890B,
+    0x1503E602893DD18E, 0x0B8D1E4AD7FFEB4E,
+    0x1A44DF832B8D45F1, 0x8E7065DD8DFFE622,
+    0x106B0BB1FB384BB6, 0xF9063FAA78BFEFD5,
+    0x1485CE9E7A065EA4, 0xB747CF9516EFEBCA,
+    0x19A742461887F64D, 0xE519C37A5CABE6BD,
+    0x1008896BCF54F9F0, 0xAF301A2C79EB7036,
+    0x140AABC6C32A386C, 0xDAFC20B798664C43,
+    0x190D56B873F4C688, 0x11BB28E57E7FDF54,
+    0x1F50AC6690F1F82A, 0x1629F31EDE1FD72A,
+    0x13926BC01A973B1A, 0x4DDA37F34AD3E67A,
+    0x187706B0213D09E0, 0xE150C5F01D88E019,
+    0x1E94C85C298C4C59, 0x19A4F76C24EB181F,
+    0x131CFD3999F7AFB7, 0xB0071AA39712EF13,
+    0x17E43C8800759BA5, 0x9C08E14C7CD7AAD8,
+    0x1DDD4BAA0093028F, 0x030B199F9C0D958E,
+    0x12AA4F4A405BE199, 0x61E6F003C1887D79,
+    0x1754E31CD072D9FF, 0xBA60AC04B1EA9CD7,
+    0x1D2A1BE4048F907F, 0xA8F8D705DE65440D,
+    0x123A516E82D9BA4F, 0xC99B8663AAFF4A88,
+    0x16C8E5CA239028E3, 0xBC0267FC95BF1D2A,
+    0x1C7B1F3CAC74331C, 0xAB0301FBBB2EE474,
+    0x11CCF385EBC89FF1, 0xEAE1E13D54FD4EC9,
+    0x1640306766BAC7EE, 0x659A598CAA3CA27B,
+    0x1BD03C81406979E9, 0xFF00EFEFD4CBCB1A,
+    0x116225D0C841EC32, 0x3F6095F5E4FF5EF0,
+    0x15BAAF44FA52673E, 0xCF38BB735E3F36AC,
+    0x1B295B1638E7010E, 0x8306EA5035CF0457,
+    0x10F9D8EDE39060A9, 0x11E4527221A162B6,
+    0x15384F295C7478D3, 0x565D670EAA09BB64,
+    0x1A8662F3B3919708, 0x2BF4C0D2548C2A3D,
+    0x1093FDD8503AFE65, 0x1B78F88374D79A66,
+    0x14B8FD4E6449BDFE, 0x625736A4520D8100,
+    0x19E73CA1FD5C2D7D, 0xFAED044D6690E140,
+    0x103085E53E599C6E, 0xBCD422B0601A8CC8,
+    0x143CA75E8DF0038A, 0x6C092B5C78212FFA,
+    0x194BD136316C046D, 0x070B763396297BF8,
+    0x1F9EC583BDC70588, 0x48CE53C07BB3DAF6,
+    0x13C33B72569C6375, 0x2D80F4584D5068DA,
+    0x18B40A4EEC437C52, 0x78E1316E60A48310
+};
+
+// 2^k / 5^q for q from 0 to _SET_POW5INVSPLITCOUNT - 1 rounded up, k is chosen so they have _SET_POW5INVBITS bits, the high word comes first
+const uint64_t _SET_Pow5InvSplit[2 * _SET_POW5INVSPLITCOUNT] = {
+    0x2000000000000000, 0x0000000000000001,
+    0x1999999999999999, 0x999999999999999A,
+    0x147AE147AE147AE1, 0x47AE147AE147AE15,
+    0x10624DD2F1A9FBE7, 0x6C8B4395810624DE,
+    0x1A36E2EB1C432CA5, 0x7A786C226809D496,
+    0x14F8B588E368F084, 0x61F9F01B866E43AB,
+    0x10C6F7A0B5ED8D36, 0xB4C7F34938583622,
+    0x1AD7F29ABCAF4857, 0x87A6520EC08D236A,
+    0x15798EE2308C39DF, 0x9FB841A566D74F88,
+    0x112E0BE826D694B2, 0xE62D01511F12A607,
+    0x1B7CDFD9D7BDBAB7, 0xD6AE6881CB5109A4,
+    0x15FD7FE17964955F, 0xDEF1ED34A2A73AEA,
+    0x119799812DEA1119, 0x7F27F0F6E885C8BB,
+    0x1C25C268497681C2, 0x650CB4BE40D60DF8,
+    0x16849B86A12B9B01, 0xEA70909833DE7193,
+    0x1203AF9EE756159B, 0x21F3A6E0297EC143,
+    0x1CD2B297D889BC2B, 0x6985D7CD0F313537,
+    0x170EF54646D49689, 0x2137DFD73F5A90F9,
+    0x12725DD1D243ABA0, 0xE75FE645CC4873FA,
+    0x1D83C94FB6D2AC34, 0xA5663D3C7A0D865D,
+    0x179CA10C9242235D, 0x511E976394D79EB1,
+    0x12E3B40A0E9B4F7D, 0xDA7EDF82DD794BC1,
+    0x1E392010175EE596, 0x2A6498D1625BAC68,
+    0x182DB34012B25144, 0xEEB6E0A781E2F053,
+    0x1357C299A88EA76A, 0x58924D52CE4F26A9,
+    0x1EF2D0F5DA7DD8AA, 0x27507BB7B07EA441,
+    0x18C240C4AECB13BB, 0x52A6C95FC0655034,
+    0x13CE9A36F23C0FC9, 0x0EEBD44C99EAA690,
+    0x1FB0F6BE50601941, 0xB17953ADC3110A80,
+    0x195A5EFEA6B34767, 0xC12DDC8B02740867,
+    0x14484BFEEBC29F86, 0x3424B06F3529A052,
+    0x1039D66589687F9E, 0x901D59F290EE19DB,
+    0x19F623D5A8A73297, 0x4CFBC31DB4B0295F,
+    0x14C4E977BA1F5BAC, 0x3D9635B15D59BAB2,
+    0x109D8792FB4C4956, 0x97AB5E277DE16228,
+    0x1A95A5B7F87A0EF0, 0xF2ABC9D8C9689D0D,
+    0x154484932D2E725A, 0x5BBCA17A3ABA173E,
+    0x11039D428A8B8EAE, 0xAFCA1AC82EFB45CB,
+    0x1B38FB9DAA78E44A, 0xB2DCF7A6B1920945,
+    0x15C72FB1552D836E, 0xF57D92EBC141A104,
+    0x116C262777579C58, 0xC46475896767B403,
+    0x1BE03D0BF225C6F4, 0x6D6D88DBD8A5ECD2,
+    0x164CFDA3281E38C3, 0x8ABE071646EB23DB,
+    0x11D7314F534B609C, 0x6EFE6C11D255B649,
+    0x1C8B821885456760, 0xB197134FB6EF8A0E,
+    0x16D601AD376AB91A, 0x27AC0F72F8BFA1A5,
+    0x1244CE242C5560E1, 0xB95672C260994E1E,
+    0x1D3AE36D13BBCE35, 0xF5571E03CDC21695,
+    0x17624F8A762FD82B, 0x2AAC18030B01ABAB,
+    0x12B50C6EC4F31355, 0xBBBCE0026F348956,
+    0x1DEE7A4AD4B81EEF, 0x92C7CCD0B1EDA889,
+    0x17F1FB6F10934BF2, 0xDBD30A408E57BA07,
+    0x1327FC58DA0F6FF5, 0x7CA8D50071DFC806,
+    0x1EA6608E29B24CBB, 0xFAA7BB33E9660CD6,
+    0x18851A0B548EA3C9, 0x9552FC298784D711,
+    0x139DAE6F76D88307, 0xAAA8C9BAD2D0AC0E,
+    0x1F62B0B257C0D1A5, 0xDDDADC5E1E1AACE3,
+    0x191BC08EAC9A4151, 0x7E48B04B4B488A4F,
+    0x141633A556E1CDDA, 0xCB6D59D5D5D3A1D9,
+    0x1011C2EAABE7D7E2, 0x3C577B1177DC817B,
+    0x19B604AAACA62636, 0xC6F25E825960CF2A,
+    0x14919D5556EB51C5, 0x6BF518684780A5BB,
+    0x10747DDDDF22A7D1, 0x232A79ED06008496,
+    0x1A53FC9631D10C81, 0xD1DD8FE1A3340756,
+    0x150FFD44F4A73D34, 0xA7E4731AE8F66C45,
+    0x10D9976A5D52975D, 0x531D28E253F8569E,
+    0x1AF5BF109550F22E, 0xEB61DB03B98D5762,
+    0x159165A6DDDA5B58, 0xBC4E48CFC7A445E8,
+    0x11411E1F17E1E2AD, 0x6371D3D96C836B20,
+    0x1B9B6364F3030448, 0x9F1C8628AD9F11CD,
+    0x1615E91D8F359D06, 0xE5B06B53BE18DB0B,
+    0x11AB20E472914A6B, 0xEAF3890FCB4715A2,
+    0x1C45016D841BAA46, 0x44B8DB4C7871BC37,
+    0x169D9ABE03495505, 0x03C715D6C6C1635F,
+    0x1217AEFE69077737, 0x3638DE456BCDE919,
+    0x1CF2B1970E725858, 0x56C163A2461641C1,
+    0x17288E1271F51379, 0xDF011C81D1AB67CE,
+    0x1286D80EC190DC61, 0x7F3416CE4155ECA5,
+    0x1DA48CE468E7C702, 0x6520247D3556476E,
+    0x17B6D71D20B96C01, 0xEA801D30F7783925,
+    0x12F8AC174D612334, 0xBB99B0F3F92CFA84,
+    0x1E5AACF215683854, 0x5F5C4E532847F739,
+    0x18488A5B44536043, 0x7F7D0B75B9D32C2E,
+    0x136D3B7C36A919CF, 0x9930D5F7C7DC2358,
+    0x1F152BF9F10E8FB2, 0x8EB4898C72F9D226,
+    0x18DDBCC7F40BA628, 0x722A07A38F2E41B8,
+    0x13E497065CD61E86, 0xC1BB394FA5BE9AFA,
+    0x1FD424D6FAF030D7, 0x9C5EC2190930F7F6,
+    0x197683DF2F268D79, 0x49E56814075A5FF8,
+    0x145ECFE5BF520AC7, 0x6E51201005E1E660,
+    0x104BD984990E6F05, 0xF1DA800CD181851A,
+    0x1A12F5A0F4E3E4D6, 0x4FC400148268D4F5,
+    0x14DBF7B3F71CB711, 0xD96999AA01ED772B,
+    0x10AFF95CC5B09274, 0xADEE1488018AC5BC,
+    0x1AB328946F80EA54, 0x497CEDA668DE092C,
+    0x155C2076BF9A5510, 0x3ACA57B853E4D424,
+    0x1116805EFFAEAA73, 0x623B7960431D7683,
+    0x1B5733CB32B110B8, 0x9D2BF566D1C8BD9E,
+    0x15DF5CA28EF40D60, 0x7DBCC452416D647F,
+    0x117F7D4ED8C33DE6, 0xCAFD69DB678AB6CC,
+    0x1BFF2EE48E052FD7, 0xAB2F0FC572778ADF,
+    0x1665BF1D3E6A8CAC, 0x88F273045B92D580,
+    0x11EAFF4A98553D56, 0xD3F528D049424466,
+    0x1CAB3210F3BB9557, 0xB988414D4203A0A3,
+    0x16EF5B40C2FC7779, 0x6139CDD76802E6E9,
+    0x125915CD68C9F92D, 0xE761717920025254,
+    0x1D5B561574765B7C, 0xA568B58E999D5086,
+    0x177C44DDF6C515FD, 0x5120913EE14AA6D2,
+    0x12C9D0B1923744CA, 0xA74D40FF1AA21F0E,
+    0x1E0FB44F50586E11, 0x0BAECE64F769CB4A,
+    0x180C903F7379F1A7, 0x3C8BD850C5EE3C3B,
+    0x133D4032C2C7F485, 0xCA0979DA37F1C9C9,
+    0x1EC866B79E0CBA6F, 0xA9A8C2F6BFE942DB,
+    0x18A0522C7E709526, 0x2153CF2BCCBA9BE3,
+    0x13B374F06526DDB8, 0x1AA9728970954982,
+    0x1F8587E7083E2F8C, 0xF775840F1A88759D,
+    0x19379FEC0698260A, 0x5F9136727BA05E17,
+    0x142C7FF0054684D5, 0x1940F85B9619E4DF,
+    0x1023998CD1053710, 0xE100C6AFAB47EA4C,
+    0x19D28F47B4D524E7, 0xCE67A44C453FDD47,
+    0x14A8729FC3DDB71F, 0xD852E9D69DCCB106,
+    0x1086C219697E2C19, 0x79DBEE454B0A2738,
+    0x1A71368F0F30468F, 0x295FE3A211A9D859,
+    0x15275ED8D8F36BA5, 0xBAB31C81A7BB137A,
+    0x10EC4BE0AD8F8951, 0x6228E39AEC95A92F,
+    0x1B13AC9AAF4C0EE8, 0x9D0E38F7E0EF7517,
+    0x15A956E225D67253, 0xB0D82D931A592A79,
+    0x11544581B7DEC1DC, 0x8D79BE0F4847552E,
+    0x1BBA08CF8C979C94, 0x158F967EDA0BBB7C,
+    0x162E6D72D6DFB076, 0x77A611FF14D62F97,
+    0x11BEBDF578B2F391, 0xF951A7FF43DE8C79,
+    0x1C6463225AB7EC1C, 0xC21C3FFED2FDAD8E,
+    0x16B6B5B5155FF017, 0x01B0333242648AD8,
+    0x122BC490DDE659AC, 0x0159C28E9B83A246,
+    0x1D12D41AFCA3C2AC, 0xCEF604175F3903A3,
+    0x17424348CA1C9BBD, 0x725E69AC4C2D9C83,
+    0x129B69070816E2FD, 0xF5185489D68AE39C,
+    0x1DC574D80CF16B2F, 0xEE8D540FBDAB05C6,
+    0x17D12A4670C1228C, 0xBED77672FE226B05,
+    0x130DBB6B8D674ED6, 0xFF12C528CB4EBC04,
+    0x1E7C5F127BD87E24, 0xCB513B74787DF9A0,
+    0x18637F41FCAD31B7, 0x090DC929F9FE614D,
+    0x1382CC34CA2427C5, 0xA0D7D42194CB810A,
+    0x1F37AD21436D0C6F, 0x67BFB9CF5478CE77,
+    0x18F9574DCF8A7059, 0x1FCC94A5DD2D71F9,
+    0x13FAAC3E3FA1F37A, 0x7FD6DD517DBDF4C7,
+    0x1FF779FD329CB8C3, 0xFFBE2EE8C92FEE0B,
+    0x1992C7FDC216FA36, 0x6631BF20A0F324D6,
+    0x14756CCB01ABFB5E, 0xB827CC1A1A5C1D78,
+    0x105DF0A267BCC918, 0x935309AE7B7CE460,
+    0x1A2FE76A3F9474F4, 0x1EEB42B0C594A099,
+    0x14F31F8832DD2A5C, 0xE58902270476E6E1,
+    0x10C27FA028B0EEB0, 0xB7A0CE859D2BEBE7,
+    0x1AD0CC33744E4AB4, 0x59014A6F61DFDFD8,
+    0x1573D68F903EA229, 0xE0CDD525E7E64CAD,
+    0x11297872D9CBB4EE, 0x4D7177518651D6F1,
+    0x1B758D848FAC54B0, 0x7BE8BEE8D6E957E8,
+    0x15F7A46A0C89DD59, 0xFCBA3253DF211320,
+    0x1192E9EE706E4AAE, 0x63C8284318E74280,
+    0x1C1E43171A4A1117, 0x060D0D3827D86A66,
+    0x167E9C127B6E7412, 0x6B3DA42CECAD21EB,
+    0x11FEE341FC585CDB, 0x88FE1CF0BD574E56,
+    0x1CCB0536608D615F, 0x419694B462254A23,
+    0x1708D0F84D3DE77F, 0x67ABAA29E81DD4E9,
+    0x126D73F9D764B932, 0xB95621BB2017DD87,
+    0x1D7BECC2F23AC1EA, 0xC223692B668C95A5,
+    0x179657025B6234BB, 0xCE82BA891ED6DE1D,
+    0x12DEAC01E2B4F6FC, 0xA53562074BDF1818,
+    0x1E3113363787F194, 0x3B889CD87964F359,
+    0x18274291C6065ADC, 0xFC6D4A46C783F5E1,
+    0x13529BA7D19EAF17, 0x30576E9F06032B1A,
+    0x1EEA92A61C311825, 0x1A257DCB3CD1DE90,
+    0x18BBA884E35A79B7, 0x481DFE3C30A7E540,
+    0x13C9539D82AEC7C5, 0xD34B31C9C0865100,
+    0x1FA885C8D117A609, 0x5211E942CDA3B4CD,
+    0x19539E3A40DFB807, 0x74DB21023E1C90A4,
+    0x1442E4FB67196005, 0xF715B401CB4A0D50,
+    0x103583FC527AB337, 0xF8DE299B09080AA7,
+    0x19EF3993B72AB859, 0x8E304291A80CDDD7,
+    0x14BF6142F8EEF9E1, 0x3E8D020E200A4B13,
+    0x10991A9BFA58C7E7, 0x653D9B3E80083C0F,
+    0x1A8E90F9908E0CA5, 0x6EC8F864000D2CE4,
+    0x153EDA614071A3B7, 0x8BD3F9E999A423EA,
+    0x10FF151A99F482F9, 0x3CA994BAE1501CBB,
+    0x1B31BB5DC320D18E, 0xC775BAC49BB3612B,
+    0x15C162B168E70E0B, 0xD2C4956A16291A89,
+    0x11678227871F3E6F, 0xDBD0778811BA7BA1,
+    0x1BD8D03F3E9863E6, 0x2C80BF401C5D929B,
+    0x16470CFF6546B651, 0xBD33CC3349E47549,
+    0x11D270CC51055EA7, 0xCA8FD68F6E505DD4,
+    0x1C83E7AD4E6EFDD9, 0x4419574BE3B3C953,
+    0x16CFEC8AA52597E1, 0x0347790982F63AA9,
+    0x123FF06EEA847980, 0xCF6C60D468C4FBBA,
+    0x1D331A4B10D3F59A, 0xE57A34870E07F92A,
+    0x175C1508DA432AE2, 0x512E906C0B399422,
+    0x12B010D3E1CF5581, 0xDA8BA6BCD5C7A9B5,
+    0x1DE6815302E5559C, 0x90DF712E22D90F87,
+    0x17EB9AA8CF1DDE16, 0xDA4C5A8B4F140C6C,
+    0x1322E220A5B17E78, 0xAEA37BA2A5A9A38A,
+    0x1E9E369AA2B59727, 0x7DD25F6AA2A905A9,
+    0x187E92154EF7AC1F, 0x97DB7F888220D154,
+    0x139874DDD8C6234C, 0x797C6606CE80A777,
+    0x1F5A549627A36BAD, 0x8F2D700AE4010BF1,
+    0x191510781FB5EFBE, 0x0C2459A25000D65A,
+    0x1410D9F9B2F7F2FE, 0x701D1481D99A4515,
+    0x100D7B2E28C65BFE, 0xC017439B147B6A77,
+    0x19AF2B7D0E0A2CCA, 0xCCF205C4ED9243F2,
+    0x148C22CA71A1BD6F, 0x0A5B37D0BE0E9CC2,
+    0x10701BD527B4978C, 0x0848F973CB3EE3CE,
+    0x1A4CF9550C5425AC, 0xDA0E5BEC78649FB0,
+    0x150A6110D6A9B7BD, 0x7B3EAFF060507FC0,
+    0x10D51A73DEEE2C97, 0x95CBBFF380406633,
+    0x1AEE90B964B04758, 0xEFAC665266CD7052,
+    0x158BA6FAB6F36C47, 0x2623850EB8A459DB,
+    0x113C85955F29236C, 0x1E82D0D893B6AE49,
+    0x1B9408EEFEA838AC, 0xFD9E1AF41F8AB075,
+    0x16100725988693BD, 0x97B1AF29B2D559F7,
+    0x11A66C1E139EDC97, 0xAC8E25BAF5777B2C,
+    0x1C3D79C9B8FE2DBF, 0x7A7D092B2258C513,
+    0x169794A160CB57CC, 0x61FDA0EF4EAD6A76,
+    0x1212DD4DE7091309, 0xE7FE1A590BBDEEC5,
+    0x1CEAFBAFD80E84DC, 0xA6635D5B45FCB13A,
+    0x172262F3133ED0B0, 0x851C4AAF6B308DC8,
+    0x1281E8C275CBDA26, 0xD0E36EF2BC26D7D4,
+    0x1D9CA79D894629D7, 0xB49F17EAC6A48C86,
+    0x17B08617A104EE46, 0x2A18DFEF0550706B,
+    0x12F39E794D9D8B6B, 0x54E0B3259DD9F389,
+    0x1E5297287C2F4578, 0x87CDEB6F62F65274,
+    0x18421286C9BF6AC6, 0xD30B22BF825EA85D,
+    0x13680ED23AFF889F, 0x0F3C1BCC684BB9E4,
+    0x1F0CE4839198DA98, 0x18602C7A4079296D,
+    0x18D71D360E13E213, 0x46B356C833942124,
+    0x13DF4A91A4DCB4DC, 0x388F78A029434DB6,
+    0x1FCBAA82A1612160, 0x5A7F2766A86BAF8A,
+    0x196FBB9BB44DB44D, 0x153285EBB9EFBFA2,
+    0x145962E2F6A4903D, 0xAA8ED189618C994E,
+    0x1047824F2BB6D9CA, 0xEED8A7A11AD6E10C,
+    0x1A0C03B1DF8AF611, 0x7E27729B5E249B45,
+    0x14D6695B193BF80D, 0xFE85F549181D4904,
+    0x10AB877C142FF9A4, 0xCB9E5DD4134AA0D0,
+    0x1AAC0BF9B9E65C3A, 0xDF63C9535211014D,
+    0x15566FFAFB1EB02F, 0x191CA10F74DA6771,
+    0x1111F32F2F4BC025, 0xADB080D92A4852C1,
+    0x1B4FEB7EB212CD09, 0x15E7348EAA0D5134,
+    0x15D98932280F0A6D, 0xAB1F5D3EEE710DC4,
+    0x117AD428200C0857, 0xBC1917658B8DA49D,
+    0x1BF7B9D9CCE00D59, 0x2CF4F23C127C3A94,
+    0x165FC7E170B33DE0, 0xF0C3F4FCDB969543,
+    0x11E6398126F5CB1A, 0x5A365D9716121103,
+    0x1CA38F350B22DE90, 0x9056FC24F01CE804,
+    0x16E93F5DA2824BA6, 0xD9DF301D8CE3ECD0,
+    0x125432B14ECEA2EB, 0xE17F59B13D8323DA,
+    0x1D53844EE47DD179, 0x68CBC2B52F38395C,
+    0x177603725064A794, 0x53D6355DBF602DE3,
+    0x12C4CF8EA6B6EC76, 0xA9782AB165E68B1C,
+    0x1E07B27DD78B13F1, 0x0F26AAB56FD744FA,
+    0x18062864AC6F4327, 0x3F52222ABFDF6A62,
+    0x1338205089F29C1F, 0x65DB4E88997F884E,
+    0x1EC033B40FEA9365, 0x6FC54A7428CC0D4A,
+    0x1899C2F673220F84, 0x596AA1F68709A43B,
+    0x13AE3591F5B4D936, 0xADEEE7F86C07B696,
+    0x1F7D228322BAF524, 0x497E3FF3E00C5756,
+    0x1930E868E89590E9, 0xD464FFF64CD6AC45,
+    0x14272053ED4473EE, 0x4383FFF83D7889D1,
+    0x101F4D0FF1038FF1, 0xCF9CCCC69793A174,
+    0x19CBAE7FE805B31C, 0x7F6147A425B90252,
+    0x14A2F1FFECD15C16, 0xCC4DD2E9B7C7350F,
+    0x10825B3323DAB012, 0x3D0B0F215FD290D9,
+    0x1A6A2B85062AB350, 0x61AB4B689950E7C1,
+    0x1521BC6A6B555C40, 0x4E22A2BA1440B967,
+    0x10E7C9EEBC4449CD, 0x0B4EE894DD009453,
+    0x1B0C764AC6D3A948, 0x1217DA87C800ED51,
+    0x15A391D56BDC876C, 0xDB46486CA000BDDA,
+    0x114FA7DDEFE39F8A, 0x490506BD4CCD64AF,
+    0x1BB2A62FE638FF43, 0xA8080AC87AE23AB1,
+    0x162884F31E93FF69, 0x5339A239FBE82EF4,
+    0x11BA03F5B20FFF87, 0x75C7B4FB2FECF25D,
+    0x1C5CD322B67FFF3F, 0x22D92191E647EA2E,
+    0x16B0A8E891FFFF65, 0xB57A8141850654F2,
+    0x1226ED86DB3332B7, 0xC4620101373843F5,
+    0x1D0B15A491EB8459, 0x3A366801F1F39FEE,
+    0x173C115074BC69E0, 0xFB5EB99B27F6198B,
+    0x129674405D6387E7, 0x2F7EFAE2865E7AD6,
+    0x1DBD86CD6238D971, 0xE597F7D0D6FD9156,
+    0x17CAD23DE82D7AC1, 0x8479930D78CADAAB,
+    0x1308A831868AC89A, 0xD06142712D6F1556,
+    0x1E74404F3DAADA91, 0x4D686A4EAF182222,
+    0x185D003F6488AEDA, 0xA453883EF279B4E8,
+    0x137D99CC506D58AE, 0xE9DC6CFF28615D87,
+    0x1F2F5C7A1A488DE4, 0xA960AE650D6895A4,
+    0x18F2B061AEA07183, 0xBAB3BEB73DED4483,
+    0x13F559E7BEE6C136, 0x2EF6322C318A9D36
+};
 
 #define _SET_TRUENAME "true"
 #define _SET_FALSENAME "false"
@@ -386,16 +1833,147 @@ SET_CodeStruct *_SET_SplitString(char *String);
 SET_DataTypeBase _SET_GetPossibleType(const char *Value);
 
 // Converts a code struct into a dictionary
-SET_DataStruct *_SET_ConvertStruct(const SET_CodeStruct *Struct);
+// Types: The names of the types from _SET_BuildTypeDict
+SET_DataStruct *_SET_ConvertStruct(const SET_CodeStruct *Struct, DIC_Dict *Types);
 
 // Converts a list from a string
-SET_DataList *_SET_ConvertList(const SET_CodeList *List, SET_DataType Type, uint8_t Depth);
+SET_DataList *_SET_ConvertList(const SET_CodeList *List, SET_DataType Type, uint8_t Depth, DIC_Dict *Types);
 
 // Converts a single value from a string
-SET_Data *_SET_ConvertValue(const SET_CodeValue *Value, SET_DataType Type, uint8_t Depth);
+SET_Data *_SET_ConvertValue(const SET_CodeValue *Value, SET_DataType Type, uint8_t Depth, DIC_Dict *Types);
+
+// Converts a value which is not a list or a struct
+// Data: The data to fill
+// Value: The string with the value
+// Arena: The arena to allocate strings from, NULL to use malloc
+bool _SET_ConvertScalar(SET_Data *Data, const char *Value, ARN_Arena *Arena);
+
+// Converts a value into the type it was declared with, does not convert lists
+// Data: The data to convert
+// Type: The declared type
+bool _SET_MatchType(SET_Data *Data, SET_DataType Type);
+
+// Finds the common type of all the elements of a list and converts them into it
+// List: The list with all elements filled in
+bool _SET_FinishList(SET_DataList *List);
+
+// Finds the type which both the common type of a list and the type of an element can be converted into, returns false if there is none
+// CommonType: The common type so far, it is updated
+// Type: The type of the element
+// Element: The position of the element, used for error messages
+bool _SET_MergeType(SET_DataType *CommonType, SET_DataType Type, size_t Element);
+
+// Skips spaces, newlines, tabs and comments
+// Stream: The stream to move forward
+void _SET_SkipBlank(SET_Stream *Stream);
+
+// Finds the length of the word at the start of a string, words stop at blanks, comments and the characters =;,*[]{}\"'
+// String: The string to look at
+size_t _SET_WordLength(const char *String);
+
+// Finds the first character at or after Pos which matters when skipping a value, that is brackets, quotes, slashes, ; and the end of the text
+// Block: The last block read, it is reused if Pos is inside it
+// Pos: The position to start at
+// Line: The number of newlines skipped is added to this
+static inline char *_SET_ScanStructural(SET_ScanBlock *Block, char *Pos, uint32_t *Line);
+
+// Finds the first character at or after Pos which cannot just be copied inside a string or char, that is quotes, backslashes, newlines, tabs, carriage returns and the end of the text
+// Block: The last block read, it is reused if Pos is inside it
+// Pos: The position to start at
+static inline char *_SET_ScanString(SET_ScanBlock *Block, char *Pos);
+
+#ifdef __SSE2__
+// Finds the classes of all characters in an aligned block
+// Block: The block to fill in
+// Start: The first character of the block, it must be aligned to _SET_SCANBLOCK
+static inline void _SET_ReadBlock(SET_ScanBlock *Block, const char *Start);
+#endif
+
+// Allocates memory for parsed data, from the arena of the stream if it has one
+// Stream: The stream the data is parsed from
+// Size: The number of bytes
+static inline void *_SET_StreamAlloc(SET_Stream *Stream, size_t Size);
+
+// Destroys data which could not be used, data in an arena is left for the arena
+// Stream: The stream the data was parsed from
+// Data: The data to destroy
+static inline void _SET_DiscardData(SET_Stream *Stream, SET_Data *Data);
+
+// Destroys a list which could not be used, lists in an arena are left for the arena
+// Stream: The stream the list was parsed from
+// List: The list to destroy
+static inline void _SET_DiscardDataList(SET_Stream *Stream, SET_DataList *List);
+
+// Destroys a struct which could not be used, structs in an arena are left for the arena
+// Stream: The stream the struct was parsed from
+// Struct: The struct to destroy
+static inline void _SET_DiscardDataStruct(SET_Stream *Stream, SET_DataStruct *Struct);
+
+// Frees the strings of a block of values which could not be used, strings in an arena are left for the arena
+// Stream: The stream the values were parsed from
+// Values: The values
+// Count: The number of values
+static inline void _SET_DiscardValues(SET_Stream *Stream, SET_Data *Values, size_t Count);
+
+// Destroys the values of a list of fields without freeing the list
+// Stream: The stream the fields were parsed from
+// Fields: The fields to destroy the values of
+// Count: The number of fields
+void _SET_DestroyStreamFields(SET_Stream *Stream, SET_StreamField *Fields, size_t Count);
+
+// Reads the type and name of a field up to and including the =, returns false on error
+// Stream: The stream to read from, it must be at the start of the field
+// Name: Returns the name of the field, it is terminated inside the text
+// Type: Returns the declared type, SET_DATATYPE_NONE if there was no type
+// PointerCount: Returns the number of pointers after the type
+bool _SET_ParseName(SET_Stream *Stream, char **Name, SET_DataType *Type, uint8_t *PointerCount);
+
+// Parses fields directly from the text into a dictionary, stops at } or at the end of the text
+// Stream: The stream to read from
+// Sub: True if it is a substruct which must end with }
+SET_DataStruct *_SET_ParseStruct(SET_Stream *Stream, bool Sub);
+
+// Reads the fields of a struct without creating the dictionary, stops at } or at the end of the text, returns false on error
+// Stream: The stream to read from
+// Sub: True if it is a substruct which must end with }
+// OutFields: Returns the fields, the list must be freed
+// OutCount: Returns the number of fields
+bool _SET_ParseFields(SET_Stream *Stream, bool Sub, SET_StreamField **OutFields, size_t *OutCount);
+
+// Creates the dictionary of a struct from its fields, the fields and their list are destroyed even on error
+// Stream: The stream the fields were read from
+// Fields: The fields
+// Count: The number of fields
+SET_DataStruct *_SET_CreateStruct(SET_Stream *Stream, SET_StreamField *Fields, size_t Count);
+
+// Parses a single value directly from the text
+// Stream: The stream to read from
+// Type: The declared type, SET_DATATYPE_NONE if there was no type
+// Depth: The declared list depth
+SET_Data *_SET_ParseValue(SET_Stream *Stream, SET_DataType Type, uint8_t Depth);
+
+// Parses the elements of a list directly from the text, the stream must be just after [
+// Stream: The stream to read from
+// Type: The declared type of the elements
+// Depth: The declared list depth of the elements
+SET_DataList *_SET_ParseList(SET_Stream *Stream, SET_DataType Type, uint8_t Depth);
+
+// Parses the elements of a list which are all single values, numbers, bools and chars are packed, returns false on error
+// Stream: The stream to read from, it must be at the first element
+// List: The list to fill in
+// Type: The declared type of the elements
+// Depth: The declared list depth of the elements
+bool _SET_ParseScalarList(SET_Stream *Stream, SET_DataList *List, SET_DataType Type, uint8_t Depth);
+
+// Parses a word, char or string and converts it, returns false on error
+// Stream: The stream to read from, it must be at the start of the value
+// Data: Returns the value
+bool _SET_ParseScalar(SET_Stream *Stream, SET_Data *Data);
 
 // Reads the type
-SET_DataType _SET_ReadType(const char *Type);
+// Types: The names of the types
+// Type: The name of the type to read
+SET_DataType _SET_ReadType(DIC_Dict *Types, const char *Type);
 
 // Converts data to a specific type, does not convert lists or structs
 SET_Data _SET_ConvertType(SET_Data *Data, SET_DataType Type);
@@ -421,30 +1999,484 @@ SET_Data _SET_ConvertSint(const char *String);
 // Converts a string to a signed int 64
 SET_Data _SET_ReadSint(const char *String);
 
-// Converts a string to a float
+// Converts a string to a float, the result is correctly rounded
 SET_Data _SET_ConvertFloat(const char *String);
 
+// Loads 8 characters into a word with the first character in the lowest byte
+// String: The string to load from, it must have at least 8 characters
+static inline uint64_t _SET_LoadEightChars(const char *String);
+
+// Checks if all 8 characters in a word from _SET_LoadEightChars are digits
+// Value: The characters
+static inline bool _SET_IsEightDigits(uint64_t Value);
+
+// Reads 8 digits at once
+// String: The digits, it must have at least 8 characters
+static inline uint32_t _SET_ReadEightDigits(const char *String);
+
+// Multiplies two 64 bit numbers into a 128 bit number, returns the low word
+// A: The first number
+// B: The second number
+// High: Where to store the high word
+static inline uint64_t _SET_Mul128(uint64_t A, uint64_t B, uint64_t *High);
+
+// Converts Mantissa * 10^Exp to a correctly rounded double with the Eisel-Lemire algorithm
+// Returns false if the result could not be determined, strtod must then be used instead
+// Value: Where to store the result
+// Mantissa: The significant digits, it must not be 0
+// Exp: The decimal exponent
+bool _SET_EiselLemire(double *Value, uint64_t Mantissa, int64_t Exp);
+
+// Converts a string to a double with strtod in the C locale so it does not depend on the locale of the program
+// String: The number without a sign
+double _SET_Strtod(const char *String);
+
 // Converts a string to a char
 SET_Data _SET_ConvertChar(const char *String);
 
 // Converts a string to another string
-SET_Data _SET_ConvertString(const char *String);
+// String: The string with quotes
+// Arena: The arena to allocate the new string from, NULL to use malloc
+SET_Data _SET_ConvertString(const char *String, ARN_Arena *Arena);
 
 // Reads a special character
 char _SET_ConvertSpecialChar(char Char);
 
-// Loads a settings file
+// Saves settings to a file in the same syntax they are loaded from, loading the file gives the same settings
+// Numbers which can only be told apart by their type, like unsigned, signed and float, are saved with their type
+// Integers without a sign which would load as a different size are saved with the types uint7, uint15, uint31 and uint63
+// These names are part of the settings syntax, they are the types of integers which fit both the signed and unsigned type of the size
+// Returns false on error, the file may then be partly written
+// FileName: The name of the file to write
+// Struct: The settings to save
+bool SET_SaveSettings(const char *FileName, SET_DataStruct *Struct);
+
+// Writes all of the text collected by a writer to its file, returns false on error
+// Writer: The writer to flush
+bool _SET_WriteFlush(SET_TextWriter *Writer);
+
+// Gets room for Size characters in the buffer of a writer, returns NULL on error
+// The characters are added to the text by adding the number of characters used to the size of the writer
+// Writer: The writer to write to
+// Size: The number of characters, it must be at most _SET_WRITESIZE
+static inline char *_SET_WriteReserve(SET_TextWriter *Writer, size_t Size);
+
+// Adds text to a writer, returns false on error
+// Writer: The writer to write to
+// Text: The text to add, it does not have to be terminated
+// Length: The number of characters to add
+static inline bool _SET_WriteText(SET_TextWriter *Writer, const char *Text, size_t Length);
+
+// Adds the spaces at the start of a line in a struct, returns false on error
+// Writer: The writer to write to
+// Indent: The depth of the struct
+bool _SET_WriteIndent(SET_TextWriter *Writer, uint32_t Indent);
+
+// Saves all of the fields of a struct, one on each line, returns false on error
+// Writer: The writer to write to
+// Struct: The struct to save
+// Indent: The depth of the struct, 0 for the top level
+bool _SET_SaveFields(SET_TextWriter *Writer, SET_DataStruct *Struct, uint32_t Indent);
+
+// Saves the part of a field before its value, the type is only written if it is needed to load the value with the same type
+// Returns false on error or if the name would not be read back as the same name
+// Writer: The writer to write to
+// Name: The name of the field
+// Data: The value of the field
+// Indent: The depth of the struct the field is in
+bool _SET_SaveName(SET_TextWriter *Writer, const char *Name, const SET_Data *Data, uint32_t Indent);
+
+// Saves a single value, returns false on error
+// Writer: The writer to write to
+// Data: The value to save
+// Indent: The depth of the struct the value is in
+bool _SET_SaveValue(SET_TextWriter *Writer, const SET_Data *Data, uint32_t Indent);
+
+// Saves a string or char with quotes around it, characters which would change or end it are written as special characters, returns false on error
+// Writer: The writer to write to
+// String: The characters to save
+// Length: The number of characters
+// Quote: The quote to put around it, \" for strings and \' for chars
+bool _SET_SaveString(SET_TextWriter *Writer, const char *String, size_t Length, char Quote);
+
+// Gets the name of the type a value has to be declared with to be loaded with the same type, returns NULL if it is not needed
+// Data: The value, a list is declared with the type of the elements
+const char *_SET_DeclaredType(const SET_Data *Data);
+
+// Finds the type an integer without a sign is loaded as when no type is declared, for a list it is the type all of the elements are loaded as
+// Returns SET_DATATYPE_NONE if it is a list of lists which can not be loaded without a type
+// Data: The integer or list of integers
+SET_DataType _SET_LoadedIntType(const SET_Data *Data);
+
+// Finds the number of digits of a number
+// Value: The number
+static inline size_t _SET_DigitCount(uint64_t Value);
+
+// Writes the digits of a number 2 at a time starting with the last one
+// Buffer: Where to write the digits, nothing is written after them
+// Value: The number to write
+// Count: The number of digits to write, it must be _SET_DigitCount of Value
+static inline void _SET_WriteDigits(char *Buffer, uint64_t Value, size_t Count);
+
+// Writes an unsigned integer in decimal, returns the number of characters written
+// Buffer: Where to write it, it must have room for _SET_NUMBERSIZE characters
+// Value: The number
+size_t _SET_FormatUint(char *Buffer, uint64_t Value);
+
+// Writes a signed integer in decimal, returns the number of characters written
+// Buffer: Where to write it, it must have room for _SET_NUMBERSIZE characters
+// Value: The number
+size_t _SET_FormatSint(char *Buffer, int64_t Value);
+
+// Writes a double with the fewest digits which are converted back into the same double, returns the number of characters written
+// It always has a . or an exponent so it is read as a float, it must be finite
+// Buffer: Where to write it, it must have room for _SET_NUMBERSIZE characters
+// Value: The number
+size_t _SET_FormatDouble(char *Buffer, double Value);
+
+// Writes a float with the fewest digits which are converted back into the same float, it works like _SET_FormatDouble
+// Buffer: Where to write it, it must have room for _SET_NUMBERSIZE characters
+// Value: The number
+size_t _SET_FormatFloat(char *Buffer, float Value);
+
+// Writes Digits * 10^Exp, returns the number of characters written
+// Buffer: Where to write it, it must have room for _SET_NUMBERSIZE characters
+// Negative: True if a minus should be written first
+// Digits: The significant digits, it must not be 0 and have at most 17 digits
+// Exp: The decimal exponent
+size_t _SET_FormatDecimal(char *Buffer, bool Negative, uint64_t Digits, int32_t Exp);
+
+// Finds the shortest digits which are closer to Mantissa * 2^Exp2 than to any other float of the same precision with the Ryu algorithm, returns the digits
+// The bounds are half way to the neighbouring floats, they are included if the mantissa is even since ties round to even
+// Mantissa: The mantissa with the hidden bit, it must have at most 54 bits
+// Exp2: The binary exponent
+// LowerGap: True if the float below is as far away as the float above, false if it is only half as far since the exponent changes
+// Exp10: Where to store the decimal exponent of the digits
+uint64_t _SET_ShortestDecimal(uint64_t Mantissa, int32_t Exp2, bool LowerGap, int32_t *Exp10);
+
+// Multiplies a number with a 128 bit power of 5 from _SET_Pow5Split or _SET_Pow5InvSplit and shifts it down
+// Value: The number, it must have at most 56 bits
+// Mul: The power of 5, the high word first
+// Shift: The number of bits to shift down, it must be larger than 64 and less than 128
+static inline uint64_t _SET_MulShift(uint64_t Value, const uint64_t *Mul, int32_t Shift);
+
+// Checks if a number is divisible by 5^Power
+// Value: The number, it must not be 0
+// Power: The power of 5
+static inline bool _SET_MultipleOfPow5(uint64_t Value, int32_t Power);
+
+// Sets if lists of depth 1 with numbers, bools or chars are loaded packed, it is off by default
+// A packed list has list set to NULL and the values stored in packed, code which walks list must use SET_ListElement instead
+// It affects lists which are loaded or reversed afterwards
+// Pack: True if the lists should be packed
+void SET_PackLists(bool Pack);
+
+// Gets an element of a list, it works for both packed lists and lists of values
+// Strings, structs and lists of the element still belong to the list
+// List: The list, it must not be deeper than 1 if it is packed
+// Index: The position of the element, it must be less than the count of the list
+SET_Data SET_ListElement(const SET_DataList *List, uint32_t Index);
+
+// Compiles a path like render.lights[3].color so it can be looked up many times with SET_Query
+// The names are hashed and interned once, every field is then found with a single probe which compares pointers if the dicts are interned
+// A name goes until a . or [ so fields with a . in their name cannot be reached
+// It must be destroyed with SET_DestroyPath, returns NULL on error
+// Path: The names of the fields separated by . with the positions of list elements in []
+SET_Path *SET_CompilePath(const char *Path);
+
+// Finds the value at the end of a compiled path
+// Returns a value with the type SET_DATATYPE_NONE if the path does not exist, strings, structs and lists of the value still belong to the settings
+// Data: The settings to look in
+// Path: The path from SET_CompilePath
+SET_Data SET_Query(SET_DataStruct *Data, const SET_Path *Path);
+
+// Loads a settings file, the text is parsed in a single pass without making a cleaned copy
 // The output should be destroyed with SET_DestroyDataStruct not DIC_DestroyDict
 SET_DataStruct *SET_LoadSettings(const char *FileName);
 
+// Loads a settings file where the entire tree is allocated from a single arena
+// Names and strings without special characters are not copied, they point into the text of the file which is kept by the output
+// Loading takes far fewer allocations and destroying it only frees the blocks of the arena
+// The output must be destroyed with SET_DestroySettings, the tree in it must not be changed
+SET_Settings *SET_LoadSettingsArena(const char *FileName);
+
+// Loads a settings file where the top level fields are parsed by several threads, the result is the same as with SET_LoadSettings
+// Large files are split into chunks of fields which are parsed at the same time, small files are parsed by a single thread
+// If the text has an error it is parsed again by a single thread so the error is the same as with SET_LoadSettings
+// The output should be destroyed with SET_DestroyDataStruct not DIC_DestroyDict
+// FileName: The name of the file to load
+// ThreadCount: The largest number of threads to use including the calling thread, 0 to use one for each processor
+SET_DataStruct *SET_LoadSettingsParallel(const char *FileName, uint32_t ThreadCount);
+
+// Loads a settings file where the values are parsed the first time they are used with SET_LazyGet, returns NULL on error
+// Only the names of the top level fields are read while loading, errors in a value are first found when it is used
+// The output must be destroyed with SET_DestroyLazySettings, it must not be used by several threads at once
+// FileName: The name of the file to load
+SET_LazySettings *SET_LoadSettingsLazy(const char *FileName);
+
+// Gets the value of a top level field of lazily loaded settings, it is parsed the first time and kept afterwards
+// Returns NULL if the field does not exist or the value could not be parsed
+// The value belongs to the settings and must not be destroyed
+// Settings: The settings to get the value from
+// Name: The name of the field
+SET_Data *SET_LazyGet(SET_LazySettings *Settings, const char *Name);
+
+// Creates a parser which keeps the names of the types and a buffer for the text between loads, returns NULL on error
+// The output must be destroyed with SET_DestroyParser
+SET_Parser *SET_CreateParser(void);
+
+// Loads a settings file like SET_LoadSettings using a parser, returns NULL on error
+// A parser may only be used by one thread at a time, but different threads may use their own parsers at the same time
+// The output must be destroyed with SET_DestroyDataStruct
+// Parser: The parser to use
+// FileName: The name of the file to load
+SET_DataStruct *SET_ParserLoad(SET_Parser *Parser, const char *FileName);
+
+// Parses the text of a settings file, returns NULL on error
+// String: The text, it is changed while parsing
+// Types: The names of the types, if NULL a dict is created for this text alone
+// Arena: The arena to allocate the tree from, NULL to use malloc
+// View: If true names and strings point into String when possible, String must then outlive the tree and Arena must not be NULL
+SET_DataStruct *_SET_ParseText(char *String, DIC_Dict *Types, ARN_Arena *Arena, bool View);
+
+// Creates a dict of the names of the types, returns NULL on error
+DIC_Dict *_SET_BuildTypeDict(void);
+
+// Parses the text of a settings file with several threads, returns NULL on error
+// String: The text, it is changed while parsing
+// ThreadCount: The largest number of threads to use including the calling thread, 0 to use one for each processor
+SET_DataStruct *_SET_ParseTextParallel(char *String, uint32_t ThreadCount);
+
+// Splits the top level of a text into chunks of whole fields, the blank after the last field of each chunk is replaced by the end of the text
+// Returns false if the end of a field could not be found
+// String: The text
+// ChunkSize: The smallest number of characters in a chunk
+// Types: The names of the types used by the streams of the chunks
+// OutChunks: Returns the chunks, the list must be freed
+// OutCount: Returns the number of chunks
+bool _SET_SplitText(char *String, size_t ChunkSize, DIC_Dict *Types, SET_ParseChunk **OutChunks, size_t *OutCount);
+
+// Reads chunks of a parse job until there are none left or one has failed, it is run by every thread of a parallel load
+// Job: The SET_ParseJob
+void *_SET_ParseWorker(void *Job);
+
+// Interns the keys of all structs inside a value, it is used for values read by the threads of a parallel load
+// Data: The value
+bool _SET_InternValue(SET_Data *Data);
+
+// Loads a settings file directly into a struct without creating a dict, returns false on error
+// The struct is filled in the same way as with SET_Translate and on error everything which was allocated is freed again
+// Strings and lists must be freed by the user
+// FileName: The name of the file to load
+// Struct: The struct to fill in
+// Table: The translation table describing the struct
+// Count: The number of entries in Table
+// Mode: The translation mode
+bool SET_LoadInto(const char *FileName, void *Struct, const SET_TranslationTable *Table, size_t Count, SET_TranslationMode Mode);
+
+// Loads the fields of a struct, stops at } or at the end of the text
+// Loader: The loader to read from
+// Struct: The struct to fill in
+// Table: The translation table of the struct
+// Count: The number of entries in Table
+// Mode: The translation mode
+// Sub: True if it is a substruct which must end with }
+// InList: True if the struct is inside a list
+bool _SET_LoadStruct(SET_Loader *Loader, void *Struct, const SET_TranslationTable *Table, size_t Count, SET_TranslationMode Mode, bool Sub, bool InList);
+
+// Loads a single value into the struct
+// Loader: The loader to read from
+// Value: Where to write the value
+// Table: The translation table entry of the value
+// Type: The declared type, SET_DATATYPE_NONE if there was no type
+// Depth: The list depth left
+// Mode: The translation mode
+// InList: True if the value is inside a list
+// LoadedType: Returns the type the value was read as before it was converted to the type of the table, for a list it is the common type of the elements
+bool _SET_LoadValue(SET_Loader *Loader, void *Value, const SET_TranslationTable *Table, SET_DataType Type, uint8_t Depth, SET_TranslationMode Mode, bool InList, SET_DataType *LoadedType);
+
+// Loads the elements of a list, the stream must be just after [
+// The elements must have a common type the same way as when the list is parsed by SET_LoadSettings
+// Loader: The loader to read from
+// List: Where to write the list
+// Table: The translation table entry of the list
+// Type: The declared type, SET_DATATYPE_NONE if there was no type
+// Depth: The list depth of the list
+// Mode: The translation mode
+// InList: True if the list is inside another list
+// LoadedType: Returns the common type of the elements
+bool _SET_LoadList(SET_Loader *Loader, void **List, const SET_TranslationTable *Table, SET_DataType Type, uint8_t Depth, SET_TranslationMode Mode, bool InList, SET_DataType *LoadedType);
+
+// Remembers memory allocated while loading, returns false on error
+// Loader: The loader to add it to
+// Pointer: The memory
+// Location: Where the pointer is stored, NULL if it is inside a list
+bool _SET_AddLoadAlloc(SET_Loader *Loader, void *Pointer, void **Location);
+
+// Frees everything allocated while loading and sets the pointers in the struct to NULL
+void _SET_ReverseLoad(SET_Loader *Loader);
+
+// Gets the size of a single value of a type, 0 if it is not a number, char or string
+size_t _SET_TypeSize(SET_DataType Type);
+
+// Parses a settings file and saves the result as a cache next to it, the name of the cache is the name of the file followed by SET_CACHESUFFIX
+// SET_LoadSettings and SET_LoadSettingsArena load the cache instead of parsing the file as long as the file has not changed
+// Returns false on error
+// FileName: The settings file
+bool SET_CompileSettings(const char *FileName);
+
+// Creates the name of the cache of a settings file, it must be freed, returns NULL on error
+// FileName: The settings file
+char *_SET_CacheName(const char *FileName);
+
+// Hashes the text of a settings file to find out if it has changed
+// String: The text
+// Length: The length of the text
+uint64_t _SET_HashText(const char *String, size_t Length);
+
+// Fills in the size and modification time of a settings file in a cache header, returns false if the file could not be found
+// Header: The header to fill in
+// FileName: The settings file
+bool _SET_StatSource(SET_CacheHeader *Header, const char *FileName);
+
+// Builds a cache of a settings struct and writes it to a file, returns false on error
+// Struct: The struct to save
+// FileName: The name of the cache
+// Source: The header with the information about the settings file filled in
+bool _SET_WriteCache(SET_DataStruct *Struct, const char *FileName, const SET_CacheHeader *Source);
+
+// Adds aligned space filled with 0 to the end of a cache, returns false on error
+// Writer: The cache being built
+// Size: The number of bytes
+// Offset: Where to store the offset of the space
+bool _SET_CacheReserve(SET_CacheWriter *Writer, size_t Size, uint64_t *Offset);
+
+// Adds a struct to the end of a cache, returns false on error
+// Writer: The cache being built
+// Struct: The struct to add
+// Offset: Where to store the offset of the struct
+bool _SET_CacheWriteStruct(SET_CacheWriter *Writer, SET_DataStruct *Struct, uint64_t *Offset);
+
+// Writes a value into a cache, strings, structs and lists are added to the end, returns false on error
+// Writer: The cache being built
+// Data: The value to write
+// Offset: The offset of the SET_CacheValue to write to
+bool _SET_CacheWriteValue(SET_CacheWriter *Writer, const SET_Data *Data, uint64_t Offset);
+
+// Maps the cache of a settings file if it is up to date, returns NULL without setting an error if there is no valid cache
+// FileName: The settings file
+// Source: The header with the size and modification time of the settings file as it is now
+// Text: The text of the settings file, it is only hashed if the rest of the header matches
+// Size: Where to store the size of the mapping
+uint8_t *_SET_MapCache(const char *FileName, const SET_CacheHeader *Source, const char *Text, size_t *Size);
+
+// Loads the cache of a settings file if it is up to date, returns NULL if there is no valid cache or on error
+// FileName: The settings file
+// Source: The header with the size and modification time of the settings file as it is now
+// Text: The text of the settings file, it is only hashed if the rest of the header matches
+// Arena: The arena to allocate the tree from, NULL to use malloc
+// Map: Where to store the mapping when using an arena since the tree points into it, it is unmapped when not using an arena
+// MapSize: Where to store the size of the mapping
+SET_DataStruct *_SET_LoadCache(const char *FileName, const SET_CacheHeader *Source, const char *Text, ARN_Arena *Arena, uint8_t **Map, size_t *MapSize);
+
+// Reads a struct from a cache, returns NULL on error
+// Reader: The cache
+// Offset: The offset of the struct
+SET_DataStruct *_SET_ReadCacheStruct(SET_CacheReader *Reader, uint64_t Offset);
+
+// Reads a value from a cache, returns false on error
+// Reader: The cache
+// Value: The value in the cache
+// Data: The data to fill in
+bool _SET_ReadCacheValue(SET_CacheReader *Reader, const SET_CacheValue *Value, SET_Data *Data);
+
+// Loads a settings file and starts watching it for changes, returns NULL on error
+// FileName: The settings file
+SET_Watcher *SET_CreateWatcher(const char *FileName);
+
+// Reloads the settings if the file has changed, only the top level fields whose text has changed are parsed again and the rest are kept
+// Returns the changes which are kept until the next update, the count is 0 if nothing changed, returns NULL on error in which case the old settings are kept
+// Watcher: The watcher to update
+// Wait: If true it waits until the file changes, otherwise it returns at once
+const SET_Diff *SET_UpdateWatcher(SET_Watcher *Watcher, bool Wait);
+
+// Translates only the fields which have changed, the memory of their old translations is freed first
+// Returns false on error in which case the changed pointers in Struct are NULL
+// Struct: The struct translated from the settings before the update
+// Dict: The settings after the update
+// Table: The translation table
+// Count: The number of elements in the table
+// Mode: The translation mode
+// Diff: The changes returned from SET_UpdateWatcher
+bool SET_TranslateDiff(void *Struct, SET_DataStruct *Dict, const SET_TranslationTable *Table, size_t Count, SET_TranslationMode Mode, const SET_Diff *Diff);
+
+// Reads all pending events of a watcher, returns false on error
+// Watcher: The watcher to read the events for
+// Wait: If true it waits for an event
+// Changed: Is set to true if the file has changed
+bool _SET_ReadWatcherEvents(SET_Watcher *Watcher, bool Wait, bool *Changed);
+
+// Loads the file again and updates the settings of a watcher, returns false on error in which case the watcher is unchanged
+// Watcher: The watcher to reload
+bool _SET_ReloadWatcher(SET_Watcher *Watcher);
+
+// Finds the top level fields of a text without parsing their values, returns false if the text is not valid
+// Text: The text
+// Fields: Where to store the list of fields, it must be freed with its names
+// Count: Where to store the number of fields
+bool _SET_SplitFields(char *Text, SET_WatchField **Fields, size_t *Count);
+
+// Skips a value without parsing it, the stream is left at the ; ending the field, returns false if it could not be found
+// Stream: The stream to read from
+bool _SET_SkipValue(SET_Stream *Stream);
+
+// Frees the names of a list of fields and the list
+// Fields: The fields
+// Count: The number of fields
+void _SET_DestroyWatchFields(SET_WatchField *Fields, size_t Count);
+
 // Converts a dict into a c struct using a translation table
 bool SET_Translate(void *Struct, SET_DataStruct *Dict, const SET_TranslationTable *Table, size_t Count, SET_TranslationMode Mode);
 
-// Converts a list from a dict using a transation table
-void *_SET_TranslateList(SET_DataList *DataList, const SET_TranslationTable *Table, uint8_t Depth, SET_TranslationMode Mode);
-
-// Translate a single element
-bool _SET_TranslateElement(void *Struct, SET_Data *Data, const SET_TranslationTable *Table, uint8_t Depth, SET_TranslationMode Mode);
+// Prepares a translation table to be used many times, the names get a perfect hash index and the sub tables are compiled too
+// Translating with it only costs a single lookup for each field instead of comparing with the whole table
+// It must be destroyed with SET_DestroyCompiledTable, returns NULL on error
+// Table: The translation table, it must not be changed or freed while the compiled table exists
+// Count: The number of elements in the table
+SET_CompiledTable *SET_CompileTranslationTable(const SET_TranslationTable *Table, size_t Count);
+
+// Converts a dict into a c struct using a compiled translation table, it works like SET_Translate
+// Struct: The struct to fill in
+// Dict: The dict to translate
+// Table: The compiled translation table
+// Mode: The translation mode
+bool SET_TranslateCompiled(void *Struct, SET_DataStruct *Dict, const SET_CompiledTable *Table, SET_TranslationMode Mode);
+
+// Converts a dict into a c struct, the compiled table is used for lookups if it is not NULL
+bool _SET_TranslateStruct(void *Struct, SET_DataStruct *Dict, const SET_TranslationTable *Table, size_t Count, const SET_CompiledTable *Compiled, SET_TranslationMode Mode);
+
+// Compiles a translation table into an existing compiled table, returns false on error
+// Compiled: The compiled table to fill in
+// Table: The translation table
+// Count: The number of elements in the table
+bool _SET_CompileTable(SET_CompiledTable *Compiled, const SET_TranslationTable *Table, size_t Count);
+
+// Mixes a seed into the hash of a name for the name index of a compiled table, the top bits are the best mixed
+// Hash: The _SET_HashText of the name
+// Seed: The seed, 0 gives the bucket
+static inline uint64_t _SET_MixCompiled(uint64_t Hash, uint32_t Seed);
+
+// Finds the entry of a compiled table with a given name, returns NULL if there is none
+// Compiled: The compiled table
+// Name: The name of the entry
+// Hash: The _SET_HashText of the name
+static inline const SET_TranslationTable *_SET_FindCompiled(const SET_CompiledTable *Compiled, const char *Name, uint64_t Hash);
+
+// Converts a list from a dict using a transation table, Sub is the compiled sub table of the entry or NULL
+void *_SET_TranslateList(SET_DataList *DataList, const SET_TranslationTable *Table, const SET_CompiledTable *Sub, uint8_t Depth, SET_TranslationMode Mode);
+
+// Translate a single element, Sub is the compiled sub table of the entry or NULL
+bool _SET_TranslateElement(void *Struct, SET_Data *Data, const SET_TranslationTable *Table, const SET_CompiledTable *Sub, uint8_t Depth, SET_TranslationMode Mode);
 
 // Reverse the work done during translation
 void _SET_ReverseTranslation(void *Struct, SET_DataStruct *Dict, const SET_TranslationTable *Table, size_t Count);
@@ -452,6 +2484,29 @@ void _SET_ReverseTranslation(void *Struct, SET_DataStruct *Dict, const SET_Trans
 // Free a translation list
 void _SET_ReverseTranslationList(void *List, SET_DataList *DataList, const SET_TranslationTable *Table);
 
+// Converts a c struct back into a dict using a translation table, it is the opposite of SET_Translate, returns NULL on error
+// The output can be saved with SET_SaveSettings, it should be destroyed with SET_DestroyDataStruct
+// Lists must have the length given in the table for every level, fields with lists and strings which are NULL are left out
+// Struct: The struct to convert
+// Table: The translation table
+// Count: The number of elements in the table
+SET_DataStruct *SET_ReverseTranslate(const void *Struct, const SET_TranslationTable *Table, size_t Count);
+
+// Converts a c struct back into a dict, returns NULL on error
+SET_DataStruct *_SET_ReverseStruct(const void *Struct, const SET_TranslationTable *Table, size_t Count);
+
+// Converts a single element of a c struct back into a value, returns NULL on error
+// Value: The location of the element
+// Table: The entry of the translation table of the element
+// Depth: How many levels of lists there are left
+SET_Data *_SET_ReverseElement(const void *Value, const SET_TranslationTable *Table, uint8_t Depth);
+
+// Converts a list of a c struct back into a list of values, returns NULL on error
+// List: The list
+// Table: The entry of the translation table of the list
+// Depth: How many levels of lists there are left, it must be at least 1
+SET_DataList *_SET_ReverseList(const void *List, const SET_TranslationTable *Table, uint8_t Depth);
+
 // Initialize structs
 void SET_InitData(SET_Data *Struct);
 void SET_InitDataList(SET_DataList *Struct);
@@ -460,6 +2515,27 @@ void SET_InitCodeName(SET_CodeName *Struct);
 void SET_InitCodeValue(SET_CodeValue *Struct);
 void SET_InitCodeList(SET_CodeList *Struct);
 void SET_InitTranslationTable(SET_TranslationTable *Struct);
+void SET_InitStream(SET_Stream *Struct);
+void SET_InitStreamField(SET_StreamField *Struct);
+void SET_InitSettings(SET_Settings *Struct);
+void SET_InitCacheWriter(SET_CacheWriter *Struct);
+void SET_InitCacheReader(SET_CacheReader *Struct);
+void SET_InitWatchField(SET_WatchField *Struct);
+void SET_InitChange(SET_Change *Struct);
+void SET_InitDiff(SET_Diff *Struct);
+void SET_InitWatcher(SET_Watcher *Struct);
+void SET_InitCompiledTable(SET_CompiledTable *Struct);
+void SET_InitLoadAlloc(SET_LoadAlloc *Struct);
+void SET_InitLoader(SET_Loader *Struct);
+void SET_InitParseChunk(SET_ParseChunk *Struct);
+void SET_InitParseJob(SET_ParseJob *Struct);
+void SET_InitLazyField(SET_LazyField *Struct);
+void SET_InitLazySettings(SET_LazySettings *Struct);
+void SET_InitParser(SET_Parser *Struct);
+void SET_InitScanBlock(SET_ScanBlock *Struct);
+void SET_InitTextWriter(SET_TextWriter *Struct);
+void SET_InitPathSegment(SET_PathSegment *Struct);
+void SET_InitPath(SET_Path *Struct);
 
 // Destroy struct
 void SET_DestroyData(SET_Data *Struct);
@@ -469,32 +2545,300 @@ void SET_DestroyCodeStruct(SET_CodeStruct *Struct);
 void SET_DestroyCodeName(SET_CodeName *Struct);
 void SET_DestroyCodeValue(SET_CodeValue *Struct);
 void SET_DestroyCodeList(SET_CodeList *Struct);
+void SET_DestroySettings(SET_Settings *Struct);
+void SET_DestroyLazySettings(SET_LazySettings *Struct);
+void SET_DestroyParser(SET_Parser *Struct);
+void SET_DestroyWatcher(SET_Watcher *Struct);
+void SET_DestroyCompiledTable(SET_CompiledTable *Struct);
+void SET_DestroyPath(SET_Path *Struct);
+
+// Frees the content of a compiled table without freeing the table itself
+void _SET_ClearCompiledTable(SET_CompiledTable *Struct);
+
+// Frees the content of a diff and empties it
+void SET_ClearDiff(SET_Diff *Struct);
 
 bool SET_Translate(void *Struct, SET_DataStruct *Dict, const SET_TranslationTable *Table, size_t Count, SET_TranslationMode Mode)
 {
-    // Check that EMPTY mode is fulfilled
-    if (Mode & SET_TRANSLATIONMODE_EMPTY)
-        for (DIC_LinkList **List = Dict->list, **EndList = Dict->list + Dict->length; List < EndList; ++List)
-            for (DIC_LinkList *Link = *List; Link != NULL; Link = Link->next)
-            {
-                const SET_TranslationTable *TableList = Table;
-                for (const SET_TranslationTable *EndTableList = Table + Count; TableList < EndTableList; ++TableList)
-                    if (strcmp(Link->key, TableList->name) == 0)
-                        break;
+    return _SET_TranslateStruct(Struct, Dict, Table, Count, NULL, Mode);
+}
+
+SET_CompiledTable *SET_CompileTranslationTable(const SET_TranslationTable *Table, size_t Count)
+{
+    SET_CompiledTable *Compiled = (SET_CompiledTable *)malloc(sizeof(SET_CompiledTable));
+
+    if (Compiled == NULL)
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_COMPILETRANSLATIONTABLE_MALLOC, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(SET_CompiledTable));
+        return NULL;
+    }
+
+    SET_InitCompiledTable(Compiled);
+
+    // The hashes of the names are only valid for the hash of the dicts
+    if (!DIC_AcquireHash())
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_COMPILETRANSLATIONTABLE_HASH, DIC_GetError(), _SET_ERRORMES_ACQUIREHASH);
+        free(Compiled);
+        return NULL;
+    }
+
+    if (!_SET_CompileTable(Compiled, Table, Count))
+    {
+        _SET_AddError(_SET_ERRORID_COMPILETRANSLATIONTABLE_COMPILE, _SET_ERRORMES_COMPILETABLE);
+        SET_DestroyCompiledTable(Compiled);
+        return NULL;
+    }
+
+    return Compiled;
+}
+
+bool SET_TranslateCompiled(void *Struct, SET_DataStruct *Dict, const SET_CompiledTable *Table, SET_TranslationMode Mode)
+{
+    return _SET_TranslateStruct(Struct, Dict, Table->table, Table->count, Table, Mode);
+}
+
+bool _SET_CompileTable(SET_CompiledTable *Compiled, const SET_TranslationTable *Table, size_t Count)
+{
+    Compiled->table = Table;
+    Compiled->count = Count;
+
+    Compiled->hashes = (uint64_t *)malloc(sizeof(uint64_t) * Count);
+    Compiled->sub = (SET_CompiledTable *)malloc(sizeof(SET_CompiledTable) * Count);
+
+    if ((Compiled->hashes == NULL || Compiled->sub == NULL) && Count > 0)
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_COMPILETABLE_MALLOC, strerror(errno), _SET_ERRORMES_MALLOC, (sizeof(uint64_t) + sizeof(SET_CompiledTable)) * Count);
+
+        // The sub tables have not been initialized
+        free(Compiled->sub);
+        Compiled->sub = NULL;
+        return false;
+    }
+
+    for (SET_CompiledTable *Sub = Compiled->sub, *EndSub = Compiled->sub + Count; Sub < EndSub; ++Sub)
+        SET_InitCompiledTable(Sub);
+
+    // Hash the names and compile the sub tables
+    for (size_t Pos = 0; Pos < Count; ++Pos)
+    {
+        Compiled->hashes[Pos] = DIC_HashKey(Table[Pos].name);
+
+        if (Table[Pos].type == SET_DATATYPE_STRUCT && Table[Pos].sub != NULL && !_SET_CompileTable(Compiled->sub + Pos, Table[Pos].sub, Table[Pos].count))
+        {
+            _SET_AddError(_SET_ERRORID_COMPILETABLE_SUB, _SET_ERRORMES_COMPILETABLE);
+            return false;
+        }
+    }
+
+    // There is a bucket for every 2 names and 2 slots for every name, each bucket gets a seed which moves all of its names into free slots
+    uint32_t BucketBits = 1;
+    uint32_t SlotBits = 1;
+
+    while (((size_t)1 << BucketBits) < Count / 2)
+        ++BucketBits;
+
+    while (((size_t)1 << SlotBits) < Count * 2)
+        ++SlotBits;
+
+    size_t BucketCount = (size_t)1 << BucketBits;
+    Compiled->bucketShift = 64 - BucketBits;
+    Compiled->seeds = (uint32_t *)malloc(sizeof(uint32_t) * BucketCount);
+
+    // The hash of the dicts does not depend on the order of the characters, so the index has its own hash
+    uint64_t *Keys = (uint64_t *)malloc(sizeof(uint64_t) * (Count + 1));
+
+    // Sort the names by bucket
+    uint32_t *Starts = (uint32_t *)calloc(BucketCount + 1, sizeof(uint32_t));
+    uint32_t *Order = (uint32_t *)malloc(sizeof(uint32_t) * (Count + 1));
+
+    if (Compiled->seeds == NULL || Keys == NULL || Starts == NULL || Order == NULL)
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_COMPILETABLE_MALLOC, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(uint64_t) * (Count + 1) + sizeof(uint32_t) * (BucketCount * 2 + Count + 2));
+        free(Keys);
+        free(Starts);
+        free(Order);
+        return false;
+    }
+
+    for (size_t Pos = 0; Pos < Count; ++Pos)
+        Keys[Pos] = _SET_HashText(Table[Pos].name, strlen(Table[Pos].name));
+
+    uint32_t MaxSize = 0;
+
+    for (size_t Pos = 0; Pos < Count; ++Pos)
+        ++Starts[(_SET_MixCompiled(Keys[Pos], 0) >> Compiled->bucketShift) + 1];
+
+    for (size_t Bucket = 0; Bucket < BucketCount; ++Bucket)
+    {
+        if (Starts[Bucket + 1] > MaxSize)
+            MaxSize = Starts[Bucket + 1];
+
+        Starts[Bucket + 1] += Starts[Bucket];
+    }
+
+    for (size_t Pos = 0; Pos < Count; ++Pos)
+    {
+        uint32_t *Start = Starts + (_SET_MixCompiled(Keys[Pos], 0) >> Compiled->bucketShift);
+        Order[(*Start)++] = Pos;
+    }
+
+    // Starts was moved to the end of each bucket while sorting
+    for (size_t Bucket = BucketCount; Bucket > 0; --Bucket)
+        Starts[Bucket] = Starts[Bucket - 1];
+
+    Starts[0] = 0;
 
-                if (TableList >= Table + Count)
+    // No seed can split 2 names with the same hash
+    for (uint32_t *Bucket = Starts, *EndBucket = Starts + BucketCount; Bucket < EndBucket; ++Bucket)
+        for (uint32_t *First = Order + Bucket[0], *EndFirst = Order + Bucket[1]; First < EndFirst; ++First)
+            for (uint32_t *Second = First + 1; Second < EndFirst; ++Second)
+                if (Keys[*First] == Keys[*Second])
                 {
-                    _SET_SetError(_SET_ERRORID_TRANSLATE_EMPTY, _SET_ERRORMES_TRANSLATEEMPTY, Link->key);
-                    _SET_ReverseTranslation(Struct, Dict, Table, TableList - Table);
+                    if (strcmp(Table[*First].name, Table[*Second].name) == 0)
+                        _SET_SetError(_SET_ERRORID_COMPILETABLE_DUBLICATE, _SET_ERRORMES_TABLEDUBLICATE, Table[*First].name);
+
+                    else
+                        _SET_SetError(_SET_ERRORID_COMPILETABLE_INDEX, _SET_ERRORMES_TABLEINDEX, Table[*First].name, Table[*Second].name);
+
+                    free(Keys);
+                    free(Starts);
+                    free(Order);
                     return false;
                 }
+
+    // Find the seeds, the largest buckets are placed first while there are many free slots, if it takes too long there are more slots
+    for (;; ++SlotBits)
+    {
+        size_t SlotCount = (size_t)1 << SlotBits;
+        uint32_t *NewSlots = (uint32_t *)realloc(Compiled->slots, sizeof(uint32_t) * SlotCount);
+
+        if (NewSlots == NULL)
+        {
+            _SET_AddErrorForeign(_SET_ERRORID_COMPILETABLE_MALLOC, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(uint32_t) * SlotCount);
+            free(Keys);
+            free(Starts);
+            free(Order);
+            return false;
+        }
+
+        Compiled->slots = NewSlots;
+        Compiled->slotShift = 64 - SlotBits;
+        memset(Compiled->slots, 0, sizeof(uint32_t) * SlotCount);
+
+        bool Placed = true;
+
+        for (uint32_t Size = MaxSize; Size > 0 && Placed; --Size)
+            for (size_t Bucket = 0; Bucket < BucketCount && Placed; ++Bucket)
+            {
+                if (Starts[Bucket + 1] - Starts[Bucket] != Size)
+                    continue;
+
+                Placed = false;
+
+                for (uint32_t Seed = 1; Seed <= _SET_COMPILETRIES && !Placed; ++Seed)
+                {
+                    uint32_t *Member = Order + Starts[Bucket];
+                    uint32_t *EndMember = Order + Starts[Bucket + 1];
+
+                    for (; Member < EndMember; ++Member)
+                    {
+                        uint32_t *Slot = Compiled->slots + (_SET_MixCompiled(Keys[*Member], Seed) >> Compiled->slotShift);
+
+                        if (*Slot != 0)
+                            break;
+
+                        *Slot = *Member + 1;
+                    }
+
+                    // Take the names out again if one of them did not fit
+                    if (Member < EndMember)
+                    {
+                        for (uint32_t *Undo = Order + Starts[Bucket]; Undo < Member; ++Undo)
+                            Compiled->slots[_SET_MixCompiled(Keys[*Undo], Seed) >> Compiled->slotShift] = 0;
+
+                        continue;
+                    }
+
+                    Compiled->seeds[Bucket] = Seed;
+                    Placed = true;
+                }
+            }
+
+        if (Placed)
+            break;
+    }
+
+    // Empty buckets are never looked at, their seed only has to be valid
+    for (size_t Bucket = 0; Bucket < BucketCount; ++Bucket)
+        if (Starts[Bucket + 1] == Starts[Bucket])
+            Compiled->seeds[Bucket] = 0;
+
+    free(Keys);
+    free(Starts);
+    free(Order);
+
+    return true;
+}
+
+static inline uint64_t _SET_MixCompiled(uint64_t Hash, uint32_t Seed)
+{
+    Hash = (Hash ^ (Seed * 0x9E3779B97F4A7C15)) * 0xBF58476D1CE4E5B9;
+    Hash ^= Hash >> 31;
+
+    return Hash * 0x94D049BB133111EB;
+}
+
+static inline const SET_TranslationTable *_SET_FindCompiled(const SET_CompiledTable *Compiled, const char *Name, uint64_t Hash)
+{
+    uint32_t Seed = Compiled->seeds[_SET_MixCompiled(Hash, 0) >> Compiled->bucketShift];
+    uint32_t Slot = Compiled->slots[_SET_MixCompiled(Hash, Seed) >> Compiled->slotShift];
+
+    if (Slot == 0 || strcmp(Compiled->table[Slot - 1].name, Name) != 0)
+        return NULL;
+
+    return Compiled->table + Slot - 1;
+}
+
+bool _SET_TranslateStruct(void *Struct, SET_DataStruct *Dict, const SET_TranslationTable *Table, size_t Count, const SET_CompiledTable *Compiled, SET_TranslationMode Mode)
+{
+    // Check that EMPTY mode is fulfilled, nothing has been translated yet so there is nothing to reverse
+    if (Mode & SET_TRANSLATIONMODE_EMPTY)
+        DIC_ForEach(Dict, Item)
+        {
+            bool Found = false;
+
+            if (Compiled != NULL)
+                Found = (_SET_FindCompiled(Compiled, Item.key, _SET_HashText(Item.key, strlen(Item.key))) != NULL);
+
+            else
+                for (const SET_TranslationTable *TableList = Table, *EndTableList = Table + Count; TableList < EndTableList && !Found; ++TableList)
+                    Found = (strcmp(Item.key, TableList->name) == 0);
+
+            if (!Found)
+            {
+                _SET_SetError(_SET_ERRORID_TRANSLATE_EMPTY, _SET_ERRORMES_TRANSLATEEMPTY, Item.key);
+                return false;
             }
+        }
 
     // Go through all of the fields
     for (const SET_TranslationTable *TableList = Table, *TableListEnd = Table + Count; TableList < TableListEnd; ++TableList)
     {
-        // Check if it is in the dict
-        if (!DIC_CheckItem(Dict, TableList->name))
+        // Check if it is in the dict, a compiled table already has the hash of the name
+        SET_Data *Data = NULL;
+        bool Exists;
+
+        if (Compiled != NULL)
+        {
+            Data = (SET_Data *)DIC_GetItemHashed(Dict, TableList->name, Compiled->hashes[TableList - Table]);
+            Exists = (Data != NULL);
+        }
+
+        else
+            Exists = DIC_CheckItem(Dict, TableList->name);
+
+        if (!Exists)
         {
             // Check if it is an error
             if (Mode & SET_TRANSLATIONMODE_FILL)
@@ -508,7 +2852,8 @@ bool SET_Translate(void *Struct, SET_DataStruct *Dict, const SET_TranslationTabl
         }
 
         // Get the data
-        SET_Data *Data = (SET_Data *)DIC_GetItem(Dict, TableList->name);
+        if (Data == NULL)
+            Data = (SET_Data *)DIC_GetItem(Dict, TableList->name);
 
         if (Data == NULL)
         {
@@ -518,7 +2863,7 @@ bool SET_Translate(void *Struct, SET_DataStruct *Dict, const SET_TranslationTabl
         }
 
         // Translate the item
-        if (!_SET_TranslateElement(Struct + TableList->offset, Data, TableList, TableList->depth, Mode))
+        if (!_SET_TranslateElement(Struct + TableList->offset, Data, TableList, ((Compiled != NULL) ? (Compiled->sub + (TableList - Table)) : (NULL)), TableList->depth, Mode))
         {
             _SET_AddError(_SET_ERRORID_TRANSLATE_TRANSLATE, _SET_ERRORMES_TRANSLATEITEM, TableList->name);
             _SET_ReverseTranslation(Struct, Dict, Table, TableList - Table);
@@ -529,7 +2874,7 @@ bool SET_Translate(void *Struct, SET_DataStruct *Dict, const SET_TranslationTabl
     return true;
 }
 
-void *_SET_TranslateList(SET_DataList *DataList, const SET_TranslationTable *Table, uint8_t Depth, SET_TranslationMode Mode)
+void *_SET_TranslateList(SET_DataList *DataList, const SET_TranslationTable *Table, const SET_CompiledTable *Sub, uint8_t Depth, SET_TranslationMode Mode)
 {
     void *NewList = NULL;
 
@@ -618,13 +2963,40 @@ void *_SET_TranslateList(SET_DataList *DataList, const SET_TranslationTable *Tab
         for (void **InitList = (void **)NewList, **EndInitList = (void **)NewList + DataList->count; InitList < EndInitList; ++InitList)
             *InitList = NULL;
 
+    // Packed lists are copied at once if the type is the same, otherwise each value is converted
+    if (DataList->packed != NULL)
+    {
+        if (DataList->type == Table->type)
+        {
+            memcpy(NewList, DataList->packed, Size * DataList->count);
+            return NewList;
+        }
+
+        for (uint32_t Pos = 0; Pos < DataList->count; ++Pos)
+        {
+            SET_Data Element = SET_ListElement(DataList, Pos);
+            SET_Data ConvertData = _SET_ConvertType(&Element, Table->type);
+
+            if (ConvertData.type == SET_DATATYPE_NONE)
+            {
+                _SET_AddError(_SET_ERRORID_TRANSLATELIST_CONVERTPACKED, _SET_ERRORMES_CONVERTLIST2, _SET_ELEMENTPREMES, (size_t)Pos);
+                free(NewList);
+                return NULL;
+            }
+
+            memcpy(NewList + Size * Pos, &ConvertData.data, Size);
+        }
+
+        return NewList;
+    }
+
     // Fill in
     SET_Data **FillDataList = DataList->list;
 
     for (void *FillList = NewList, *EndFillList = NewList + Size * DataList->count; FillList < EndFillList; FillList += Size, ++FillDataList)
     {
         // Translate sub list
-        if (!_SET_TranslateElement(FillList, *FillDataList, Table, Depth - 1, Mode))
+        if (!_SET_TranslateElement(FillList, *FillDataList, Table, Sub, Depth - 1, Mode))
         {
             _SET_AddError(_SET_ERRORID_TRANSLATELIST_CONVERTLIST, _SET_ERRORMES_CONVERTLIST2, _SET_ELEMENTPREMES, FillList - NewList);
             _SET_ReverseTranslationList(NewList, DataList, Table);
@@ -636,7 +3008,7 @@ void *_SET_TranslateList(SET_DataList *DataList, const SET_TranslationTable *Tab
     return NewList;
 }
 
-bool _SET_TranslateElement(void *Struct, SET_Data *Data, const SET_TranslationTable *Table, uint8_t Depth, SET_TranslationMode Mode)
+bool _SET_TranslateElement(void *Struct, SET_Data *Data, const SET_TranslationTable *Table, const SET_CompiledTable *Sub, uint8_t Depth, SET_TranslationMode Mode)
 {
     // Figure out what type it is
     // List
@@ -650,7 +3022,7 @@ bool _SET_TranslateElement(void *Struct, SET_Data *Data, const SET_TranslationTa
         }
 
         // Translate the list
-        void *List = _SET_TranslateList(Data->data.list, Table, Depth, Mode | SET_TRANSLATIONMODE_FILL);
+        void *List = _SET_TranslateList(Data->data.list, Table, Sub, Depth, Mode | SET_TRANSLATIONMODE_FILL);
 
         if (List == NULL)
         {
@@ -679,7 +3051,7 @@ bool _SET_TranslateElement(void *Struct, SET_Data *Data, const SET_TranslationTa
         }
 
         // Fill in the struct
-        if (!SET_Translate(Struct, Data->data.stct, Table->sub, Table->count, Mode))
+        if (!_SET_TranslateStruct(Struct, Data->data.stct, Table->sub, Table->count, ((Sub != NULL && Sub->table != NULL) ? (Sub) : (NULL)), Mode))
         {
             _SET_AddError(_SET_ERRORID_TRANSLATEELEMENT_CONVERTSTRUCT, _SET_ERRORMES_CONVERTSTRUCT);
             return false;
@@ -816,7 +3188,9 @@ void _SET_ReverseTranslation(void *Struct, SET_DataStruct *Dict, const SET_Trans
         // If it is a list, free all of it and set to NULL
         if (TableList->depth > 0)
         {
-            _SET_ReverseTranslationList(Struct + TableList->offset, Data->data.list, TableList);
+            if (*(void **)(Struct + TableList->offset) != NULL)
+                _SET_ReverseTranslationList(*(void **)(Struct + TableList->offset), Data->data.list, TableList);
+
             free(*(void **)(Struct + TableList->offset));
             *((void **)(Struct + TableList->offset)) = NULL;
         }
@@ -864,7 +3238,7 @@ void _SET_ReverseTranslationList(void *List, SET_DataList *DataList, const SET_T
 
         // Go through and free each element in the list
         for (void **NewList = (void **)List, **EndNewList = (void **)List + DataList->count; NewList < EndNewList; ++NewList, ++NewDataList)
-            if (NewList != NULL)
+            if (*NewList != NULL)
             {
                 _SET_ReverseTranslationList(*NewList, (*NewDataList)->data.list, Table);
                 free(*NewList);
@@ -872,2004 +3246,7229 @@ void _SET_ReverseTranslationList(void *List, SET_DataList *DataList, const SET_T
     }
 }
 
-SET_DataStruct *SET_LoadSettings(const char *FileName)
+SET_DataStruct *SET_ReverseTranslate(const void *Struct, const SET_TranslationTable *Table, size_t Count)
 {
-    // Load file
-    char *String = FIL_Load(FileName);
+    SET_DataStruct *Dict = _SET_ReverseStruct(Struct, Table, Count);
 
-    if (String == NULL)
+    if (Dict == NULL)
     {
-        _SET_AddErrorForeign(_SET_ERRORID_LOADSETTINGS_LOAD, FIL_GetError(), _SET_ERRORMES_LOADFILE, FileName);
+        _SET_AddError(_SET_ERRORID_REVERSETRANSLATE_STRUCT, _SET_ERRORMES_CONVERTSTRUCT);
         return NULL;
     }
 
-    // Clean string
-    char *CleanString = _SET_CleanString(String);
-    
-    free(String);
+    return Dict;
+}
+
+SET_DataStruct *_SET_ReverseStruct(const void *Struct, const SET_TranslationTable *Table, size_t Count)
+{
+    // Create the dictionary the same way as when loading
+    DIC_Dict *Dict = DIC_CreateDict(((Count > 0) ? (Count) : (1)));
 
-    if (CleanString == NULL)
+    if (Dict == NULL)
     {
-        _SET_AddError(_SET_ERRORID_LOADSETTINGS_CLEAN, _SET_ERRORMES_CLEANFILE, FileName);
+        _SET_AddErrorForeign(_SET_ERRORID_REVERSESTRUCT_CREATEDICT, DIC_GetError(), _SET_ERRORMES_CREATEDICT);
         return NULL;
     }
 
-    // Split string
-    SET_CodeStruct *CodeStruct = _SET_SplitString(CleanString);
-
-    if (CodeStruct == NULL)
+    if (!DIC_AddBloomFilter(Dict, Count))
     {
-        _SET_AddError(_SET_ERRORID_LOADSETTINGS_SPLIT, _SET_ERRORMES_SPLITFILE, FileName);
-        free(CleanString);
+        _SET_AddErrorForeign(_SET_ERRORID_REVERSESTRUCT_BLOOM, DIC_GetError(), _SET_ERRORMES_BLOOM);
+        SET_DestroyDataStruct(Dict);
         return NULL;
     }
 
-    // Load type dict
-    extern DIC_Dict *_SET_TypeDict;
-    extern char *_SET_TypeNames[];
-    extern SET_DataType _SET_Types[];
-
-    _SET_TypeDict = DIC_CreateDict(_SET_TYPECOUNT);
-
-    if (_SET_TypeDict == NULL)
+    if (!DIC_InternKeys(Dict))
     {
-        _SET_AddErrorForeign(_SET_ERRORID_LOADSETTINGS_CREATEDICT, DIC_GetError(), _SET_ERRORMES_CREATEDICT);
-        SET_DestroyCodeStruct(CodeStruct);
-        free(CleanString);
+        _SET_AddErrorForeign(_SET_ERRORID_REVERSESTRUCT_INTERN, DIC_GetError(), _SET_ERRORMES_INTERN);
+        SET_DestroyDataStruct(Dict);
         return NULL;
     }
 
-    size_t ElementSize = sizeof(SET_DataType);
-
-    if (!DIC_AddList(_SET_TypeDict, (const char **)_SET_TypeNames, _SET_TYPECOUNT, (void *)_SET_Types, &ElementSize, DIC_MODE_LIST))
+    // Go through all of the fields
+    for (const SET_TranslationTable *TableList = Table, *TableListEnd = Table + Count; TableList < TableListEnd; ++TableList)
     {
-        _SET_AddErrorForeign(_SET_ERRORID_LOADSETTINGS_LOADDICT, DIC_GetError(), _SET_ERRORMES_DICTLIST);
-        DIC_DestroyDict(_SET_TypeDict);
-        _SET_TypeDict = NULL;
-        SET_DestroyCodeStruct(CodeStruct);
-        free(CleanString);
-        return NULL;
-    }
+        const void *Value = Struct + TableList->offset;
 
-    // Convert
-    DIC_Dict* Result = _SET_ConvertStruct(CodeStruct);
+        // Lists and strings which have not been set are left out
+        if ((TableList->depth > 0 || TableList->type == SET_DATATYPE_STR) && *(void * const *)Value == NULL)
+            continue;
 
-    if (Result == NULL)
-    {
-        _SET_AddError(_SET_ERRORID_LOADSETTINGS_CONVERT, _SET_ERRORMES_CONVERTFILE, FileName);
-        DIC_DestroyDict(_SET_TypeDict);
-        _SET_TypeDict = NULL;
-        SET_DestroyCodeStruct(CodeStruct);
-        free(CleanString);
-        return NULL;
-    }
+        if (DIC_CheckItem(Dict, TableList->name))
+        {
+            _SET_SetError(_SET_ERRORID_REVERSESTRUCT_DUBLICATE, _SET_ERRORMES_TABLEDUBLICATE, TableList->name);
+            SET_DestroyDataStruct(Dict);
+            return NULL;
+        }
 
-    // Clean up
-    DIC_DestroyDict(_SET_TypeDict);
-    _SET_TypeDict = NULL;
-    SET_DestroyCodeStruct(CodeStruct);
-    free(CleanString);
+        SET_Data *Data = _SET_ReverseElement(Value, TableList, TableList->depth);
 
-    return Result;
+        if (Data == NULL)
+        {
+            _SET_AddError(_SET_ERRORID_REVERSESTRUCT_ELEMENT, _SET_ERRORMES_REVERSEFIELD, TableList->name);
+            SET_DestroyDataStruct(Dict);
+            return NULL;
+        }
+
+        if (!DIC_AddItem(Dict, TableList->name, (void *)Data, 0, DIC_MODE_POINTER))
+        {
+            _SET_AddErrorForeign(_SET_ERRORID_REVERSESTRUCT_ADDITEM, DIC_GetError(), _SET_ERRORMES_DICTADD, TableList->name);
+            SET_DestroyData(Data);
+            SET_DestroyDataStruct(Dict);
+            return NULL;
+        }
+    }
+
+    return Dict;
 }
 
-char *_SET_CleanString(const char *String)
+SET_Data *_SET_ReverseElement(const void *Value, const SET_TranslationTable *Table, uint8_t Depth)
 {
-    extern uint32_t _SET_SpecialCharLength;
-    extern char _SET_SpecialChar[];
-
-    size_t Size = strlen(String) + 1;
-    char *NewString = (char *)malloc(sizeof(char) * Size);
+    SET_Data *Data = (SET_Data *)malloc(sizeof(SET_Data));
 
-    if (NewString == NULL)
+    if (Data == NULL)
     {
-        _SET_AddErrorForeign(_SET_ERRORID_CLEANSTRING_MALLOC, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(char) * Size);
+        _SET_AddErrorForeign(_SET_ERRORID_REVERSEELEMENT_MALLOC, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(SET_Data));
         return NULL;
     }
 
-    // Go through string
-    bool InString = false;
-    bool InChar = false;
-    bool StringSpecial = false;
-    bool Leading = true;
-    char *DstString = NewString;
-    bool LineComment = false;
-    bool MultilineComment = false;
-    char *SpecialCharList = NULL;
-    char *EndSpecialCharList = _SET_SpecialChar + _SET_SpecialCharLength;
+    SET_InitData(Data);
 
-    for (const char *Current = String; *Current != '\0'; ++Current)
+    // List
+    if (Depth > 0)
     {
-        // Skip if in line comment
-        if (LineComment)
+        Data->data.list = _SET_ReverseList(*(void * const *)Value, Table, Depth);
+
+        if (Data->data.list == NULL)
         {
-            // Test if it should stop
-            if (LineComment && *Current == '\n')
-                LineComment = false;
+            _SET_AddError(_SET_ERRORID_REVERSEELEMENT_LIST, _SET_ERRORMES_REVERSELIST);
+            free(Data);
+            return NULL;
+        }
 
-            continue;
+        Data->type = SET_DATATYPE_LIST;
+    }
+
+    // Another struct
+    else if (Table->type == SET_DATATYPE_STRUCT)
+    {
+        if (Table->sub == NULL)
+        {
+            _SET_SetError(_SET_ERRORID_REVERSEELEMENT_NOSTRUCT, _SET_ERRORMES_MISSINGSUB);
+            free(Data);
+            return NULL;
         }
 
-        // Skip if in multiline comment
-        if (MultilineComment)
+        Data->data.stct = _SET_ReverseStruct(Value, Table->sub, Table->count);
+
+        if (Data->data.stct == NULL)
         {
-            // Test if it should stop
-            if (*Current == '*' && *(Current + 1) == '/')
-            {
-                MultilineComment = false;
-                ++Current;
-            }
+            _SET_AddError(_SET_ERRORID_REVERSEELEMENT_STRUCT, _SET_ERRORMES_CONVERTSTRUCT);
+            free(Data);
+            return NULL;
+        }
 
-            continue;
+        Data->type = SET_DATATYPE_STRUCT;
+    }
+
+    // A string
+    else if (Table->type == SET_DATATYPE_STR)
+    {
+        const char *String = *(char * const *)Value;
+
+        if (String == NULL)
+        {
+            _SET_SetError(_SET_ERRORID_REVERSEELEMENT_NULL, _SET_ERRORMES_FIELDNULL);
+            free(Data);
+            return NULL;
         }
 
-        // Skip if it is a newline or tab
-        if (*Current == '\n' || *Current == '\t')
-            continue;
+        size_t Size = strlen(String) + 1;
+        Data->data.str = (char *)malloc(sizeof(char) * Size);
 
-        // Do stuff outside of strings
-        if (!InString && !InChar)
+        if (Data->data.str == NULL)
         {
-            // Start comments
-            if (*Current == '/')
-            {
-                if (*(Current + 1) == '/')
-                {
-                    LineComment = true;
-                    ++Current;
-                    continue;
-                }
+            _SET_AddErrorForeign(_SET_ERRORID_REVERSEELEMENT_MALLOC2, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(char) * Size);
+            free(Data);
+            return NULL;
+        }
 
-                if (*(Current + 1) == '*')
-                {
-                    MultilineComment = true;
-                    ++Current;
-                    continue;
-                }
-            }
+        memcpy(Data->data.str, String, sizeof(char) * Size);
+        Data->type = SET_DATATYPE_STR;
+    }
 
-            // Remove leading spaces
-            if (Leading)
-            {
-                if (*Current == ' ')
-                    continue;
+    // A number or char
+    else if (Table->type >= SET_DATATYPE_BOOL && Table->type <= SET_DATATYPE_CHAR)
+    {
+        memcpy(&Data->data, Value, _SET_TypeSize(Table->type));
+        Data->type = Table->type;
+    }
 
-                else
-                    Leading = false;
-            }
+    // Error
+    else
+    {
+        _SET_SetError(_SET_ERRORID_REVERSEELEMENT_TYPE, _SET_ERRORMES_WRONGTYPE, Table->type);
+        free(Data);
+        return NULL;
+    }
 
-            // Start a string
-            if (*Current == '\"')
-                InString = true;
+    return Data;
+}
 
-            // Start char
-            if (*Current == '\'')
-                InChar = true;
+SET_DataList *_SET_ReverseList(const void *List, const SET_TranslationTable *Table, uint8_t Depth)
+{
+    extern _Atomic bool _SET_PackLists;
 
-            // Find space ignoring characters
-            for (SpecialCharList = _SET_SpecialChar; SpecialCharList < EndSpecialCharList; ++SpecialCharList)
-                if (*Current == *SpecialCharList)
-                    break;
+    if (List == NULL)
+    {
+        _SET_SetError(_SET_ERRORID_REVERSELIST_NULL, _SET_ERRORMES_FIELDNULL);
+        return NULL;
+    }
 
-            if (SpecialCharList < EndSpecialCharList)
-            {
-                Leading = true;
+    if (Table->length == 0 || Table->length > UINT32_MAX)
+    {
+        _SET_SetError(_SET_ERRORID_REVERSELIST_LENGTH, _SET_ERRORMES_LISTLENGTH, Table->name, Table->length);
+        return NULL;
+    }
 
-                // Remove trailing spaces
-                while (DstString > NewString && *(DstString - 1) == ' ')
-                    DstString -= 1;
-            }
-        }
+    SET_DataList *DataList = (SET_DataList *)malloc(sizeof(SET_DataList));
 
-        // Do stuff in strings
-        else if (!StringSpecial)
-        {
-            // Start a special character
-            if (*Current == '\\')
-                StringSpecial = true;
+    if (DataList == NULL)
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_REVERSELIST_MALLOC, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(SET_DataList));
+        return NULL;
+    }
 
-            // End the string
-            if (*Current == '\"')
-                InString = false;
+    SET_InitDataList(DataList);
+    DataList->count = (uint32_t)Table->length;
+    DataList->type = Table->type;
+    DataList->depth = Depth;
 
-            // End the char
-            if (*Current == '\'')
-                InChar = false;
+    // Numbers, bools and chars are packed like when loading so they are copied at once
+    size_t Size = _SET_TypeSize(Table->type);
+
+    if (Depth == 1 && Table->type != SET_DATATYPE_STR && Size > 0 && atomic_load(&_SET_PackLists))
+    {
+        DataList->packed = malloc(Size * DataList->count);
+
+        if (DataList->packed == NULL)
+        {
+            _SET_AddErrorForeign(_SET_ERRORID_REVERSELIST_MALLOC2, strerror(errno), _SET_ERRORMES_MALLOC, Size * DataList->count);
+            SET_DestroyDataList(DataList);
+            return NULL;
         }
 
-        // End special character
-        else
-            StringSpecial = false;
+        memcpy(DataList->packed, List, Size * DataList->count);
+        return DataList;
+    }
 
-        // Add character to new string
-        *DstString++ = *Current;
+    // Everything else gets a value for each element
+    DataList->list = (SET_Data **)malloc(sizeof(SET_Data *) * DataList->count);
+
+    if (DataList->list == NULL)
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_REVERSELIST_MALLOC2, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(SET_Data *) * DataList->count);
+        SET_DestroyDataList(DataList);
+        return NULL;
     }
 
-    *DstString++ = '\0';
+    for (SET_Data **InitList = DataList->list, **EndInitList = DataList->list + DataList->count; InitList < EndInitList; ++InitList)
+        *InitList = NULL;
 
-    // Shorten string
-    Size = DstString - NewString;
-    NewString = (char *)realloc(NewString, sizeof(char) * Size);
+    if (Depth > 1)
+        Size = sizeof(void *);
 
-    if (NewString == NULL)
+    else if (Table->type == SET_DATATYPE_STRUCT)
+        Size = Table->size;
+
+    for (uint32_t Pos = 0; Pos < DataList->count; ++Pos)
     {
-        _SET_AddErrorForeign(_SET_ERRORID_CLEANSTRING_REALLOC, strerror(errno), _SET_ERRORMES_REALLOC, Size);
-        return NULL;
+        DataList->list[Pos] = _SET_ReverseElement(List + Size * Pos, Table, Depth - 1);
+
+        if (DataList->list[Pos] == NULL)
+        {
+            _SET_AddError(_SET_ERRORID_REVERSELIST_ELEMENT, _SET_ERRORMES_CONVERTLIST2, _SET_ELEMENTPREMES, (size_t)Pos);
+            SET_DestroyDataList(DataList);
+            return NULL;
+        }
     }
 
-    return NewString;
+    return DataList;
 }
 
-SET_CodeStruct *_SET_SplitString(char *String)
+void SET_PackLists(bool Pack)
 {
-    // Get memory for the struct
-    SET_CodeStruct *CodeStruct = (SET_CodeStruct *)malloc(sizeof(SET_CodeStruct));
+    extern _Atomic bool _SET_PackLists;
 
-    if (CodeStruct == NULL)
+    atomic_store(&_SET_PackLists, Pack);
+}
+
+SET_Data SET_ListElement(const SET_DataList *List, uint32_t Index)
+{
+    if (List->packed == NULL)
+        return *List->list[Index];
+
+    SET_Data Data;
+    SET_InitData(&Data);
+
+    size_t Size = _SET_TypeSize(List->type);
+    memcpy(&Data.data, (const uint8_t *)List->packed + Size * Index, Size);
+    Data.type = List->type;
+
+    return Data;
+}
+
+SET_Path *SET_CompilePath(const char *Path)
+{
+    extern const uint8_t _SET_CharClass[];
+
+    SET_Path *Compiled = (SET_Path *)malloc(sizeof(SET_Path));
+
+    if (Compiled == NULL)
     {
-        _SET_AddErrorForeign(_SET_ERRORID_SPLITSTRING_MALLOCSTRUCT, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(SET_CodeStruct));
+        _SET_AddErrorForeign(_SET_ERRORID_COMPILEPATH_MALLOC, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(SET_Path));
         return NULL;
     }
 
-    SET_InitCodeStruct(CodeStruct);
+    SET_InitPath(Compiled);
 
-    if (String[0] == '\0')
-        return CodeStruct;
+    // The hashes of the names are only valid for the hash of the dicts
+    if (!DIC_AcquireHash())
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_COMPILEPATH_HASH, DIC_GetError(), _SET_ERRORMES_ACQUIREHASH);
+        free(Compiled);
+        return NULL;
+    }
 
-    // Go through the string and split it
-    char *TypeString = NULL;
-    char *NameString = NULL;
-    char *Current = String;
-    int32_t ListCount = 0;
-    int32_t StructCount = 0;
-    uint8_t PointerCount = 0;
-    bool InString = false;
-    bool FoundType = false;
-    bool AfterEqual = false;
+    // Every segment after the first starts with . or [, the names are copied into Name to terminate them
+    size_t Length = strlen(Path);
+    size_t Count = 1;
 
-    for (char *LastStart = String; *Current != '\0'; ++Current)
+    for (const char *Current = Path; *Current != '\0'; ++Current)
+        if (*Current == '.' || *Current == '[')
+            ++Count;
+
+    Compiled->segments = (SET_PathSegment *)malloc(sizeof(SET_PathSegment) * Count);
+    char *Name = (char *)malloc(sizeof(char) * (Length + 1));
+
+    if (Compiled->segments == NULL || Name == NULL)
     {
-        // Start or end a string
-        if (*Current == '\"')
-            InString = !InString;
+        _SET_AddErrorForeign(_SET_ERRORID_COMPILEPATH_MALLOC2, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(SET_PathSegment) * Count + sizeof(char) * (Length + 1));
 
-        if (InString)
-        {
-            // Do special character
-            if (*Current == '\\' && *(Current + 1) != '\0')
-                ++Current;
+        if (Name != NULL)
+            free(Name);
 
-            continue;
-        }
+        SET_DestroyPath(Compiled);
+        return NULL;
+    }
 
-        // Skip a char
-        if (*Current == '\'')
+    const char *Current = Path;
+    bool Field = true;
+
+    while (true)
+    {
+        SET_PathSegment *Segment = Compiled->segments + Compiled->count;
+        SET_InitPathSegment(Segment);
+
+        if (Field)
         {
-            uint32_t WithSpecial = 0;
+            // Read the name
+            size_t NameLength = 0;
 
-            // With special character
-            if (*(Current + 1) == '\\')
-                WithSpecial = 1;
+            while (!(_SET_CharClass[(uint8_t)Current[NameLength]] & _SET_CHARCLASS_WORDEND) && Current[NameLength] != '.')
+                ++NameLength;
 
-            // Test if it stops
-            if (*(Current + WithSpecial + 1) == '\0')
+            if (NameLength == 0)
             {
-                _SET_SetError(_SET_ERRORID_SPLITSTRING_STOPCHAR, _SET_ERRORMES_EARLYSTOPCHAR, _SET_LINEPREMES, CodeStruct->count + 1);
-                SET_DestroyCodeStruct(CodeStruct);
+                _SET_SetError(_SET_ERRORID_COMPILEPATH_NAME, _SET_ERRORMES_PATHNAME, _SET_POSITIONPREMES, (size_t)(Current - Path));
+                free(Name);
+                SET_DestroyPath(Compiled);
                 return NULL;
             }
 
-            // Make sure it ends
-            if (*(Current + WithSpecial + 2) != '\'')
+            memcpy(Name, Current, NameLength);
+            Name[NameLength] = '\0';
+            Current += NameLength;
+
+            // Interning makes the lookups compare pointers with interned keys
+            Segment->name = DIC_Intern(Name);
+
+            if (Segment->name == NULL)
             {
-                _SET_SetError(_SET_ERRORID_SPLITSTRING_NOSTOPCHAR, _SET_ERRORMES_NOSTOPCHAR, _SET_LINEPREMES, CodeStruct->count + 1);
-                SET_DestroyCodeStruct(CodeStruct);
+                _SET_AddErrorForeign(_SET_ERRORID_COMPILEPATH_INTERN, DIC_GetError(), _SET_ERRORMES_INTERNNAME, Name);
+                free(Name);
+                SET_DestroyPath(Compiled);
                 return NULL;
             }
 
-            // Skip till the end
-            Current += 2 + WithSpecial;
-            continue;
+            Segment->hash = DIC_HashKey(Segment->name);
         }
 
-        // Start or end list and structs
-        if (*Current == '[')
-            ++ListCount;
+        else
+        {
+            // Read the index
+            uint64_t Index = 0;
+            const char *Start = Current;
 
-        else if (*Current == ']')
-            --ListCount;
+            for (; *Current >= '0' && *Current <= '9' && Index <= UINT32_MAX; ++Current)
+                Index = Index * 10 + (uint64_t)(*Current - '0');
 
-        else if (*Current == '{')
-            ++StructCount;
+            if (Current == Start || Index > UINT32_MAX || *Current != ']')
+            {
+                _SET_SetError(_SET_ERRORID_COMPILEPATH_INDEX, _SET_ERRORMES_PATHINDEX, _SET_POSITIONPREMES, (size_t)(Start - Path));
+                free(Name);
+                SET_DestroyPath(Compiled);
+                return NULL;
+            }
 
-        else if (*Current == '}')
-            --StructCount;
+            Segment->index = (uint32_t)Index;
+            ++Current;
+        }
 
-        // Do the rest
-        else if (ListCount == 0 && StructCount == 0)
+        ++Compiled->count;
+
+        // Find the kind of the next segment
+        if (*Current == '\0')
+            break;
+
+        if (*Current == '.')
+            Field = true;
+
+        else if (*Current == '[')
+            Field = false;
+
+        else
         {
-            // Look for type-name separator
-            if (*Current == ' ' || (!AfterEqual && *Current == '*'))
-            {
-                // if there is an error
-                if (AfterEqual)
-                {
-                    _SET_SetError(_SET_ERRORID_SPLITSTRING_SPACEINVALUE, _SET_ERRORMES_SPACEINVALUE, _SET_LINEPREMES, CodeStruct->count + 1);
-                    SET_DestroyCodeStruct(CodeStruct);
-                    return NULL;
-                }
+            _SET_SetError(_SET_ERRORID_COMPILEPATH_SEPARATOR, _SET_ERRORMES_PATHSEPARATOR, _SET_POSITIONPREMES, (size_t)(Current - Path), *Current);
+            free(Name);
+            SET_DestroyPath(Compiled);
+            return NULL;
+        }
 
-                if (FoundType)
-                {
-                    _SET_SetError(_SET_ERRORID_SPLITSTRING_TYPETWICE, _SET_ERRORMES_TYPETWICE, _SET_LINEPREMES, CodeStruct->count + 1);
-                    SET_DestroyCodeStruct(CodeStruct);
-                    return NULL;
-                }
+        ++Current;
+    }
 
-                // Count the pointer depth
-                if (*Current == '*')
-                {
-                    PointerCount = 1;
-                    *Current = '\0';
+    free(Name);
+    return Compiled;
+}
 
-                    while (*(Current + 1) == '*')
-                    {
-                        ++PointerCount;
-                        ++Current;
-                    }
-                }     
+SET_Data SET_Query(SET_DataStruct *Data, const SET_Path *Path)
+{
+    SET_Data Value;
+    SET_InitData(&Value);
+    Value.data.stct = Data;
+    Value.type = SET_DATATYPE_STRUCT;
 
-                // Add the type
-                TypeString = LastStart;
-                LastStart = Current + 1;
-                *Current = '\0';
-                FoundType = true;
-                continue;
+    for (const SET_PathSegment *Segment = Path->segments, *EndSegment = Path->segments + Path->count; Segment < EndSegment; ++Segment)
+    {
+        // Go into a struct
+        if (Segment->name != NULL)
+        {
+            if (Value.type != SET_DATATYPE_STRUCT)
+            {
+                _SET_SetError(_SET_ERRORID_QUERY_STRUCT, _SET_ERRORMES_QUERYSTRUCT, Segment->name);
+                Value.type = SET_DATATYPE_NONE;
+                return Value;
             }
 
-            // Look for name-value separator
-            if (*Current == '=')
+            SET_Data *Item = (SET_Data *)DIC_GetItemHashed(Value.data.stct, Segment->name, Segment->hash);
+
+            if (Item == NULL)
             {
-                // If there is an error
-                if (AfterEqual)
-                {
-                    _SET_SetError(_SET_ERRORID_SPLITSTRING_VALUETWICE, _SET_ERRORMES_VALUETWICE, _SET_LINEPREMES, CodeStruct->count + 1);
-                    SET_DestroyCodeStruct(CodeStruct);
-                    return NULL;
-                }
+                _SET_AddErrorForeign(_SET_ERRORID_QUERY_FIELD, DIC_GetError(), _SET_ERRORMES_MISSINGFIELD, Segment->name);
+                Value.type = SET_DATATYPE_NONE;
+                return Value;
+            }
 
-                // Add name
-                NameString = LastStart;
-                LastStart = Current + 1;
-                *Current = '\0';
-                AfterEqual = true;
-                continue;
+            Value = *Item;
+        }
+
+        // Go into a list
+        else
+        {
+            if (Value.type != SET_DATATYPE_LIST)
+            {
+                _SET_SetError(_SET_ERRORID_QUERY_LIST, _SET_ERRORMES_QUERYLIST, Segment->index);
+                Value.type = SET_DATATYPE_NONE;
+                return Value;
             }
 
-            // Look for line stop
-            if (*Current == ';')
+            if (Segment->index >= Value.data.list->count)
             {
-                // If there is an error
-                if (!AfterEqual)
-                {
-                    _SET_SetError(_SET_ERRORID_SPLITSTRING_NOVALUE, _SET_ERRORMES_NOVALUE, _SET_LINEPREMES, CodeStruct->count + 1);
-                    SET_DestroyCodeStruct(CodeStruct);
-                    return NULL;
-                }
+                _SET_SetError(_SET_ERRORID_QUERY_INDEX, _SET_ERRORMES_QUERYINDEX, Segment->index, Value.data.list->count);
+                Value.type = SET_DATATYPE_NONE;
+                return Value;
+            }
 
-                // Allocate memory for new line
-                SET_CodeName **NewNames = (SET_CodeName **)realloc(CodeStruct->names, sizeof(SET_CodeName *) * (CodeStruct->count + 1));
+            Value = SET_ListElement(Value.data.list, Segment->index);
+        }
+    }
 
-                if (NewNames == NULL)
-                {
-                    _SET_SetError(_SET_ERRORID_SPLITSTRING_REALLOC, _SET_ERRORMES_REALLOC, sizeof(SET_CodeName *) * (CodeStruct->count + 1));
-                    SET_DestroyCodeStruct(CodeStruct);
-                    return NULL;
-                }
+    return Value;
+}
 
-                CodeStruct->names = NewNames;
+SET_DataStruct *SET_LoadSettings(const char *FileName)
+{
+    // Find the state of the file before loading it so a change while loading makes the cache outdated
+    SET_CacheHeader Source;
+    bool HasSource = _SET_StatSource(&Source, FileName);
 
-                CodeStruct->names[CodeStruct->count] = (SET_CodeName *)malloc(sizeof(SET_CodeName));
+    // Load file
+    char *String = FIL_Load(FileName);
 
-                if (CodeStruct->names[CodeStruct->count] == NULL)
-                {
-                    _SET_SetError(_SET_ERRORID_SPLITSTRING_MALLOC, _SET_ERRORMES_MALLOC, sizeof(SET_CodeName));
-                    SET_DestroyCodeStruct(CodeStruct);
-                    return NULL;
-                }
+    if (String == NULL)
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_LOADSETTINGS_LOAD, FIL_GetError(), _SET_ERRORMES_LOADFILE, FileName);
+        return NULL;
+    }
 
-                SET_InitCodeName(CodeStruct->names[CodeStruct->count]);
+    // Use the cache if it is up to date
+    if (HasSource)
+    {
+        SET_DataStruct *Cached = _SET_LoadCache(FileName, &Source, String, NULL, NULL, NULL);
 
-                SET_CodeValue **NewValues = (SET_CodeValue **)realloc(CodeStruct->values, sizeof(SET_CodeValue *) * (CodeStruct->count + 1));
+        if (Cached != NULL)
+        {
+            free(String);
+            return Cached;
+        }
+    }
 
-                if (NewValues == NULL)
-                {
-                    _SET_SetError(_SET_ERRORID_SPLITSTRING_REALLOC2, _SET_ERRORMES_REALLOC, sizeof(SET_CodeValue *) * (CodeStruct->count + 1));
-                    SET_DestroyCodeStruct(CodeStruct);
-                    return NULL;
-                }
+    SET_DataStruct *Result = _SET_ParseText(String, NULL, NULL, false);
+    free(String);
 
-                CodeStruct->values = NewValues;
+    if (Result == NULL)
+    {
+        _SET_AddError(_SET_ERRORID_LOADSETTINGS_PARSE, _SET_ERRORMES_PARSEFILE, FileName);
+        return NULL;
+    }
 
-                CodeStruct->values[CodeStruct->count] = (SET_CodeValue *)malloc(sizeof(SET_CodeValue));
+    return Result;
+}
 
-                if (CodeStruct->values[CodeStruct->count] == NULL)
-                {
-                    _SET_SetError(_SET_ERRORID_SPLITSTRING_MALLOC2, _SET_ERRORMES_MALLOC, sizeof(SET_CodeValue));
-                    SET_DestroyCodeStruct(CodeStruct);
-                    return NULL;
-                }
+SET_Settings *SET_LoadSettingsArena(const char *FileName)
+{
+    // Find the state of the file before loading it so a change while loading makes the cache outdated
+    SET_CacheHeader Source;
+    bool HasSource = _SET_StatSource(&Source, FileName);
 
-                SET_InitCodeValue(CodeStruct->values[CodeStruct->count]);
+    // Load file
+    char *String = FIL_Load(FileName);
 
-                // Add the new line
-                NewValues[CodeStruct->count]->type = SET_VALUETYPE_VALUE;
-                NewValues[CodeStruct->count]->value.value = LastStart;
-                NewNames[CodeStruct->count]->type = TypeString;
-                NewNames[CodeStruct->count]->pointer = PointerCount;
-                NewNames[CodeStruct->count++]->name = NameString;
+    if (String == NULL)
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_LOADSETTINGSARENA_LOAD, FIL_GetError(), _SET_ERRORMES_LOADFILE, FileName);
+        return NULL;
+    }
 
-                // Update the string
-                LastStart = Current + 1;
-                *Current = '\0';
-                AfterEqual = false;
-                FoundType = false;
-                TypeString = NULL;
-                NameString = NULL;
-                PointerCount = 0;
-                continue;
-            }
-        }
+    SET_Settings *Settings = (SET_Settings *)malloc(sizeof(SET_Settings));
+
+    if (Settings == NULL)
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_LOADSETTINGSARENA_MALLOC, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(SET_Settings));
+        free(String);
+        return NULL;
     }
 
-    // Make sure it is not inside of a string
-    if (InString)
+    SET_InitSettings(Settings);
+
+    // The tree takes up about as much memory as the text, so start with a block of that size
+    Settings->arena = ARN_CreateArena(strlen(String));
+
+    if (Settings->arena == NULL)
     {
-        _SET_SetError(_SET_ERRORID_SPLITSTRING_ENDSTRING, _SET_ERRORMES_ENDSTRING, _SET_LINEPREMES, CodeStruct->count + 1);
-        SET_DestroyCodeStruct(CodeStruct);
+        _SET_AddErrorForeign(_SET_ERRORID_LOADSETTINGSARENA_ARENA, ARN_GetError(), _SET_ERRORMES_CREATEARENA);
+        free(Settings);
+        free(String);
         return NULL;
     }
 
-    // Make sure it ended with a line end
-    if (*(Current - 1) != '\0' || FoundType || AfterEqual)
+    // The dicts in the arena need the hash table for as long as the settings exist
+    if (!DIC_AcquireHash())
     {
-        _SET_SetError(_SET_ERRORID_SPLITSTRING_END, _SET_ERRORMES_WRONGEND);
-        SET_DestroyCodeStruct(CodeStruct);
+        _SET_AddErrorForeign(_SET_ERRORID_LOADSETTINGSARENA_HASH, DIC_GetError(), _SET_ERRORMES_ACQUIREHASH);
+        ARN_DestroyArena(Settings->arena);
+        free(Settings);
+        free(String);
         return NULL;
     }
 
-    // Convert values into structs and lists
-    for (SET_CodeValue **List = CodeStruct->values, **EndList = CodeStruct->values + CodeStruct->count; List < EndList; ++List)
-        // Split the value
-        if (!_SET_SplitValue(*List))
+    // Use the cache if it is up to date, the names and strings then point into the cache instead of the text
+    if (HasSource)
+    {
+        Settings->data = _SET_LoadCache(FileName, &Source, String, Settings->arena, &Settings->map, &Settings->mapSize);
+
+        if (Settings->data != NULL)
         {
-            _SET_AddError(_SET_ERRORID_SPLITSTRING_SPLITVALUE, _SET_ERRORMES_SPLITVALUE, _SET_LINEPREMES, CodeStruct->count + 1);
-            SET_DestroyCodeStruct(CodeStruct);
-            return NULL;
+            free(String);
+            return Settings;
         }
+    }
 
-    // Return the struct
-    return CodeStruct;
-}
+    // The text is kept since the names and strings point into it
+    Settings->text = String;
+    Settings->data = _SET_ParseText(String, NULL, Settings->arena, true);
 
-bool _SET_SplitValue(SET_CodeValue *Value)
-{
-    if (Value->value.value[0] == '\0')
+    if (Settings->data == NULL)
     {
-        _SET_SetError(_SET_ERRORID_SPLITVALUE_NOVALUE, _SET_ERRORMES_NOVALUE2);
-        return false;
+        _SET_AddError(_SET_ERRORID_LOADSETTINGSARENA_PARSE, _SET_ERRORMES_PARSEFILE, FileName);
+        SET_DestroySettings(Settings);
+        return NULL;
     }
 
-    // Check for a structs
-    if (*Value->value.value == '{')
-    {
-        // Make sure it ends with }
-        size_t Length = strlen(Value->value.value);
-
-        if (Value->value.value[Length - 1] != '}')
-        {
-            _SET_SetError(_SET_ERRORID_SPLITVALUE_ENDSTRUCT, _SET_ERRORMES_ENDSTRUCT);
-            return false;
-        }
+    return Settings;
+}
 
-        // Split the struct
-        Value->value.value[Length - 1] = '\0';
-        SET_CodeStruct *StructValue = _SET_SplitString(Value->value.value + 1);
+SET_DataStruct *SET_LoadSettingsParallel(const char *FileName, uint32_t ThreadCount)
+{
+    // Find the state of the file before loading it so a change while loading makes the cache outdated
+    SET_CacheHeader Source;
+    bool HasSource = _SET_StatSource(&Source, FileName);
 
-        if (StructValue == NULL)
-        {
-            _SET_AddError(_SET_ERRORID_SPLITVALUE_CREATESUBSTRUCT, _SET_ERRORMES_SUBSTRUCT);
-            return false;
-        }
+    // Load file
+    char *String = FIL_Load(FileName);
 
-        // Update the value
-        Value->type = SET_VALUETYPE_STRUCT;
-        Value->value.sub = StructValue;
+    if (String == NULL)
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_LOADSETTINGSPARALLEL_LOAD, FIL_GetError(), _SET_ERRORMES_LOADFILE, FileName);
+        return NULL;
     }
 
-    // Check for a list
-    else if (*Value->value.value == '[')
+    // Use the cache if it is up to date
+    if (HasSource)
     {
-        // Make sure it ends with ]
-        size_t Length = strlen(Value->value.value);
+        SET_DataStruct *Cached = _SET_LoadCache(FileName, &Source, String, NULL, NULL, NULL);
 
-        if (Value->value.value[Length - 1] != ']')
+        if (Cached != NULL)
         {
-            _SET_SetError(_SET_ERRORID_SPLITVALUE_ENDLIST, _SET_ERRORMES_ENDLIST);
-            return false;
+            free(String);
+            return Cached;
         }
+    }
 
-        // Split the list
-        Value->value.value[Length - 1] = '\0';
-        SET_CodeList *ListValues = _SET_SplitList(Value->value.value + 1);
+    SET_DataStruct *Result = _SET_ParseTextParallel(String, ThreadCount);
+    free(String);
 
-        if (ListValues == NULL)
-        {
-            _SET_AddError(_SET_ERRORID_SPLITVALUE_CREATELIST, _SET_ERRORMES_SUBLIST);
-            return false;
-        }
-
-        // Update the value
-        Value->type = SET_VALUETYPE_LIST;
-        Value->value.list = ListValues;
+    if (Result == NULL)
+    {
+        _SET_AddError(_SET_ERRORID_LOADSETTINGSPARALLEL_PARSE, _SET_ERRORMES_PARSEFILE, FileName);
+        return NULL;
     }
 
-    return true;
+    return Result;
 }
 
-SET_CodeList *_SET_SplitList(char *String)
+SET_LazySettings *SET_LoadSettingsLazy(const char *FileName)
 {
-    // Get memory for the struct
-    SET_CodeList *CodeList = (SET_CodeList *)malloc(sizeof(SET_CodeList));
+    SET_LazySettings *Settings = (SET_LazySettings *)malloc(sizeof(SET_LazySettings));
 
-    if (CodeList == NULL)
+    if (Settings == NULL)
     {
-        _SET_AddErrorForeign(_SET_ERRORID_SPLITLIST_MALLOCSTRUCT, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(SET_CodeList));
+        _SET_AddErrorForeign(_SET_ERRORID_LOADSETTINGSLAZY_MALLOC, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(SET_LazySettings));
         return NULL;
     }
 
-    SET_InitCodeList(CodeList);
-
-    if (String[0] == '\0')
-        return CodeList;
+    SET_InitLazySettings(Settings);
 
-    // Get first memory for list
-    CodeList->list = (SET_CodeValue **)malloc(sizeof(SET_CodeValue *));
+    // Load file, it is kept since the names and values point into it
+    Settings->text = FIL_Load(FileName);
 
-    if (CodeList->list == NULL)
+    if (Settings->text == NULL)
     {
-        _SET_AddErrorForeign(_SET_ERRORID_SPLITLIST_MALLOCLIST, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(SET_CodeValue *));
-        SET_DestroyCodeList(CodeList);
+        _SET_AddErrorForeign(_SET_ERRORID_LOADSETTINGSLAZY_LOAD, FIL_GetError(), _SET_ERRORMES_LOADFILE, FileName);
+        SET_DestroyLazySettings(Settings);
         return NULL;
     }
 
-    *CodeList->list = (SET_CodeValue *)malloc(sizeof(SET_CodeValue));
+    // Load type dict, it is kept for parsing the values later
+    Settings->types = _SET_BuildTypeDict();
 
-    if (*CodeList->list == NULL)
+    if (Settings->types == NULL)
     {
-        _SET_AddErrorForeign(_SET_ERRORID_SPLITLIST_MALLOCLIST2, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(SET_CodeValue));
-        SET_DestroyCodeList(CodeList);
+        _SET_AddError(_SET_ERRORID_LOADSETTINGSLAZY_TYPEDICT, _SET_ERRORMES_TYPEDICT);
+        SET_DestroyLazySettings(Settings);
         return NULL;
     }
 
-    SET_InitCodeValue(*CodeList->list);
-
-    char *LastStart = String;
-    int32_t ListCount = 0;
-    int32_t StructCount = 0;
-    bool InString = false;
+    // Find the names of the fields and skip their values
+    SET_Stream Stream;
+    SET_InitStream(&Stream);
+    Stream.pos = Settings->text;
+    Stream.types = Settings->types;
+    size_t Capacity = 0;
 
-    for (char *Current = String; *Current != '\0'; ++Current)
+    for (_SET_SkipBlank(&Stream); *Stream.pos != '\0'; _SET_SkipBlank(&Stream))
     {
-        // Start or end a string
-        if (*Current == '\"')
-            InString = !InString;
+        uint32_t Line = Stream.line;
 
-        if (InString)
-        {
-            // Do special character
-            if (*Current == '\\' && *(Current + 1) != '\0')
-                ++Current;
+        // Read the type and name
+        char *NameString;
+        SET_DataType Type;
+        uint8_t PointerCount;
 
-            continue;
+        if (!_SET_ParseName(&Stream, &NameString, &Type, &PointerCount))
+        {
+            _SET_AddError(_SET_ERRORID_LOADSETTINGSLAZY_NAME, _SET_ERRORMES_PARSENAME, _SET_LINEPREMES, (size_t)Line);
+            SET_DestroyLazySettings(Settings);
+            return NULL;
         }
 
-        // Skip a char
-        if (*Current == '\'')
+        // Get memory for the field
+        if (Settings->count == Capacity)
         {
-            uint32_t WithSpecial = 0;
-
-            // With special character
-            if (*(Current + 1) == '\\')
-                WithSpecial = 1;
+            size_t NewCapacity = ((Capacity == 0) ? (_SET_STREAMSIZE) : (Capacity * 2));
+            SET_LazyField *NewFields = (SET_LazyField *)realloc(Settings->fields, sizeof(SET_LazyField) * NewCapacity);
 
-            // Test if it stops
-            if (*(Current + WithSpecial + 1) == '\0')
+            if (NewFields == NULL)
             {
-                _SET_SetError(_SET_ERRORID_SPLITLIST_STOPCHAR, _SET_ERRORMES_EARLYSTOPCHAR, _SET_ELEMENTPREMES, CodeList->count + 1);
-                SET_DestroyCodeList(CodeList);
+                _SET_AddErrorForeign(_SET_ERRORID_LOADSETTINGSLAZY_REALLOC, strerror(errno), _SET_ERRORMES_REALLOC, sizeof(SET_LazyField) * NewCapacity);
+                SET_DestroyLazySettings(Settings);
                 return NULL;
             }
 
-            // Make sure it ends
-            if (*(Current + WithSpecial + 2) != '\'')
-            {
-                _SET_SetError(_SET_ERRORID_SPLITLIST_NOSTOPCHAR, _SET_ERRORMES_NOSTOPCHAR, _SET_ELEMENTPREMES, CodeList->count + 1);
-                SET_DestroyCodeList(CodeList);
-                return NULL;
-            }
+            Settings->fields = NewFields;
+            Capacity = NewCapacity;
+        }
 
-            // Skip till the end
-            Current += 2 + WithSpecial;
-            continue;
+        SET_LazyField *Field = Settings->fields + Settings->count++;
+        SET_InitLazyField(Field);
+        Field->name = NameString;
+        Field->start = Stream.pos;
+        Field->line = Stream.line;
+        Field->type = Type;
+        Field->depth = PointerCount;
+
+        // Find the end of the value
+        if (!_SET_SkipValue(&Stream))
+        {
+            _SET_AddError(_SET_ERRORID_LOADSETTINGSLAZY_SKIP, _SET_ERRORMES_SKIPVALUE, _SET_LINEPREMES, (size_t)Line);
+            SET_DestroyLazySettings(Settings);
+            return NULL;
         }
 
-        // Start or end list and structs
-        if (*Current == '[')
-            ++ListCount;
+        Field->length = Stream.pos - Field->start;
+        ++Stream.pos;
+    }
 
-        else if (*Current == ']')
-            --ListCount;
+    // Create the index, the names point into the text
+    Settings->index = DIC_CreateDict((Settings->count > 0) ? (Settings->count) : (1));
 
-        else if (*Current == '{')
-            ++StructCount;
+    if (Settings->index == NULL)
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_LOADSETTINGSLAZY_CREATEDICT, DIC_GetError(), _SET_ERRORMES_CREATEDICT);
+        SET_DestroyLazySettings(Settings);
+        return NULL;
+    }
 
-        else if (*Current == '}')
-            --StructCount;
+    DIC_BorrowKeys(Settings->index);
 
-        // End element
-        else if (ListCount == 0 && StructCount == 0 && *Current == ',')
+    for (SET_LazyField *List = Settings->fields, *EndList = Settings->fields + Settings->count; List < EndList; ++List)
+    {
+        if (DIC_CheckItem(Settings->index, List->name))
         {
-            // Get memory for the list
-            SET_CodeValue **NewList = (SET_CodeValue **)realloc(CodeList->list, sizeof(SET_CodeValue *) * (CodeList->count + 2));
+            _SET_SetError(_SET_ERRORID_LOADSETTINGSLAZY_DUBLICATE, _SET_ERRORMES_DUBLICATE, _SET_LINEPREMES, (size_t)List->line);
+            SET_DestroyLazySettings(Settings);
+            return NULL;
+        }
 
-            if (NewList == NULL)
-            {
-                _SET_SetError(_SET_ERRORID_SPLITLIST_REALLOCLIST, _SET_ERRORMES_REALLOC, sizeof(SET_CodeValue *) * (CodeList->count + 2));
-                SET_DestroyCodeList(CodeList);
-                return NULL;
-            }
+        if (!DIC_AddItem(Settings->index, List->name, (void *)List, 0, DIC_MODE_POINTER))
+        {
+            _SET_AddErrorForeign(_SET_ERRORID_LOADSETTINGSLAZY_ADDITEM, DIC_GetError(), _SET_ERRORMES_DICTADD, List->name);
+            SET_DestroyLazySettings(Settings);
+            return NULL;
+        }
+    }
 
-            CodeList->list = NewList;
+    return Settings;
+}
 
-            CodeList->list[CodeList->count + 1] = (SET_CodeValue *)malloc(sizeof(SET_CodeValue));
+SET_Data *SET_LazyGet(SET_LazySettings *Settings, const char *Name)
+{
+    SET_LazyField *Field = (SET_LazyField *)DIC_GetItem(Settings->index, Name);
 
-            if (CodeList->list[CodeList->count + 1] == NULL)
-            {
-                _SET_SetError(_SET_ERRORID_SPLITLIST_REALLOCLIST2, _SET_ERRORMES_MALLOC, sizeof(SET_CodeValue));
-                SET_DestroyCodeList(CodeList);
-                return NULL;
-            }
+    if (Field == NULL)
+    {
+        _SET_SetError(_SET_ERRORID_LAZYGET_MISSING, _SET_ERRORMES_MISSINGFIELD, Name);
+        return NULL;
+    }
 
-            SET_InitCodeValue(CodeList->list[CodeList->count + 1]);
+    // It has already been parsed
+    if (Field->value != NULL)
+        return Field->value;
 
-            NewList[CodeList->count]->type = SET_VALUETYPE_VALUE;
-            NewList[CodeList->count++]->value.value = LastStart;
+    // Copy the value since parsing changes the text, this way a failed value gives the same error every time
+    char *Text = (char *)malloc(sizeof(char) * (Field->length + 1));
 
-            *Current = '\0';
-            LastStart = Current + 1;
-            continue;
-        }
+    if (Text == NULL)
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_LAZYGET_MALLOC, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(char) * (Field->length + 1));
+        return NULL;
     }
 
-    // Make sure it is not inside of a string
-    if (InString)
+    memcpy(Text, Field->start, sizeof(char) * Field->length);
+    Text[Field->length] = '\0';
+
+    SET_Stream Stream;
+    SET_InitStream(&Stream);
+    Stream.pos = Text;
+    Stream.line = Field->line;
+    Stream.types = Settings->types;
+
+    SET_Data *Value = _SET_ParseValue(&Stream, Field->type, Field->depth);
+
+    if (Value == NULL)
     {
-        _SET_SetError(_SET_ERRORID_SPLITSTRING_ENDSTRING, _SET_ERRORMES_ENDSTRING, _SET_ELEMENTPREMES, CodeList->count + 1);
-        SET_DestroyCodeList(CodeList);
+        _SET_AddError(_SET_ERRORID_LAZYGET_VALUE, _SET_ERRORMES_READVALUE, _SET_LINEPREMES, (size_t)Field->line);
+        free(Text);
         return NULL;
     }
 
-    // Add the last element
-    CodeList->list[CodeList->count]->type = SET_VALUETYPE_VALUE;
-    CodeList->list[CodeList->count++]->value.value = LastStart;
+    // Make sure the entire value was used
+    _SET_SkipBlank(&Stream);
 
-    // Convert values into structs and lists
-    for (SET_CodeValue **List = CodeList->list, **EndList = CodeList->list + CodeList->count; List < EndList; ++List)
-        // Split the value
-        if (!_SET_SplitValue(*List))
-        {
-            _SET_AddError(_SET_ERRORID_SPLITLIST_SPLITVALUE, _SET_ERRORMES_SPLITVALUE, _SET_ELEMENTPREMES, CodeList->count + 1);
-            SET_DestroyCodeList(CodeList);
-            return NULL;
-        }
+    if (*Stream.pos != '\0')
+    {
+        _SET_SetError(_SET_ERRORID_LAZYGET_ENDVALUE, _SET_ERRORMES_ENDVALUE, ';', _SET_LINEPREMES, Stream.line, *Stream.pos);
+        SET_DestroyData(Value);
+        free(Text);
+        return NULL;
+    }
 
-    // Return the list
-    return CodeList;
+    free(Text);
+    Field->value = Value;
+
+    return Value;
 }
 
-SET_DataTypeBase _SET_GetPossibleType(const char *Value)
+SET_Parser *SET_CreateParser(void)
 {
-    // Make sure there is a string
-    if (*Value == '\0')
+    SET_Parser *Parser = (SET_Parser *)malloc(sizeof(SET_Parser));
+
+    if (Parser == NULL)
     {
-        _SET_SetError(_SET_ERRORID_GETPOSSIBLETYPE_NOVALUE, _SET_ERRORMES_NOSTRING);
-        return SET_DATATYPEBASE_NONE;
+        _SET_AddErrorForeign(_SET_ERRORID_CREATEPARSER_MALLOC, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(SET_Parser));
+        return NULL;
     }
 
-    const char *Current = Value;
-    SET_DataTypeBase Type = SET_DATATYPEBASE_NONE;
-    bool Hex = false;
-    bool Bin = false;
-    bool Dot = false;
-    bool Exp = false;
+    SET_InitParser(Parser);
 
-    // Check for a bool
-    if (strcmp(Value, _SET_TRUENAME) == 0 || strcmp(Value, _SET_FALSENAME) == 0)
-        return SET_DATATYPEBASE_BOOL;
+    // The dict also holds on to the hash table so it is not created again for every load
+    Parser->types = _SET_BuildTypeDict();
 
-    // Do the start
-    switch (*Current)
+    if (Parser->types == NULL)
     {
-        // Char
-        case ('\''):
-            Type = SET_DATATYPEBASE_CHAR;
-            break;
+        _SET_AddError(_SET_ERRORID_CREATEPARSER_TYPEDICT, _SET_ERRORMES_TYPEDICT);
+        SET_DestroyParser(Parser);
+        return NULL;
+    }
 
-        // String
-        case ('\"'):
-            Type = SET_DATATYPEBASE_STRING;
-            break;
+    return Parser;
+}
 
-        // Signed
-        case ('-'):
-            Type = SET_DATATYPEBASE_SINT | SET_DATATYPEBASE_FLOAT;
-            break;
+SET_DataStruct *SET_ParserLoad(SET_Parser *Parser, const char *FileName)
+{
+    // Find the state of the file before loading it so a change while loading makes the cache outdated
+    SET_CacheHeader Source;
+    bool HasSource = _SET_StatSource(&Source, FileName);
 
-        // Hex or Bin
-        case ('0'):
-            ++Current;
-            switch (*Current)
-            {
-                // Hex
-                case ('x'):
-                    Type = SET_DATATYPEBASE_UINT;
-                    Hex = true;
-                    break;
+    // Load file
+    if (!FIL_LoadBuffer(FileName, &Parser->buffer, &Parser->bufferSize))
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_PARSERLOAD_LOAD, FIL_GetError(), _SET_ERRORMES_LOADFILE, FileName);
+        return NULL;
+    }
 
-                // Bin
-                case ('b'):
-                    Type = SET_DATATYPEBASE_UINT;
-                    Bin = true;
-                    break;
-                
-                default:
-                    Type = SET_DATATYPEBASE_SINT | SET_DATATYPEBASE_UINT | SET_DATATYPEBASE_FLOAT;
-                    Current -= 2;
-                    break;
-            }
-            break;
-        
-        default:
-            Type = SET_DATATYPEBASE_SINT | SET_DATATYPEBASE_UINT | SET_DATATYPEBASE_FLOAT;
-            --Current;
-            break;
+    // Use the cache if it is up to date
+    if (HasSource)
+    {
+        SET_DataStruct *Cached = _SET_LoadCache(FileName, &Source, Parser->buffer, NULL, NULL, NULL);
+
+        if (Cached != NULL)
+            return Cached;
     }
 
-    // Add bool
-    if (strlen(Value) == 1 && (*Value == '0' || *Value == '1'))
-        Type |= SET_DATATYPEBASE_BOOL;
+    SET_DataStruct *Result = _SET_ParseText(Parser->buffer, Parser->types, NULL, false);
 
-    ++Current;
+    if (Result == NULL)
+    {
+        _SET_AddError(_SET_ERRORID_PARSERLOAD_PARSE, _SET_ERRORMES_PARSEFILE, FileName);
+        return NULL;
+    }
 
-    // Go through entire string
-    if (Type != SET_DATATYPEBASE_CHAR && Type != SET_DATATYPEBASE_STRING)
-        for (; *Current != '\0'; ++Current)
-        {
-            // Check binary
-            if (Bin)
-            {
-                if (*Current != '0' && *Current != '1')
-                {
-                    _SET_SetError(_SET_ERRORID_GETPOSSIBLETYPE_ILLIGALBIN, _SET_ERRORMES_ILLIGALBIN, Value, *Current);
-                    return SET_DATATYPEBASE_NONE;
-                }
-            }
+    return Result;
+}
 
-            else if (Hex)
-            {
-                if (!((*Current >= '0' && *Current <= '9') || (*Current >= 'a' && *Current <= 'f') || (*Current >= 'A' && *Current <= 'F')))
-                {
-                    _SET_SetError(_SET_ERRORID_GETPOSSIBLETYPE_ILLIGALHEX, _SET_ERRORMES_ILLIGALHEX, Value, *Current);
-                    return SET_DATATYPEBASE_NONE;
-                }
-            }
+SET_DataStruct *_SET_ParseText(char *String, DIC_Dict *Types, ARN_Arena *Arena, bool View)
+{
+    // Load type dict, it is kept local so texts can be parsed by several threads at once
+    DIC_Dict *OwnTypes = NULL;
 
-            else
-            {
-                if (*Current == '.' && Type & SET_DATATYPEBASE_FLOAT)
-                {
-                    if (!Dot)
-                    {
-                        Dot = true;
-                        Type = SET_DATATYPEBASE_FLOAT;
-                    }
-
-                    else if (Exp)
-                    {
-                        _SET_SetError(_SET_ERRORID_GETPOSSIBLETYPE_ILLIGALDOT2, _SET_ERRORMES_ILLIGALDOT2, Value);
-                        return SET_DATATYPEBASE_NONE;
-                    }
-
-                    else
-                    {
-                        _SET_SetError(_SET_ERRORID_GETPOSSIBLETYPE_ILLIGALDOT, _SET_ERRORMES_ILLIGALDOT, Value);
-                        return SET_DATATYPEBASE_NONE;
-                    }
-                }
-
-                else if ((*Current == 'e' || *Current == 'E') && Type & SET_DATATYPEBASE_FLOAT)
-                {
-                    if (!Exp)
-                    {
-                        Exp = true;
-                        Type = SET_DATATYPEBASE_FLOAT;
-
-                        if (*(Current + 1) == '-')
-                            ++Current;
-                    }
-
-                    else
-                    {
-                        _SET_SetError(_SET_ERRORID_GETPOSSIBLETYPE_ILLIGALEXP, _SET_ERRORMES_ILLIGALEXP, Value);
-                        return SET_DATATYPEBASE_NONE;
-                    }
-                }
-
-                else if (!(*Current >= '0' && *Current <= '9'))
-                {
-                    _SET_SetError(_SET_ERRORID_GETPOSSIBLETYPE_ILLIGALNUM, _SET_ERRORMES_ILLIGALNUM, Value, *Current);
-                    return SET_DATATYPEBASE_NONE;
-                }
-            }
-        }
-
-    // Do the end
-    else
+    if (Types == NULL)
     {
-        Current += strlen(Current) - 1;
+        OwnTypes = _SET_BuildTypeDict();
 
-        if (Type == SET_DATATYPEBASE_CHAR)
+        if (OwnTypes == NULL)
         {
-            // Make sure a char ends
-            if (*Current != '\'')
-            {
-                _SET_SetError(_SET_ERRORID_GETPOSSIBLETYPE_CHAREND, _SET_ERRORMES_NOENDCHAR, Value);
-                return SET_DATATYPEBASE_NONE;
-            }
-
-            // Make sure it is not too long or short
-            uint32_t CharLength = 3;
+            _SET_AddError(_SET_ERRORID_PARSETEXT_TYPEDICT, _SET_ERRORMES_TYPEDICT);
+            return NULL;
+        }
 
-            if (*(Value + 1) == '\\')
-                ++CharLength;
+        Types = OwnTypes;
+    }
 
-            if (strlen(Value) != CharLength)
-            {
-                _SET_SetError(_SET_ERRORID_GETPOSSIBLETYPE_CHARLENGTH, _SET_ERRORMES_NOSTOPCHAR, Value);
-                return SET_DATATYPEBASE_NONE;
-            }
-        }
+    // Parse the text directly into dictionaries, names and values are terminated inside String so nothing else is copied
+    SET_Stream Stream;
+    SET_InitStream(&Stream);
+    Stream.pos = String;
+    Stream.arena = Arena;
+    Stream.view = View;
+    Stream.types = Types;
 
-        // Make sure a tring ends
-        else if (Type == SET_DATATYPEBASE_STRING)
-        {
-            // Check if it really ends
-            uint32_t SpecialCount = 0;
+    DIC_Dict *Result = _SET_ParseStruct(&Stream, false);
 
-            for (const char *Current2 = Current - 1; *Current2 == '\\'; --Current2)
-                ++SpecialCount;
+    // Clean up
+    if (OwnTypes != NULL)
+        DIC_DestroyDict(OwnTypes);
 
-            // Check that it ends
-            if (SpecialCount % 2 == 1 || *Current != '\"')
-            {
-                _SET_SetError(_SET_ERRORID_GETPOSSIBLETYPE_STRINGEND, _SET_ERRORMES_NOENDSTRING, Value);
-                return SET_DATATYPEBASE_NONE;
-            }
-        }
-    } 
+    if (Result == NULL)
+    {
+        _SET_AddError(_SET_ERRORID_PARSETEXT_PARSE, _SET_ERRORMES_PARSETEXT);
+        return NULL;
+    }
 
-    return Type;
+    return Result;
 }
 
-SET_DataStruct *_SET_ConvertStruct(const SET_CodeStruct *Struct)
+SET_DataStruct *_SET_ParseTextParallel(char *String, uint32_t ThreadCount)
 {
-    // Create a dictionary
-    DIC_Dict *Dict = DIC_CreateDict(Struct->count);
-
-    if (Dict == NULL)
+    if (ThreadCount == 0)
     {
-        _SET_AddErrorForeign(_SET_ERRORID_CONVERTSTRUCT_CREATEDICT, DIC_GetError(), _SET_ERRORMES_CREATEDICT);
-        return NULL;
+        long ProcessorCount = sysconf(_SC_NPROCESSORS_ONLN);
+        ThreadCount = ((ProcessorCount > 0) ? ((uint32_t)ProcessorCount) : (1));
     }
-    
-    // Start filling it up
-    SET_CodeName **Names = Struct->names;
-    SET_CodeName **EndNames = Names + Struct->count;
-    SET_CodeValue **Values = Struct->values;
 
-    for (; Names < EndNames; ++Names, ++Values)
+    // Small texts are parsed faster by a single thread
+    size_t Length = strlen(String);
+    size_t ChunkSize = Length / ((size_t)ThreadCount * _SET_CHUNKSPERTHREAD);
+
+    if (ChunkSize < _SET_CHUNKSIZE)
+        ChunkSize = _SET_CHUNKSIZE;
+
+    if (ThreadCount == 1 || Length < 2 * ChunkSize)
     {
-        // Test if the item is already there
-        if (DIC_CheckItem(Dict, (*Names)->name))
+        SET_DataStruct *Result = _SET_ParseText(String, NULL, NULL, false);
+
+        if (Result == NULL)
         {
-            _SET_SetError(_SET_ERRORID_CONVERTSTRUCT_DUBLICATE, _SET_ERRORMES_DUBLICATE, _SET_LINEPREMES, Names - Struct->names + 1);
-            SET_DestroyDataStruct(Dict);
+            _SET_AddError(_SET_ERRORID_PARSETEXTPARALLEL_PARSE, _SET_ERRORMES_PARSETEXT);
             return NULL;
         }
-        
-        // Get the type
-        SET_DataType Type = SET_DATATYPE_NONE;
 
-        if ((*Names)->type != NULL)
-        {
-            Type = _SET_ReadType((*Names)->type);
+        return Result;
+    }
 
-            if (Type == SET_DATATYPE_NONE)
-            {
-                _SET_AddError(_SET_ERRORID_CONVERTSTRUCT_TYPE, _SET_ERRORMES_READTYPE, _SET_LINEPREMES, Names - Struct->names + 1);
-                SET_DestroyDataStruct(Dict);
-                return NULL;
-            }
-        }
-        
-        // Read the value
-        SET_Data *Value = _SET_ConvertValue(*Values, Type, (*Names)->pointer);
+    // The text is changed while parsing, a copy is kept to parse again with a single thread if anything fails so the error is the same
+    char *Copy = (char *)malloc(sizeof(char) * (Length + 1));
 
-        if (Value == NULL)
-        {
-            _SET_AddError(_SET_ERRORID_CONVERTSTRUCT_VALUE, _SET_ERRORMES_READVALUE, _SET_LINEPREMES, Names - Struct->names + 1);
-            SET_DestroyDataStruct(Dict);
-            return NULL;
-        }
-        
-        // Add to dict
-        if (!DIC_AddItem(Dict, (*Names)->name, (void *)Value, 0, DIC_MODE_POINTER))
-        {
-            _SET_AddErrorForeign(_SET_ERRORID_CONVERTSTRUCT_ADDITEM, _SET_ERRORMES_DICTADD, (*Names)->name);
-            SET_DestroyData(Value);
-            SET_DestroyDataStruct(Dict);
-            return NULL;
-        }
+    if (Copy == NULL)
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_PARSETEXTPARALLEL_MALLOC, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(char) * (Length + 1));
+        return NULL;
     }
-    
-    return Dict;
-}
 
-SET_DataList *_SET_ConvertList(const SET_CodeList *List, SET_DataType Type, uint8_t Depth)
-{
-    if (List->count == 0)
+    memcpy(Copy, String, sizeof(char) * (Length + 1));
+
+    pthread_t *Threads = (pthread_t *)malloc(sizeof(pthread_t) * (ThreadCount - 1));
+
+    if (Threads == NULL)
     {
-        _SET_SetError(_SET_ERRORID_CONVERTLIST_NOELEMENTS, _SET_ERRORMES_NOELEMENTS);
+        _SET_AddErrorForeign(_SET_ERRORID_PARSETEXTPARALLEL_MALLOCTHREADS, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(pthread_t) * (ThreadCount - 1));
+        free(Copy);
         return NULL;
     }
-    
-    // Allocate memory
-    SET_DataList *ListObject = (SET_DataList *)malloc(sizeof(SET_DataList));
 
-    if (ListObject == NULL)
+    // The threads only read the type dict, and holding the hash table lets them create and destroy dicts at the same time
+    DIC_Dict *Types = _SET_BuildTypeDict();
+
+    if (Types == NULL)
     {
-        _SET_AddErrorForeign(_SET_ERRORID_CONVERTLIST_MALLOC, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(SET_DataList));
+        _SET_AddError(_SET_ERRORID_PARSETEXTPARALLEL_TYPEDICT, _SET_ERRORMES_TYPEDICT);
+        free(Threads);
+        free(Copy);
         return NULL;
     }
-    
-    SET_InitDataList(ListObject);
-    
-    // Add in the list
-    ListObject->list = (SET_Data **)malloc(sizeof(SET_Data *) * List->count);
 
-    if (ListObject->list == NULL)
+    if (!DIC_AcquireHash())
     {
-        _SET_AddErrorForeign(_SET_ERRORID_CONVERTLIST_MALLOCLIST, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(SET_Data *) * List->count);
-        SET_DestroyDataList(ListObject);
+        _SET_AddErrorForeign(_SET_ERRORID_PARSETEXTPARALLEL_HASH, DIC_GetError(), _SET_ERRORMES_ACQUIREHASH);
+        DIC_DestroyDict(Types);
+        free(Threads);
+        free(Copy);
         return NULL;
     }
-    
-    for (SET_Data **Elements = ListObject->list, **EndElements = ListObject->list + List->count; Elements < EndElements; ++Elements)
-        *Elements = NULL;
 
-    ListObject->count = List->count;
-    
-    // Go through each element in the list and convert them
-    SET_Data **DataList = ListObject->list;
+    // Parse the chunks, this thread reads chunks too so it works even if no threads could be started
+    SET_ParseJob Job;
+    SET_InitParseJob(&Job);
+    SET_DataStruct *Result = NULL;
 
-    for (SET_CodeValue **ValueList = List->list, **EndValueList = List->list + List->count; ValueList < EndValueList; ++ValueList, ++DataList)
+    if (_SET_SplitText(String, ChunkSize, Types, &Job.chunks, &Job.count))
     {
-        // Convert value
-        *DataList = _SET_ConvertValue(*ValueList, Type, Depth);
+        uint32_t StartCount = 0;
 
-        if (*DataList == NULL)
+        for (pthread_t *List = Threads, *EndList = Threads + ((Job.count < ThreadCount) ? (Job.count) : (ThreadCount)) - 1; List < EndList; ++List, ++StartCount)
+            if (pthread_create(List, NULL, &_SET_ParseWorker, &Job) != 0)
+                break;
+
+        _SET_ParseWorker(&Job);
+
+        for (pthread_t *List = Threads, *EndList = Threads + StartCount; List < EndList; ++List)
+            pthread_join(*List, NULL);
+
+        // Put the fields together in the order of the text
+        size_t Count = 0;
+
+        for (SET_ParseChunk *List = Job.chunks, *EndList = Job.chunks + Job.count; List < EndList; ++List)
+            Count += List->count;
+
+        SET_StreamField *Fields = NULL;
+
+        if (!atomic_load(&Job.failed))
+            Fields = (SET_StreamField *)malloc(sizeof(SET_StreamField) * ((Count > 0) ? (Count) : (1)));
+
+        if (Fields != NULL)
         {
-            _SET_AddError(_SET_ERRORID_CONVERTLIST_VALUE, _SET_ERRORMES_READVALUE, _SET_ELEMENTPREMES, ValueList - List->list);
-            SET_DestroyDataList(ListObject);
-            return NULL;
+            SET_StreamField *FillFields = Fields;
+
+            for (SET_ParseChunk *List = Job.chunks, *EndList = Job.chunks + Job.count; List < EndList; ++List)
+            {
+                if (List->fields == NULL)
+                    continue;
+
+                memcpy(FillFields, List->fields, sizeof(SET_StreamField) * List->count);
+                FillFields += List->count;
+                free(List->fields);
+                List->fields = NULL;
+            }
+
+            // The top level is created by this thread so its keys are interned right away
+            SET_Stream Stream;
+            SET_InitStream(&Stream);
+            Result = _SET_CreateStruct(&Stream, Fields, Count);
+
+            if (Result != NULL)
+                DIC_ForEach(Result, Item)
+                    if (!_SET_InternValue((SET_Data *)Item.value))
+                    {
+                        SET_DestroyDataStruct(Result);
+                        Result = NULL;
+                        break;
+                    }
         }
+
+        // Destroy the fields which were not used
+        for (SET_ParseChunk *List = Job.chunks, *EndList = Job.chunks + Job.count; List < EndList; ++List)
+            if (List->fields != NULL)
+            {
+                _SET_DestroyStreamFields(&List->stream, List->fields, List->count);
+                free(List->fields);
+            }
+
+        free(Job.chunks);
     }
-    
-    // Find the common type
-    SET_DataType CommonType = (*ListObject->list)->type;
-    uint8_t CommonDepth = 0;
 
-    if (CommonType == SET_DATATYPE_LIST)
+    // Clean up
+    DIC_DestroyDict(Types);
+    DIC_ReleaseHash();
+    free(Threads);
+
+    // Parse the text again with a single thread to get the same result or error as SET_LoadSettings
+    if (Result == NULL)
     {
-        CommonType = (*ListObject->list)->data.list->type;
-        CommonDepth = (*ListObject->list)->data.list->depth;
+        Result = _SET_ParseText(Copy, NULL, NULL, false);
+
+        if (Result == NULL)
+            _SET_AddError(_SET_ERRORID_PARSETEXTPARALLEL_PARSE, _SET_ERRORMES_PARSETEXT);
     }
-    
-    for (SET_Data **ValueList = ListObject->list + 1, **EndValueList = ListObject->list + ListObject->count; ValueList < EndValueList; ++ValueList)
+
+    free(Copy);
+    return Result;
+}
+
+bool _SET_SplitText(char *String, size_t ChunkSize, DIC_Dict *Types, SET_ParseChunk **OutChunks, size_t *OutCount)
+{
+    SET_ParseChunk *Chunks = NULL;
+    size_t Count = 0;
+    size_t Capacity = 0;
+
+    SET_Stream Stream;
+    SET_InitStream(&Stream);
+    Stream.pos = String;
+
+    char *Start = String;
+    uint32_t StartLine = Stream.line;
+
+    while (true)
     {
-        // Check for lists
-        if (CommonDepth > 0)
+        // Find the end of the next field
+        _SET_SkipBlank(&Stream);
+        bool End = (*Stream.pos == '\0');
+
+        if (!End)
         {
-            if ((*ValueList)->type != SET_DATATYPE_LIST || (*ValueList)->data.list->depth != CommonDepth || (*ValueList)->data.list->type != CommonType)
+            uint32_t Line = Stream.line;
+
+            if (!_SET_SkipValue(&Stream))
             {
-                _SET_SetError(_SET_ERRORID_CONVERTLIST_LISTELEMENT, _SET_ERRORMES_LISTELEMENT, _SET_ELEMENTPREMES, ValueList - ListObject->list);
-                SET_DestroyDataList(ListObject);
-                return NULL;
+                _SET_AddError(_SET_ERRORID_SPLITTEXT_SKIP, _SET_ERRORMES_SKIPVALUE, _SET_LINEPREMES, (size_t)Line);
+                free(Chunks);
+                return false;
             }
-        }
 
-        else if ((*ValueList)->type == SET_DATATYPE_LIST)
-        {
-            _SET_SetError(_SET_ERRORID_CONVERTLIST_LISTELEMENT2, _SET_ERRORMES_LISTELEMENT, _SET_ELEMENTPREMES, ValueList - ListObject->list);
-            SET_DestroyDataList(ListObject);
-            return NULL;
+            ++Stream.pos;
         }
 
-        // Check for special types
-        else if ((*ValueList)->type >= SET_DATATYPE_CHAR && (*ValueList)->type <= SET_DATATYPE_STRUCT)
+        // A chunk is ended after the first field which is at least ChunkSize after the start of the chunk and followed by a blank
+        if (!End && ((size_t)(Stream.pos - Start) < ChunkSize || (*Stream.pos != ' ' && *Stream.pos != '\t' && *Stream.pos != '\r' && *Stream.pos != '\n')))
+            continue;
+
+        // Get memory for the chunk
+        if (Count == Capacity)
         {
-            if ((*ValueList)->type != CommonType)
+            size_t NewCapacity = ((Capacity == 0) ? (_SET_STREAMSIZE) : (Capacity * 2));
+            SET_ParseChunk *NewChunks = (SET_ParseChunk *)realloc(Chunks, sizeof(SET_ParseChunk) * NewCapacity);
+
+            if (NewChunks == NULL)
             {
-                _SET_SetError(_SET_ERRORID_CONVERTLIST_TYPEELEMENT, _SET_ERRORMES_TYPEELEMENT, _SET_ELEMENTPREMES, ValueList - ListObject->list);
-                SET_DestroyDataList(ListObject);
-                return NULL;
+                _SET_AddErrorForeign(_SET_ERRORID_SPLITTEXT_REALLOC, strerror(errno), _SET_ERRORMES_REALLOC, sizeof(SET_ParseChunk) * NewCapacity);
+                free(Chunks);
+                return false;
             }
+
+            Chunks = NewChunks;
+            Capacity = NewCapacity;
         }
 
-        // Check for numbers
-        else if ((*ValueList)->type >= SET_DATATYPE_BOOL && (*ValueList)->type <= SET_DATATYPE_FLOAT)
-        {
-            // Make sure it is supposed to be a number
-            if (!(CommonType >= SET_DATATYPE_BOOL && CommonType <= SET_DATATYPE_DOUBLE))
-            {
-                _SET_SetError(_SET_ERRORID_CONVERTLIST_NUMBERELEMENT, _SET_ERRORMES_NUMBERELEMENT, _SET_ELEMENTPREMES, ValueList - ListObject->list);
-                SET_DestroyDataList(ListObject);
-                return NULL;
-            }
-            
-            // Find out what number it must be
-            // Floats
-            if (CommonType == SET_DATATYPE_DOUBLE || (*ValueList)->type == SET_DATATYPE_DOUBLE)
-                CommonType = SET_DATATYPE_DOUBLE;
+        SET_ParseChunk *Chunk = Chunks + Count++;
+        SET_InitParseChunk(Chunk);
+        Chunk->stream.pos = Start;
+        Chunk->stream.line = StartLine;
+        Chunk->stream.parallel = true;
+        Chunk->stream.types = Types;
 
-            else if (CommonType == SET_DATATYPE_FLOAT || (*ValueList)->type == SET_DATATYPE_FLOAT)
-                CommonType = SET_DATATYPE_FLOAT;
+        if (End)
+            break;
 
-            // Signed ints
-            else if (CommonType >= SET_DATATYPE_SINT8 || (*ValueList)->type >= SET_DATATYPE_SINT8)
-            {
-                // Get what type of signed int it should be
-                uint8_t CommonSize;
-                uint8_t ValueSize;
+        // End the chunk and start the next one after the blank
+        if (*Stream.pos == '\n')
+            ++Stream.line;
 
-                if (CommonType >= SET_DATATYPE_SINT8)
-                    CommonSize = CommonType - SET_DATATYPE_SINT8;
+        *Stream.pos++ = '\0';
+        Start = Stream.pos;
+        StartLine = Stream.line;
+    }
 
-                else
-                    CommonSize = (CommonType - SET_DATATYPE_INT8 + 1) / 2;
+    *OutChunks = Chunks;
+    *OutCount = Count;
+    return true;
+}
 
-                if ((*ValueList)->type >= SET_DATATYPE_SINT8)
-                    ValueSize = (*ValueList)->type - SET_DATATYPE_SINT8;
+void *_SET_ParseWorker(void *Job)
+{
+    SET_ParseJob *ParseJob = (SET_ParseJob *)Job;
 
-                else
-                    ValueSize = ((*ValueList)->type - SET_DATATYPE_INT8 + 1) / 2;
+    while (!atomic_load(&ParseJob->failed))
+    {
+        size_t Pos = atomic_fetch_add(&ParseJob->next, 1);
 
-                if (ValueSize > CommonSize)
-                    CommonSize = ValueSize;
-                    
-                CommonType = SET_DATATYPE_SINT8 + CommonSize;
-            }
+        if (Pos >= ParseJob->count)
+            break;
 
-            // Not a signed int
-            else if ((*ValueList)->type > CommonType)
-                CommonType = (*ValueList)->type;
-        }
+        // The error is not kept since the text is parsed again by a single thread to find it
+        SET_ParseChunk *Chunk = ParseJob->chunks + Pos;
 
-        else
-        {
-            _SET_SetError(_SET_ERRORID_CONVERTLIST_TYPE, _SET_ERRORMES_WRONGTYPE, (*ValueList)->type);
-            SET_DestroyDataList(ListObject);
-            return NULL;
-        }
-        
+        if (!_SET_ParseFields(&Chunk->stream, false, &Chunk->fields, &Chunk->count))
+            atomic_store(&ParseJob->failed, true);
     }
-    
-    // Convert elements to the same type
-    if (CommonDepth == 0 && CommonType >= SET_DATATYPE_INT8 && CommonType <= SET_DATATYPE_FLOAT)
-        for (SET_Data **ValueList = ListObject->list, **EndValueList = ListObject->list + ListObject->count; ValueList < EndValueList; ++ValueList)
-            if ((*ValueList)->type != CommonType)
-                **ValueList = _SET_ConvertType(*ValueList, CommonType);
-                
-    // Finish up
-    ListObject->type = CommonType;
-    ListObject->depth = CommonDepth + 1;
 
-    return ListObject;
+    return NULL;
 }
 
-SET_Data *_SET_ConvertValue(const SET_CodeValue *Value, SET_DataType Type, uint8_t Depth)
+bool _SET_InternValue(SET_Data *Data)
 {
-    // Check that there is a value
-    if (Value->value.value == NULL)
+    if (Data->type == SET_DATATYPE_STRUCT)
     {
-        _SET_SetError(_SET_ERRORID_CONVERTVALUE_NOVALUE, _SET_ERRORMES_NOVALUE2);
-        return NULL;
+        if (!DIC_InternKeys(Data->data.stct))
+        {
+            _SET_AddErrorForeign(_SET_ERRORID_INTERNVALUE_INTERN, DIC_GetError(), _SET_ERRORMES_INTERN);
+            return false;
+        }
+
+        DIC_ForEach(Data->data.stct, Item)
+            if (!_SET_InternValue((SET_Data *)Item.value))
+            {
+                _SET_AddError(_SET_ERRORID_INTERNVALUE_FIELD, _SET_ERRORMES_INTERNVALUE, Item.key);
+                return false;
+            }
     }
-    
-    // Allocate memory
-    SET_Data *Data = (SET_Data *)malloc(sizeof(SET_Data));
 
-    if (Data == NULL)
+    // Packed lists do not have structs
+    else if (Data->type == SET_DATATYPE_LIST && Data->data.list->packed == NULL && (Data->data.list->type == SET_DATATYPE_STRUCT || Data->data.list->depth > 1))
+        for (SET_Data **List = Data->data.list->list, **EndList = Data->data.list->list + Data->data.list->count; List < EndList; ++List)
+            if (!_SET_InternValue(*List))
+            {
+                _SET_AddError(_SET_ERRORID_INTERNVALUE_ELEMENT, _SET_ERRORMES_INTERNELEMENT, _SET_ELEMENTPREMES, List - Data->data.list->list);
+                return false;
+            }
+
+    return true;
+}
+
+DIC_Dict *_SET_BuildTypeDict(void)
+{
+    extern char *_SET_TypeNames[];
+    extern SET_DataType _SET_Types[];
+
+    DIC_Dict *Types = DIC_CreateDict(_SET_TYPECOUNT);
+
+    if (Types == NULL)
     {
-        _SET_AddErrorForeign(_SET_ERRORID_CONVERTVALUE_MALLOC, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(SET_Data));
+        _SET_AddErrorForeign(_SET_ERRORID_BUILDTYPEDICT_CREATEDICT, DIC_GetError(), _SET_ERRORMES_CREATEDICT);
         return NULL;
     }
-    
-    SET_InitData(Data);
-    SET_DataTypeBase PossibleType;
 
-    // Make sure it is a list if needed
-    if (Type != SET_DATATYPE_NONE && Depth > 0 && Value->type != SET_VALUETYPE_LIST)
+    size_t ElementSize = sizeof(SET_DataType);
+
+    if (!DIC_AddList(Types, (const char **)_SET_TypeNames, _SET_TYPECOUNT, (void *)_SET_Types, &ElementSize, DIC_MODE_LIST))
     {
-        _SET_AddError(_SET_ERRORID_CONVERTVALUE_LISTMATCH2, _SET_ERRORMES_LISTMATCH2, Value->type);
-        SET_DestroyData(Data);
+        _SET_AddErrorForeign(_SET_ERRORID_BUILDTYPEDICT_LOADDICT, DIC_GetError(), _SET_ERRORMES_DICTLIST);
+        DIC_DestroyDict(Types);
         return NULL;
     }
-    
-    // Find the type of value
-    switch (Value->type)
+
+    return Types;
+}
+
+bool SET_LoadInto(const char *FileName, void *Struct, const SET_TranslationTable *Table, size_t Count, SET_TranslationMode Mode)
+{
+    // Load file
+    char *String = FIL_Load(FileName);
+
+    if (String == NULL)
     {
-        case (SET_VALUETYPE_LIST):
-            // Make sure it is supposed to be a list
-            if (Type != SET_DATATYPE_NONE && Depth == 0)
-            {
-                _SET_AddError(_SET_ERRORID_CONVERTVALUE_LISTMATCH, _SET_ERRORMES_LISTMATCH, Type);
-                SET_DestroyData(Data);
-                return NULL;
-            }
+        _SET_AddErrorForeign(_SET_ERRORID_LOADINTO_LOAD, FIL_GetError(), _SET_ERRORMES_LOADFILE, FileName);
+        return false;
+    }
 
-            // Get the data
-            Data->data.list = _SET_ConvertList(Value->value.list, Type, Depth - 1);
+    // Load type dict, it is kept local so files can be loaded by several threads at once
+    DIC_Dict *Types = _SET_BuildTypeDict();
 
-            if (Data->data.list == NULL)
+    if (Types == NULL)
+    {
+        _SET_AddError(_SET_ERRORID_LOADINTO_TYPEDICT, _SET_ERRORMES_TYPEDICT);
+        free(String);
+        return false;
+    }
+
+    // Parse the text directly into the struct, everything which has been allocated is freed again if it fails
+    SET_Loader Loader;
+    SET_InitLoader(&Loader);
+    Loader.stream.pos = String;
+    Loader.stream.types = Types;
+
+    bool Loaded = _SET_LoadStruct(&Loader, Struct, Table, Count, Mode, false, false);
+
+    // Clean up
+    DIC_DestroyDict(Types);
+    free(String);
+
+    if (!Loaded)
+    {
+        _SET_AddError(_SET_ERRORID_LOADINTO_STRUCT, _SET_ERRORMES_PARSEFILE, FileName);
+        _SET_ReverseLoad(&Loader);
+    }
+
+    free(Loader.allocs);
+    return Loaded;
+}
+
+bool _SET_LoadStruct(SET_Loader *Loader, void *Struct, const SET_TranslationTable *Table, size_t Count, SET_TranslationMode Mode, bool Sub, bool InList)
+{
+    SET_Stream *Stream = &Loader->stream;
+
+    // Remember which fields have been loaded to find dublicates and to check FILL mode
+    bool *Found = NULL;
+
+    if (Count > 0)
+    {
+        Found = (bool *)calloc(Count, sizeof(bool));
+
+        if (Found == NULL)
+        {
+            _SET_AddErrorForeign(_SET_ERRORID_LOADSTRUCT_MALLOC, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(bool) * Count);
+            return false;
+        }
+    }
+
+    // The fields are usually written in the same order as the table, so the search starts after the last field found
+    size_t Next = 0;
+
+    // The names of fields which are not in the table are remembered to find dublicates of them too, the dict is only created when the first one is found
+    DIC_Dict *Skipped = NULL;
+
+    while (true)
+    {
+        _SET_SkipBlank(Stream);
+
+        // Check for the end
+        if (*Stream->pos == '\0')
+        {
+            if (Sub)
             {
-                _SET_AddError(_SET_ERRORID_CONVERTVALUE_LIST, _SET_ERRORMES_CONVERTLIST);
-                SET_DestroyData(Data);
-                return NULL;
+                _SET_SetError(_SET_ERRORID_LOADSTRUCT_ENDSTRUCT, _SET_ERRORMES_ENDSTRUCT);
+                free(Found);
+
+                if (Skipped != NULL)
+                    DIC_DestroyDict(Skipped);
+
+                return false;
             }
 
-            // Set the type
-            Data->type = SET_DATATYPE_LIST;
             break;
+        }
 
-        case (SET_VALUETYPE_STRUCT):
-            // Get the data
-            Data->data.stct = _SET_ConvertStruct(Value->value.sub);
-
-            if (Data->data.stct == NULL)
+        if (*Stream->pos == '}')
+        {
+            if (!Sub)
             {
-                _SET_AddError(_SET_ERRORID_CONVERTVALUE_STRUCT, _SET_ERRORMES_CONVERTSTRUCT);
-                SET_DestroyData(Data);
-                return NULL;
+                _SET_SetError(_SET_ERRORID_LOADSTRUCT_UNEXPECTED, _SET_ERRORMES_UNEXPECTED, _SET_LINEPREMES, Stream->line, *Stream->pos);
+                free(Found);
+
+                if (Skipped != NULL)
+                    DIC_DestroyDict(Skipped);
+
+                return false;
             }
 
-            // Set the type
-            Data->type = SET_DATATYPE_STRUCT;
+            ++Stream->pos;
             break;
+        }
 
-        case (SET_VALUETYPE_VALUE):
-            // Figure out what type it is
-            PossibleType = _SET_GetPossibleType(Value->value.value);
+        uint32_t Line = Stream->line;
 
-            // Convert
-            if (PossibleType & SET_DATATYPEBASE_CHAR)
-                *Data = _SET_ConvertChar(Value->value.value);
+        // Read the type and name
+        char *Name;
+        SET_DataType Type;
+        uint8_t PointerCount;
 
-            else if (PossibleType & SET_DATATYPEBASE_STRING)
-                *Data = _SET_ConvertString(Value->value.value);
+        if (!_SET_ParseName(Stream, &Name, &Type, &PointerCount))
+        {
+            _SET_AddError(_SET_ERRORID_LOADSTRUCT_NAME, _SET_ERRORMES_PARSENAME, _SET_LINEPREMES, (size_t)Line);
+            free(Found);
 
-            else if (PossibleType & SET_DATATYPEBASE_BOOL)
-                *Data = _SET_ConvertBool(Value->value.value);
+            if (Skipped != NULL)
+                DIC_DestroyDict(Skipped);
 
-            else if (PossibleType & SET_DATATYPEBASE_UINT)
-                *Data = _SET_ConvertUint(Value->value.value);
+            return false;
+        }
 
-            else if (PossibleType & SET_DATATYPEBASE_SINT)
-                *Data = _SET_ConvertSint(Value->value.value);
+        // Find the entry of the table
+        const SET_TranslationTable *Entry = NULL;
 
-            else if (PossibleType & SET_DATATYPEBASE_FLOAT)
-                *Data = _SET_ConvertFloat(Value->value.value);
+        for (size_t Pos = 0; Pos < Count && Entry == NULL; ++Pos)
+            if (strcmp(Table[(Next + Pos) % Count].name, Name) == 0)
+                Entry = Table + (Next + Pos) % Count;
 
-            else
+        // Fields which are not in the table are read and thrown away
+        if (Entry == NULL)
+        {
+            if (Mode & SET_TRANSLATIONMODE_EMPTY)
             {
-                _SET_AddError(_SET_ERRORID_CONVERTVALUE_NOPOSSIBLEVALUE, _SET_ERRORMES_NOPOSSIBLEVALUE);
-                SET_DestroyData(Data);
-                return NULL;
+                _SET_SetError(_SET_ERRORID_LOADSTRUCT_EMPTY, _SET_ERRORMES_LOADEMPTY, Name);
+                free(Found);
+
+                if (Skipped != NULL)
+                    DIC_DestroyDict(Skipped);
+
+                return false;
             }
 
-            if (Data->type == SET_DATATYPE_NONE)
+            if (Skipped == NULL)
             {
-                _SET_AddError(_SET_ERRORID_CONVERTVALUE_CONVERT, _SET_ERRORMES_CONVERTVALUE);
-                SET_DestroyData(Data);
-                return NULL;
+                Skipped = DIC_CreateDict(((Count > 0) ? (Count) : (1)));
+
+                if (Skipped == NULL)
+                {
+                    _SET_AddErrorForeign(_SET_ERRORID_LOADSTRUCT_CREATEDICT, DIC_GetError(), _SET_ERRORMES_CREATEDICT);
+                    free(Found);
+                    return false;
+                }
+
+                // The names are terminated in place in the text which is kept until the loading is done
+                DIC_BorrowKeys(Skipped);
             }
 
-            break;
+            if (DIC_CheckItem(Skipped, Name))
+            {
+                _SET_SetError(_SET_ERRORID_LOADSTRUCT_DUBLICATE2, _SET_ERRORMES_DUBLICATE, _SET_LINEPREMES, (size_t)Line);
+                free(Found);
+                DIC_DestroyDict(Skipped);
+                return false;
+            }
 
-        default:
-            break;
-    }
+            if (!DIC_AddItem(Skipped, Name, (void *)Name, 0, DIC_MODE_POINTER))
+            {
+                _SET_AddErrorForeign(_SET_ERRORID_LOADSTRUCT_ADDITEM, DIC_GetError(), _SET_ERRORMES_DICTADD, Name);
+                free(Found);
+                DIC_DestroyDict(Skipped);
+                return false;
+            }
 
-    // Make sure the type is correct
-    if (Type != SET_DATATYPE_NONE && Data->type != SET_DATATYPE_LIST)
-    {
-        // Check for special types
-        if (Type >= SET_DATATYPE_CHAR && Type <= SET_DATATYPE_STRUCT)
-        {
-            if (Data->type != Type)
+            SET_Data *Data = _SET_ParseValue(Stream, Type, PointerCount);
+
+            if (Data == NULL)
             {
-                _SET_SetError(_SET_ERRORID_CONVERTVALUE_TYPEMATCH, _SET_ERRORMES_TYPEMATCH, Type, Data->type);
-                SET_DestroyData(Data);
-                return NULL;
+                _SET_AddError(_SET_ERRORID_LOADSTRUCT_SKIP, _SET_ERRORMES_READVALUE, _SET_LINEPREMES, (size_t)Line);
+                free(Found);
+
+                if (Skipped != NULL)
+                    DIC_DestroyDict(Skipped);
+
+                return false;
             }
+
+            SET_DestroyData(Data);
         }
 
-        // Check for numbers
-        else if (Type >= SET_DATATYPE_INT && Type <= SET_DATATYPE_FLOAT)
+        else
         {
-            // Convert it
-            SET_Data NewData = _SET_ConvertType(Data, Type);
+            Next = Entry - Table + 1;
 
-            if (NewData.type == SET_DATATYPE_NONE)
+            if (Found[Entry - Table])
             {
-                _SET_AddError(_SET_ERRORID_CONVERTVALUE_NUMBERMATCH, _SET_ERRORMES_NUMBERCONVERT);
-                SET_DestroyData(Data);
-                return NULL;
+                _SET_SetError(_SET_ERRORID_LOADSTRUCT_DUBLICATE, _SET_ERRORMES_DUBLICATE, _SET_LINEPREMES, (size_t)Line);
+                free(Found);
+
+                if (Skipped != NULL)
+                    DIC_DestroyDict(Skipped);
+
+                return false;
+            }
+
+            Found[Entry - Table] = true;
+
+            // A declared type must have the same list depth as the table
+            if (Type != SET_DATATYPE_NONE && PointerCount != Entry->depth)
+            {
+                _SET_SetError(_SET_ERRORID_LOADSTRUCT_DEPTH, _SET_ERRORMES_LISTMATCH3, Entry->depth, PointerCount);
+                free(Found);
+
+                if (Skipped != NULL)
+                    DIC_DestroyDict(Skipped);
+
+                return false;
             }
 
-            if (Data->type != NewData.type)
-                *Data = NewData;
+            SET_DataType LoadedType;
+
+            if (!_SET_LoadValue(Loader, Struct + Entry->offset, Entry, Type, Entry->depth, Mode, InList, &LoadedType))
+            {
+                _SET_AddError(_SET_ERRORID_LOADSTRUCT_VALUE, _SET_ERRORMES_READVALUE, _SET_LINEPREMES, (size_t)Line);
+                free(Found);
+
+                if (Skipped != NULL)
+                    DIC_DestroyDict(Skipped);
+
+                return false;
+            }
         }
 
-        else
+        // Find the end of the line
+        _SET_SkipBlank(Stream);
+
+        if (*Stream->pos != ';')
         {
-            _SET_SetError(_SET_ERRORID_CONVERTVALUE_TYPE, _SET_ERRORMES_WRONGTYPE, Type);
-            SET_DestroyData(Data);
-            return NULL;
+            if (*Stream->pos == '\0')
+                _SET_SetError(_SET_ERRORID_LOADSTRUCT_END, _SET_ERRORMES_WRONGEND);
+
+            else
+                _SET_SetError(_SET_ERRORID_LOADSTRUCT_ENDVALUE, _SET_ERRORMES_ENDVALUE, ';', _SET_LINEPREMES, Stream->line, *Stream->pos);
+
+            free(Found);
+
+            if (Skipped != NULL)
+                DIC_DestroyDict(Skipped);
+
+            return false;
         }
+
+        ++Stream->pos;
     }
-    
-    return Data;
-}
 
-SET_DataType _SET_ReadType(const char *Type)
-{
-    // Make sure the dict exists
-    extern DIC_Dict *_SET_TypeDict;
+    // Check that FILL mode is fulfilled
+    if (Mode & SET_TRANSLATIONMODE_FILL)
+        for (bool *List = Found, *EndList = Found + Count; List < EndList; ++List)
+            if (!*List)
+            {
+                _SET_SetError(_SET_ERRORID_LOADSTRUCT_FILL, _SET_ERRORMES_LOADFILL, Table[List - Found].name);
+                free(Found);
 
-    if (_SET_TypeDict == NULL)
-    {
-        _SET_SetError(_SET_ERRORID_READTYPE_DICT, _SET_ERRORMES_DICTEXIST);
-        return SET_DATATYPE_NONE;
-    }
+                if (Skipped != NULL)
+                    DIC_DestroyDict(Skipped);
 
-    // Check that it exists
-    if (!DIC_CheckItem(_SET_TypeDict, Type))
-    {
-        _SET_SetError(_SET_ERRORID_READTYPE_WRONGTYPE, _SET_ERRORMES_UNKNOWNTYPE, Type);
-        return SET_DATATYPE_NONE;
-    }
+                return false;
+            }
 
-    // Get the item
-    SET_DataType *DataType = (SET_DataType *)DIC_GetItem(_SET_TypeDict, Type);
+    free(Found);
 
-    if (DataType == NULL)
-    {
-        _SET_AddErrorForeign(_SET_ERRORID_READTYPE_RETRIEVE, DIC_GetError(), _SET_ERRORMES_DICTITEM, Type);
-        return SET_DATATYPE_NONE;
-    }
+    if (Skipped != NULL)
+        DIC_DestroyDict(Skipped);
 
-    return *DataType;
+    return true;
 }
 
-SET_Data _SET_ConvertType(SET_Data *Data, SET_DataType Type)
+bool _SET_LoadValue(SET_Loader *Loader, void *Value, const SET_TranslationTable *Table, SET_DataType Type, uint8_t Depth, SET_TranslationMode Mode, bool InList, SET_DataType *LoadedType)
 {
-    // Setup output
-    SET_Data NewData;
-    SET_InitData(&NewData);
+    SET_Stream *Stream = &Loader->stream;
 
-    // Make sure it is legal
-    if (Type == SET_DATATYPE_LIST || Type == SET_DATATYPE_STRUCT)
-    {
-        _SET_SetError(_SET_ERRORID_CONVERTTYPE_NOSTRUCT, _SET_ERRORMES_NOSTRUCT);
-        return NewData;
-    }
+    _SET_SkipBlank(Stream);
 
-    // Do the standalones
-    else if (Type == SET_DATATYPE_CHAR || Type == SET_DATATYPE_STR)
+    // Lists, all elements must be filled in
+    if (Depth > 0)
     {
-        if (Type != Data->type)
+        if (*Stream->pos != '[')
         {
-            _SET_SetError(_SET_ERRORID_CONVERTTYPE_TYPEMATCH, _SET_ERRORMES_TYPEMATCH, Type, Data->type);
-            return NewData;
+            _SET_SetError(_SET_ERRORID_LOADVALUE_LISTMATCH, _SET_ERRORMES_EXPECTLIST, _SET_LINEPREMES, Stream->line, *Stream->pos);
+            return false;
         }
-    }
 
-    // Make sure the number match up
-    else if (Type >= SET_DATATYPE_INT && Type <= SET_DATATYPE_FLOAT)
-    {
-        if (!(Data->type >= SET_DATATYPE_BOOL && Data->type <= SET_DATATYPE_FLOAT))
+        ++Stream->pos;
+
+        if (!_SET_LoadList(Loader, (void **)Value, Table, Type, Depth, Mode | SET_TRANSLATIONMODE_FILL, InList, LoadedType))
         {
-            _SET_SetError(_SET_ERRORID_CONVERTTYPE_NUMBERMATCH, _SET_ERRORMES_NUMBERMATCH, Data->type);
-            return NewData;
+            _SET_AddError(_SET_ERRORID_LOADVALUE_LIST, _SET_ERRORMES_CONVERTLIST);
+            return false;
         }
 
-        else if (Type >= SET_DATATYPE_DOUBLE)
-            ;
+        return true;
+    }
 
-        else if (Data->type >= SET_DATATYPE_DOUBLE)
+    if (*Stream->pos == '[')
+    {
+        _SET_SetError(_SET_ERRORID_LOADVALUE_LISTMATCH2, _SET_ERRORMES_LISTMATCH, Table->type);
+        return false;
+    }
+
+    // Another struct
+    if (Table->type == SET_DATATYPE_STRUCT)
+    {
+        // Make sure type is correct
+        if ((Type != SET_DATATYPE_NONE && Type != SET_DATATYPE_STRUCT) || *Stream->pos != '{')
         {
-            _SET_SetError(_SET_ERRORID_CONVERTTYPE_FLOATMATCH, _SET_ERRORMES_FLOATMATCH);
-            return NewData;
+            _SET_SetError(_SET_ERRORID_LOADVALUE_STRUCTMATCH, _SET_ERRORMES_EXPECTSTRUCT, _SET_LINEPREMES, Stream->line, *Stream->pos);
+            return false;
         }
 
-        else if (Type == SET_DATATYPE_INT)
-            return *Data;
+        // Make sure there is a sub
+        if (Table->sub == NULL)
+        {
+            _SET_SetError(_SET_ERRORID_LOADVALUE_NOSTRUCT, _SET_ERRORMES_MISSINGSUB);
+            return false;
+        }
 
-        else if (Type >= SET_DATATYPE_SINT8)
+        ++Stream->pos;
+
+        if (!_SET_LoadStruct(Loader, Value, Table->sub, Table->count, Mode, true, InList))
         {
-            uint8_t Size;
+            _SET_AddError(_SET_ERRORID_LOADVALUE_STRUCT, _SET_ERRORMES_CONVERTSTRUCT);
+            return false;
+        }
 
-            if (Data->type >= SET_DATATYPE_SINT8)
-                Size = Data->type - SET_DATATYPE_SINT8;
+        *LoadedType = SET_DATATYPE_STRUCT;
+        return true;
+    }
 
-            else
-                Size = (Data->type - SET_DATATYPE_INT8 + 1) / 2;
+    // Single values
+    size_t Size = _SET_TypeSize(Table->type);
 
-            if (Size > Type - SET_DATATYPE_SINT8)
-            {
-                _SET_SetError(_SET_ERRORID_CONVERTTYPE_SINTMATCH, _SET_ERRORMES_SINTMATCH, Type, Data->type);
-                return NewData;
-            }
-        }
+    if (Size == 0)
+    {
+        _SET_SetError(_SET_ERRORID_LOADVALUE_UNKNOWNTYPE, _SET_ERRORMES_WRONGTYPE, Table->type);
+        return false;
+    }
 
-        else if (Data->type >= SET_DATATYPE_SINT8)
+    SET_Data Data;
+    SET_InitData(&Data);
+
+    if (!_SET_ParseScalar(Stream, &Data))
+    {
+        _SET_AddError(_SET_ERRORID_LOADVALUE_SCALAR, _SET_ERRORMES_CONVERTVALUE);
+        return false;
+    }
+
+    // Make sure it matches the declared type
+    if (Type != SET_DATATYPE_NONE && !_SET_MatchType(&Data, Type))
+    {
+        _SET_AddError(_SET_ERRORID_LOADVALUE_TYPEMATCH, _SET_ERRORMES_MATCHTYPE, Type);
+
+        if (Data.type == SET_DATATYPE_STR)
+            free(Data.data.str);
+
+        return false;
+    }
+
+    *LoadedType = Data.type;
+
+    // Strings are moved into the struct
+    if (Table->type == SET_DATATYPE_STR)
+    {
+        if (Data.type != SET_DATATYPE_STR)
         {
-            _SET_SetError(_SET_ERRORID_CONVERTTYPE_SINTMATCH2, _SET_ERRORMES_SINTMATCH2, Type, Data->type);
-            return NewData;
+            _SET_SetError(_SET_ERRORID_LOADVALUE_STRINGMATCH, _SET_ERRORMES_STRINGMATCH, Data.type);
+            return false;
         }
 
-        else if (Data->type > Type)
+        if (!_SET_AddLoadAlloc(Loader, Data.data.str, ((InList) ? (NULL) : ((void **)Value))))
         {
-            _SET_SetError(_SET_ERRORID_CONVERTTYPE_INTMATCH, _SET_ERRORMES_INTMATCH, Type, Data->type);
-            return NewData;
+            _SET_AddError(_SET_ERRORID_LOADVALUE_ALLOC, _SET_ERRORMES_LOADALLOC);
+            free(Data.data.str);
+            return false;
         }
+
+        *(char **)Value = Data.data.str;
+        return true;
+    }
+
+    // Numbers and chars
+    SET_Data ConvertData = _SET_ConvertType(&Data, Table->type);
+
+    if (Data.type == SET_DATATYPE_STR)
+        free(Data.data.str);
+
+    if (ConvertData.type == SET_DATATYPE_NONE)
+    {
+        _SET_AddError(_SET_ERRORID_LOADVALUE_CONVERT, _SET_ERRORMES_CONVERTVALUE);
+        return false;
     }
 
+    memcpy(Value, &ConvertData.data, Size);
+    return true;
+}
+
+bool _SET_LoadList(SET_Loader *Loader, void **List, const SET_TranslationTable *Table, SET_DataType Type, uint8_t Depth, SET_TranslationMode Mode, bool InList, SET_DataType *LoadedType)
+{
+    SET_Stream *Stream = &Loader->stream;
+
+    // Get size of one element
+    size_t Size;
+
+    if (Depth > 1)
+        Size = sizeof(void *);
+
+    else if (Table->type == SET_DATATYPE_STRUCT)
+        Size = Table->size;
+
     else
+        Size = _SET_TypeSize(Table->type);
+
+    if (Size == 0)
     {
-        _SET_SetError(_SET_ERRORID_CONVERTTYPE_TYPEMATCH2, _SET_ERRORMES_TYPEMATCH, Type, Data->type);
-        return NewData;
+        _SET_SetError(_SET_ERRORID_LOADLIST_UNKNOWNTYPE, _SET_ERRORMES_WRONGTYPE, Table->type);
+        return false;
     }
 
-    NewData.type = Type;
+    _SET_SkipBlank(Stream);
 
-    // Convert the type to a general type
-    uint64_t Uint;
-    bool UseUint = false;
-    int64_t Sint;
-    bool UseSint = false;
-    double Float;
-    bool UseFloat = false;
+    if (*Stream->pos == ']')
+    {
+        _SET_SetError(_SET_ERRORID_LOADLIST_NOELEMENTS, _SET_ERRORMES_NOELEMENTS);
+        return false;
+    }
 
-    switch (Data->type)
+    // Read the elements, the list moves when it grows so the elements cannot be freed through their location
+    uint8_t *Elements = NULL;
+    size_t Count = 0;
+    size_t Capacity = 0;
+    SET_DataType CommonType = SET_DATATYPE_NONE;
+
+    while (true)
     {
-        // If a char or string, just return
-        case (SET_DATATYPE_CHAR):
-        case (SET_DATATYPE_STR):
-            return *Data;
+        // Get memory for the element
+        if (Count == Capacity)
+        {
+            size_t NewCapacity = ((Capacity == 0) ? (_SET_STREAMSIZE) : (Capacity * 2));
+            uint8_t *NewElements = (uint8_t *)realloc(Elements, Size * NewCapacity);
 
-        // If it is an bool
-        case (SET_DATATYPE_BOOL):
-            Uint = (uint64_t)Data->data.b;
-            UseUint = true;
-            break;
+            if (NewElements == NULL)
+            {
+                _SET_AddErrorForeign(_SET_ERRORID_LOADLIST_REALLOC, strerror(errno), _SET_ERRORMES_REALLOC, Size * NewCapacity);
+                free(Elements);
+                return false;
+            }
 
-        // If an unsigned int
-        case (SET_DATATYPE_INT8):
-        case (SET_DATATYPE_UINT8):
-            Uint = (uint64_t)Data->data.u8;
-            UseUint = true;
-            break;
+            Elements = NewElements;
+            Capacity = NewCapacity;
+        }
 
-        case (SET_DATATYPE_INT16):
-        case (SET_DATATYPE_UINT16):
-            Uint = (uint64_t)Data->data.u16;
-            UseUint = true;
-            break;
+        // Read the element
+        SET_DataType ElementType;
 
-        case (SET_DATATYPE_INT32):
-        case (SET_DATATYPE_UINT32):
-            Uint = (uint64_t)Data->data.u32;
-            UseUint = true;
-            break;
+        if (!_SET_LoadValue(Loader, Elements + Size * Count, Table, Type, Depth - 1, Mode, true, &ElementType))
+        {
+            _SET_AddError(_SET_ERRORID_LOADLIST_VALUE, _SET_ERRORMES_READVALUE, _SET_ELEMENTPREMES, Count);
+            free(Elements);
+            return false;
+        }
 
-        case (SET_DATATYPE_INT64):
-        case (SET_DATATYPE_UINT64):
-            Uint = (uint64_t)Data->data.u64;
-            UseUint = true;
-            break;
+        ++Count;
 
-        // If signed int
-        case (SET_DATATYPE_SINT8):
-            Sint = (int64_t)Data->data.i8;
-            UseSint = true;
-            break;
+        // Find the common type, the lists of a list must all have the same type
+        if (Count == 1)
+            CommonType = ElementType;
 
-        case (SET_DATATYPE_SINT16):
-            Sint = (int64_t)Data->data.i16;
-            UseSint = true;
-            break;
+        else if (Depth > 1 && ElementType != CommonType)
+        {
+            _SET_SetError(_SET_ERRORID_LOADLIST_LISTELEMENT, _SET_ERRORMES_LISTELEMENT, _SET_ELEMENTPREMES, Count - 1);
+            free(Elements);
+            return false;
+        }
 
-        case (SET_DATATYPE_SINT32):
-            Sint = (int64_t)Data->data.i32;
-            UseSint = true;
-            break;
+        else if (Depth == 1 && !_SET_MergeType(&CommonType, ElementType, Count - 1))
+        {
+            _SET_AddError(_SET_ERRORID_LOADLIST_MERGE, _SET_ERRORMES_COMMONTYPE);
+            free(Elements);
+            return false;
+        }
 
-        case (SET_DATATYPE_SINT64):
-            Sint = (int64_t)Data->data.i64;
-            UseSint = true;
-            break;
+        // Find the separator
+        _SET_SkipBlank(Stream);
 
-        // If float
-        case (SET_DATATYPE_FLOAT):
-            Float = (double)Data->data.f;
-            UseFloat = true;
-            break;
+        if (*Stream->pos == ',')
+        {
+            ++Stream->pos;
+            continue;
+        }
 
-        case (SET_DATATYPE_DOUBLE):
-            Float = (double)Data->data.d;
-            UseFloat = true;
+        if (*Stream->pos == ']')
+        {
+            ++Stream->pos;
             break;
+        }
 
-        default:
-            break;
+        if (*Stream->pos == '\0')
+            _SET_SetError(_SET_ERRORID_LOADLIST_ENDLIST, _SET_ERRORMES_ENDLIST);
+
+        else
+            _SET_SetError(_SET_ERRORID_LOADLIST_UNEXPECTED, _SET_ERRORMES_ENDVALUE, ',', _SET_ELEMENTPREMES, (uint32_t)(Count - 1), *Stream->pos);
+
+        free(Elements);
+        return false;
     }
 
-    if (Type >= SET_DATATYPE_DOUBLE)
+    if (!_SET_AddLoadAlloc(Loader, Elements, ((InList) ? (NULL) : (List))))
     {
-        if (UseUint)
-            Float = (double)Uint;
-
-        else if (UseSint)
-            Float = (double)Sint;
+        _SET_AddError(_SET_ERRORID_LOADLIST_ALLOC, _SET_ERRORMES_LOADALLOC);
+        free(Elements);
+        return false;
     }
 
-    else if (Type >= SET_DATATYPE_SINT8)
+    *List = Elements;
+    *LoadedType = CommonType;
+    return true;
+}
+
+bool _SET_AddLoadAlloc(SET_Loader *Loader, void *Pointer, void **Location)
+{
+    // Get memory for the entry
+    if (Loader->count == Loader->capacity)
     {
-        if (UseUint)
-            Sint = (int64_t)Uint;
+        size_t NewCapacity = ((Loader->capacity == 0) ? (_SET_STREAMSIZE) : (Loader->capacity * 2));
+        SET_LoadAlloc *NewAllocs = (SET_LoadAlloc *)realloc(Loader->allocs, sizeof(SET_LoadAlloc) * NewCapacity);
 
-        else if (UseFloat)
-            Sint = (int64_t)Float;
+        if (NewAllocs == NULL)
+        {
+            _SET_AddErrorForeign(_SET_ERRORID_ADDLOADALLOC_REALLOC, strerror(errno), _SET_ERRORMES_REALLOC, sizeof(SET_LoadAlloc) * NewCapacity);
+            return false;
+        }
+
+        Loader->allocs = NewAllocs;
+        Loader->capacity = NewCapacity;
     }
 
-    else
+    SET_LoadAlloc *Alloc = Loader->allocs + Loader->count++;
+    SET_InitLoadAlloc(Alloc);
+    Alloc->pointer = Pointer;
+    Alloc->location = Location;
+
+    return true;
+}
+
+void _SET_ReverseLoad(SET_Loader *Loader)
+{
+    for (SET_LoadAlloc *List = Loader->allocs, *EndList = Loader->allocs + Loader->count; List < EndList; ++List)
     {
-        if (UseSint)
-            Uint = (uint64_t)Sint;
+        if (List->location != NULL)
+            *List->location = NULL;
 
-        else if (UseFloat)
-            Uint = (uint64_t)Float;
+        free(List->pointer);
     }
 
-    // Convert to the correct type
+    Loader->count = 0;
+}
+
+size_t _SET_TypeSize(SET_DataType Type)
+{
     switch (Type)
     {
-        // Bool
         case (SET_DATATYPE_BOOL):
-            NewData.data.b = (bool)Uint;
-            break;
+            return sizeof(bool);
 
-        // Unsigned int
         case (SET_DATATYPE_INT8):
         case (SET_DATATYPE_UINT8):
-            NewData.data.u8 = (uint8_t)Uint;
-            break;
+            return sizeof(uint8_t);
 
         case (SET_DATATYPE_INT16):
         case (SET_DATATYPE_UINT16):
-            NewData.data.u16 = (uint16_t)Uint;
-            break;
+            return sizeof(uint16_t);
 
         case (SET_DATATYPE_INT32):
         case (SET_DATATYPE_UINT32):
-            NewData.data.u32 = (uint32_t)Uint;
-            break;
+            return sizeof(uint32_t);
 
         case (SET_DATATYPE_INT64):
         case (SET_DATATYPE_UINT64):
-            NewData.data.u64 = (uint64_t)Uint;
-            break;
+            return sizeof(uint64_t);
 
-        // Signed int
         case (SET_DATATYPE_SINT8):
-            NewData.data.i8 = (int8_t)Sint;
-            break;
+            return sizeof(int8_t);
 
         case (SET_DATATYPE_SINT16):
-            NewData.data.i16 = (int16_t)Sint;
-            break;
+            return sizeof(int16_t);
 
         case (SET_DATATYPE_SINT32):
-            NewData.data.i32 = (int32_t)Sint;
-            break;
+            return sizeof(int32_t);
 
         case (SET_DATATYPE_SINT64):
-            NewData.data.i64 = (int64_t)Sint;
-            break;
+            return sizeof(int64_t);
 
-        // Float
         case (SET_DATATYPE_FLOAT):
-            NewData.data.f = (float)Float;
-            break;
+            return sizeof(float);
 
         case (SET_DATATYPE_DOUBLE):
-            NewData.data.d = (double)Float;
-            break;
+            return sizeof(double);
+
+        case (SET_DATATYPE_CHAR):
+            return sizeof(char);
+
+        case (SET_DATATYPE_STR):
+            return sizeof(char *);
 
         default:
-            break;
+            return 0;
     }
-
-    return NewData;
 }
 
-SET_Data _SET_ConvertBool(const char *String)
+bool SET_CompileSettings(const char *FileName)
 {
-    // Go through different cases
-    size_t Length = strlen(String);
-    SET_Data Data;
-    SET_InitData(&Data);
+    // Find the state of the file before loading it so a change while loading makes the cache outdated
+    SET_CacheHeader Source;
 
-    if ((Length == 1 && *String == '0') || strcmp(String, _SET_FALSENAME) == 0)
-        Data.data.b = false;
+    if (!_SET_StatSource(&Source, FileName))
+    {
+        _SET_SetError(_SET_ERRORID_COMPILESETTINGS_STAT, _SET_ERRORMES_STATFILE, FileName);
+        return false;
+    }
 
-    else if ((Length == 1 && *String == '1') || strcmp(String, _SET_TRUENAME) == 0)
-        Data.data.b = true;
+    // Load file
+    char *String = FIL_Load(FileName);
 
-    else
+    if (String == NULL)
     {
-        _SET_SetError(_SET_ERRORID_CONVERTBOOL_CORRECT, _SET_ERRORMES_ILLIGALBOOL, String);
-        return Data;
+        _SET_AddErrorForeign(_SET_ERRORID_COMPILESETTINGS_LOAD, FIL_GetError(), _SET_ERRORMES_LOADFILE, FileName);
+        return false;
     }
 
-    Data.type = SET_DATATYPE_BOOL;
-    return Data;
-}
-
-SET_Data _SET_ConvertUint(const char *String)
-{
-    SET_Data Value;
-    SET_InitData(&Value);
+    // The text is changed while parsing so it is hashed first
+    Source.sourceHash = _SET_HashText(String, strlen(String));
+    SET_DataStruct *Struct = _SET_ParseText(String, NULL, NULL, false);
+    free(String);
+
+    if (Struct == NULL)
+    {
+        _SET_AddError(_SET_ERRORID_COMPILESETTINGS_PARSE, _SET_ERRORMES_PARSEFILE, FileName);
+        return false;
+    }
+
+    // Write the cache
+    char *CacheName = _SET_CacheName(FileName);
+
+    if (CacheName == NULL)
+    {
+        _SET_AddError(_SET_ERRORID_COMPILESETTINGS_NAME, _SET_ERRORMES_CACHENAME);
+        SET_DestroyDataStruct(Struct);
+        return false;
+    }
+
+    bool Written = _SET_WriteCache(Struct, CacheName, &Source);
+
+    if (!Written)
+        _SET_AddError(_SET_ERRORID_COMPILESETTINGS_WRITE, _SET_ERRORMES_WRITECACHE, CacheName);
+
+    free(CacheName);
+    SET_DestroyDataStruct(Struct);
+
+    return Written;
+}
+
+char *_SET_CacheName(const char *FileName)
+{
+    size_t Length = strlen(FileName);
+    char *CacheName = (char *)malloc(sizeof(char) * (Length + sizeof(SET_CACHESUFFIX)));
+
+    if (CacheName == NULL)
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_CACHENAME_MALLOC, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(char) * (Length + sizeof(SET_CACHESUFFIX)));
+        return NULL;
+    }
+
+    memcpy(CacheName, FileName, sizeof(char) * Length);
+    memcpy(CacheName + Length, SET_CACHESUFFIX, sizeof(SET_CACHESUFFIX));
+
+    return CacheName;
+}
+
+uint64_t _SET_HashText(const char *String, size_t Length)
+{
+    uint64_t Hash = Length;
+
+    // Mix in 8 bytes at a time
+    const char *Current = String;
+
+    for (const char *End = String + (Length & ~(sizeof(uint64_t) - 1)); Current < End; Current += sizeof(uint64_t))
+    {
+        uint64_t Word;
+        memcpy(&Word, Current, sizeof(uint64_t));
+        Hash = (Hash ^ Word) * 0x9E3779B97F4A7C15;
+        Hash ^= Hash >> 29;
+    }
+
+    // Mix in the rest
+    uint64_t Word = 0;
+    memcpy(&Word, Current, String + Length - Current);
+    Hash = (Hash ^ Word) * 0x9E3779B97F4A7C15;
+    Hash ^= Hash >> 29;
+
+    return Hash;
+}
+
+bool _SET_StatSource(SET_CacheHeader *Header, const char *FileName)
+{
+    struct stat FileStat;
+
+    if (stat(FileName, &FileStat) == -1)
+        return false;
+
+    Header->sourceSize = (uint64_t)FileStat.st_size;
+    Header->sourceTime = (int64_t)FileStat.st_mtim.tv_sec;
+    Header->sourceTimeNano = (int64_t)FileStat.st_mtim.tv_nsec;
+
+    return true;
+}
+
+bool _SET_WriteCache(SET_DataStruct *Struct, const char *FileName, const SET_CacheHeader *Source)
+{
+    // Build the cache in memory, starting with the header
+    SET_CacheWriter Writer;
+    SET_InitCacheWriter(&Writer);
+    uint64_t HeaderOffset;
+
+    if (!_SET_CacheReserve(&Writer, sizeof(SET_CacheHeader), &HeaderOffset))
+    {
+        _SET_AddError(_SET_ERRORID_WRITECACHE_HEADER, _SET_ERRORMES_WRITESTRUCT);
+        return false;
+    }
+
+    uint64_t Root;
+
+    if (!_SET_CacheWriteStruct(&Writer, Struct, &Root))
+    {
+        _SET_AddError(_SET_ERRORID_WRITECACHE_STRUCT, _SET_ERRORMES_WRITESTRUCT);
+        free(Writer.data);
+        return false;
+    }
+
+    SET_CacheHeader *Header = (SET_CacheHeader *)(Writer.data + HeaderOffset);
+    *Header = *Source;
+    Header->magic = _SET_CACHEMAGIC;
+    Header->size = Writer.size;
+    Header->hashCheck = DIC_HashKey(_SET_CACHEHASHCHECK);
+    Header->root = Root;
+
+    // Write it all at once
+    FILE *File = fopen(FileName, "wb");
+
+    if (File == NULL)
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_WRITECACHE_OPEN, strerror(errno), _SET_ERRORMES_OPENFILE, FileName);
+        free(Writer.data);
+        return false;
+    }
+
+    if (fwrite(Writer.data, sizeof(uint8_t), Writer.size, File) != Writer.size)
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_WRITECACHE_WRITE, strerror(errno), _SET_ERRORMES_WRITEFILE, FileName);
+        fclose(File);
+        free(Writer.data);
+        return false;
+    }
+
+    free(Writer.data);
+
+    if (fclose(File) != 0)
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_WRITECACHE_WRITE, strerror(errno), _SET_ERRORMES_WRITEFILE, FileName);
+        return false;
+    }
+
+    return true;
+}
+
+bool _SET_CacheReserve(SET_CacheWriter *Writer, size_t Size, uint64_t *Offset)
+{
+    Size = _SET_CACHEALIGN(Size);
+
+    // Get more memory
+    if (Writer->size + Size > Writer->capacity)
+    {
+        size_t NewCapacity = ((Writer->capacity == 0) ? (_SET_CACHESIZE) : (Writer->capacity));
+
+        while (NewCapacity < Writer->size + Size)
+            NewCapacity *= 2;
+
+        uint8_t *NewData = (uint8_t *)realloc(Writer->data, NewCapacity);
+
+        if (NewData == NULL)
+        {
+            _SET_AddErrorForeign(_SET_ERRORID_CACHERESERVE_REALLOC, strerror(errno), _SET_ERRORMES_REALLOC, NewCapacity);
+            return false;
+        }
+
+        Writer->data = NewData;
+        Writer->capacity = NewCapacity;
+    }
+
+    memset(Writer->data + Writer->size, 0, Size);
+    *Offset = Writer->size;
+    Writer->size += Size;
+
+    return true;
+}
+
+bool _SET_CacheWriteStruct(SET_CacheWriter *Writer, SET_DataStruct *Struct, uint64_t *Offset)
+{
+    // Get space for the count and the fields, the data keeps moving so only offsets are kept
+    uint64_t Count = DIC_DictLength(Struct);
+    uint64_t StructOffset;
+
+    if (!_SET_CacheReserve(Writer, sizeof(uint64_t) + sizeof(SET_CacheField) * Count, &StructOffset))
+    {
+        _SET_AddError(_SET_ERRORID_CACHEWRITESTRUCT_RESERVE, _SET_ERRORMES_WRITESTRUCT);
+        return false;
+    }
+
+    *(uint64_t *)(Writer->data + StructOffset) = Count;
+    uint64_t FieldOffset = StructOffset + sizeof(uint64_t);
+
+    DIC_ForEach(Struct, Item)
+    {
+        // Add the name
+        size_t Length = strlen(Item.key) + 1;
+        uint64_t NameOffset;
+
+        if (!_SET_CacheReserve(Writer, Length, &NameOffset))
+        {
+            _SET_AddError(_SET_ERRORID_CACHEWRITESTRUCT_NAME, _SET_ERRORMES_WRITEVALUE, Item.key);
+            return false;
+        }
+
+        memcpy(Writer->data + NameOffset, Item.key, Length);
+
+        SET_CacheField *Field = (SET_CacheField *)(Writer->data + FieldOffset);
+        Field->name = NameOffset;
+        Field->hash = DIC_HashKey(Item.key);
+
+        // Add the value
+        if (!_SET_CacheWriteValue(Writer, (SET_Data *)Item.value, FieldOffset + offsetof(SET_CacheField, value)))
+        {
+            _SET_AddError(_SET_ERRORID_CACHEWRITESTRUCT_VALUE, _SET_ERRORMES_WRITEVALUE, Item.key);
+            return false;
+        }
+
+        FieldOffset += sizeof(SET_CacheField);
+    }
+
+    *Offset = StructOffset;
+    return true;
+}
+
+bool _SET_CacheWriteValue(SET_CacheWriter *Writer, const SET_Data *Data, uint64_t Offset)
+{
+    uint64_t Value = 0;
+
+    switch (Data->type)
+    {
+        case (SET_DATATYPE_STR):
+        {
+            size_t Length = strlen(Data->data.str) + 1;
+
+            if (!_SET_CacheReserve(Writer, Length, &Value))
+            {
+                _SET_AddError(_SET_ERRORID_CACHEWRITEVALUE_RESERVE, _SET_ERRORMES_WRITEVALUE, Data->data.str);
+                return false;
+            }
+
+            memcpy(Writer->data + Value, Data->data.str, Length);
+            break;
+        }
+
+        case (SET_DATATYPE_STRUCT):
+            if (!_SET_CacheWriteStruct(Writer, Data->data.stct, &Value))
+            {
+                _SET_AddError(_SET_ERRORID_CACHEWRITEVALUE_STRUCT, _SET_ERRORMES_WRITESTRUCT);
+                return false;
+            }
+
+            break;
+
+        // The values of lists are placed right after each other
+        case (SET_DATATYPE_LIST):
+        {
+            const SET_DataList *List = Data->data.list;
+
+            if (!_SET_CacheReserve(Writer, sizeof(uint64_t) * 3 + sizeof(SET_CacheValue) * List->count, &Value))
+            {
+                _SET_AddError(_SET_ERRORID_CACHEWRITEVALUE_RESERVE, _SET_ERRORMES_WRITELIST);
+                return false;
+            }
+
+            uint64_t *ListHeader = (uint64_t *)(Writer->data + Value);
+            ListHeader[0] = List->count;
+            ListHeader[1] = List->type;
+            ListHeader[2] = List->depth;
+
+            uint64_t ValueOffset = Value + sizeof(uint64_t) * 3;
+
+            for (uint32_t Pos = 0; Pos < List->count; ++Pos, ValueOffset += sizeof(SET_CacheValue))
+            {
+                SET_Data Element = SET_ListElement(List, Pos);
+
+                if (!_SET_CacheWriteValue(Writer, &Element, ValueOffset))
+                {
+                    _SET_AddError(_SET_ERRORID_CACHEWRITEVALUE_LIST, _SET_ERRORMES_WRITELIST);
+                    return false;
+                }
+            }
+
+            break;
+        }
+
+        case (SET_DATATYPE_NONE):
+            _SET_SetError(_SET_ERRORID_CACHEWRITEVALUE_TYPE, _SET_ERRORMES_WRONGTYPE, (uint32_t)Data->type);
+            return false;
+
+        // Numbers and chars are saved as they are
+        default:
+            memcpy(&Value, &Data->data, sizeof(uint64_t));
+            break;
+    }
+
+    SET_CacheValue *CacheValue = (SET_CacheValue *)(Writer->data + Offset);
+    CacheValue->type = Data->type;
+    CacheValue->data = Value;
+
+    return true;
+}
+
+uint8_t *_SET_MapCache(const char *FileName, const SET_CacheHeader *Source, const char *Text, size_t *Size)
+{
+    char *CacheName = _SET_CacheName(FileName);
+
+    if (CacheName == NULL)
+        return NULL;
+
+    int FileID = open(CacheName, O_RDONLY);
+    free(CacheName);
+
+    if (FileID == -1)
+        return NULL;
+
+    // Get the size
+    struct stat FileStat;
+
+    if (fstat(FileID, &FileStat) == -1 || (size_t)FileStat.st_size < sizeof(SET_CacheHeader))
+    {
+        close(FileID);
+        return NULL;
+    }
+
+    // Map it, the file can be closed afterwards
+    *Size = (size_t)FileStat.st_size;
+    void *Data = mmap(NULL, *Size, PROT_READ, MAP_SHARED, FileID, 0);
+    close(FileID);
+
+    if (Data == MAP_FAILED)
+        return NULL;
+
+    // Make sure it belongs to the settings file as it is now, the text is hashed last since it is the only check which reads all of it
+    const SET_CacheHeader *Header = (const SET_CacheHeader *)Data;
+
+    if (Header->magic != _SET_CACHEMAGIC || Header->size != *Size || Header->sourceSize != Source->sourceSize || Header->sourceTime != Source->sourceTime || Header->sourceTimeNano != Source->sourceTimeNano || Header->sourceHash != _SET_HashText(Text, strlen(Text)))
+    {
+        munmap(Data, *Size);
+        return NULL;
+    }
+
+    return (uint8_t *)Data;
+}
+
+SET_DataStruct *_SET_LoadCache(const char *FileName, const SET_CacheHeader *Source, const char *Text, ARN_Arena *Arena, uint8_t **Map, size_t *MapSize)
+{
+    size_t Size;
+    uint8_t *Data = _SET_MapCache(FileName, Source, Text, &Size);
+
+    if (Data == NULL)
+        return NULL;
+
+    // Hold the hash table so the check uses the same one as the dicts
+    if (!DIC_AcquireHash())
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_LOADCACHE_HASH, DIC_GetError(), _SET_ERRORMES_ACQUIREHASH);
+        munmap(Data, Size);
+        return NULL;
+    }
+
+    const SET_CacheHeader *Header = (const SET_CacheHeader *)Data;
+    SET_CacheReader Reader;
+    SET_InitCacheReader(&Reader);
+    Reader.data = Data;
+    Reader.size = Size;
+    Reader.arena = Arena;
+    Reader.hashes = (Header->hashCheck == DIC_HashKey(_SET_CACHEHASHCHECK));
+
+    // The top struct is written after the header
+    if (Header->root < sizeof(SET_CacheHeader))
+    {
+        _SET_SetError(_SET_ERRORID_LOADCACHE_ROOT, _SET_ERRORMES_CORRUPTCACHE, Header->root);
+        DIC_ReleaseHash();
+        munmap(Data, Size);
+        return NULL;
+    }
+
+    SET_DataStruct *Result = _SET_ReadCacheStruct(&Reader, Header->root);
+    DIC_ReleaseHash();
+
+    if (Result == NULL)
+    {
+        _SET_AddError(_SET_ERRORID_LOADCACHE_READ, _SET_ERRORMES_READCACHE, FileName);
+        munmap(Data, Size);
+        return NULL;
+    }
+
+    // Without an arena everything has been copied out of the cache
+    if (Arena == NULL)
+        munmap(Data, Size);
+
+    else
+    {
+        *Map = Data;
+        *MapSize = Size;
+    }
+
+    return Result;
+}
+
+SET_DataStruct *_SET_ReadCacheStruct(SET_CacheReader *Reader, uint64_t Offset)
+{
+    if (!_SET_CACHEFITS(Reader, Offset, sizeof(uint64_t)))
+    {
+        _SET_SetError(_SET_ERRORID_READCACHESTRUCT_CORRUPT, _SET_ERRORMES_CORRUPTCACHE, Offset);
+        return NULL;
+    }
+
+    uint64_t Count = *(const uint64_t *)(Reader->data + Offset);
+    Offset += sizeof(uint64_t);
+
+    if (Count > (Reader->size - Offset) / sizeof(SET_CacheField))
+    {
+        _SET_SetError(_SET_ERRORID_READCACHESTRUCT_CORRUPT, _SET_ERRORMES_CORRUPTCACHE, Offset);
+        return NULL;
+    }
+
+    // Create the dict the same way as when parsing
+    DIC_Dict *Dict;
+
+    if (Reader->arena != NULL)
+        Dict = DIC_CreateArenaDict(Count, Reader->arena);
+
+    else
+        Dict = DIC_CreateDict(Count);
+
+    if (Dict == NULL)
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_READCACHESTRUCT_CREATEDICT, DIC_GetError(), _SET_ERRORMES_CREATEDICT);
+        return NULL;
+    }
+
+    if (!DIC_AddBloomFilter(Dict, Count))
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_READCACHESTRUCT_BLOOM, DIC_GetError(), _SET_ERRORMES_BLOOM);
+        if (Reader->arena == NULL)
+            DIC_DestroyDict(Dict);
+        return NULL;
+    }
+
+    // The names in an arena tree point into the cache
+    if (Reader->arena != NULL)
+        DIC_BorrowKeys(Dict);
+
+    else if (!DIC_InternKeys(Dict))
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_READCACHESTRUCT_INTERN, DIC_GetError(), _SET_ERRORMES_INTERN);
+        DIC_DestroyDict(Dict);
+        return NULL;
+    }
+
+    // Add the fields
+    for (const SET_CacheField *Field = (const SET_CacheField *)(Reader->data + Offset), *EndField = Field + Count; Field < EndField; ++Field)
+    {
+        if (!_SET_CACHEFITS(Reader, Field->name, 1) || memchr(Reader->data + Field->name, '\0', Reader->size - Field->name) == NULL)
+        {
+            _SET_SetError(_SET_ERRORID_READCACHESTRUCT_CORRUPT, _SET_ERRORMES_CORRUPTCACHE, Field->name);
+            if (Reader->arena == NULL)
+                SET_DestroyDataStruct(Dict);
+            return NULL;
+        }
+
+        const char *Name = (const char *)(Reader->data + Field->name);
+        SET_Data *Data = (SET_Data *)((Reader->arena != NULL) ? (ARN_Alloc(Reader->arena, sizeof(SET_Data))) : (malloc(sizeof(SET_Data))));
+
+        if (Data == NULL)
+        {
+            _SET_AddErrorForeign(_SET_ERRORID_READCACHESTRUCT_MALLOC, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(SET_Data));
+            if (Reader->arena == NULL)
+                SET_DestroyDataStruct(Dict);
+            return NULL;
+        }
+
+        SET_InitData(Data);
+
+        if (!_SET_ReadCacheValue(Reader, &Field->value, Data))
+        {
+            _SET_AddError(_SET_ERRORID_READCACHESTRUCT_VALUE, _SET_ERRORMES_READCACHEVALUE, Name);
+            if (Reader->arena == NULL)
+            {
+                SET_DestroyData(Data);
+                SET_DestroyDataStruct(Dict);
+            }
+            return NULL;
+        }
+
+        // The names were checked for dublicates when the cache was made
+        bool Added;
+
+        if (Reader->hashes)
+            Added = DIC_AddItemHashed(Dict, Name, Field->hash, (void *)Data, 0, DIC_MODE_POINTER);
+
+        else
+            Added = DIC_AddItem(Dict, Name, (void *)Data, 0, DIC_MODE_POINTER);
+
+        if (!Added)
+        {
+            _SET_AddErrorForeign(_SET_ERRORID_READCACHESTRUCT_ADDITEM, DIC_GetError(), _SET_ERRORMES_DICTADD, Name);
+            if (Reader->arena == NULL)
+            {
+                SET_DestroyData(Data);
+                SET_DestroyDataStruct(Dict);
+            }
+            return NULL;
+        }
+    }
+
+    return Dict;
+}
+
+bool _SET_ReadCacheValue(SET_CacheReader *Reader, const SET_CacheValue *Value, SET_Data *Data)
+{
+    extern _Atomic bool _SET_PackLists;
+
+    // Structs and lists are always written after the value pointing to them, so a corrupt cache cannot make the reader go in circles
+    if ((Value->type == SET_DATATYPE_STRUCT || Value->type == SET_DATATYPE_LIST) && Value->data <= (uint64_t)((const uint8_t *)Value - Reader->data))
+    {
+        _SET_SetError(_SET_ERRORID_READCACHEVALUE_CORRUPT, _SET_ERRORMES_CORRUPTCACHE, Value->data);
+        return false;
+    }
+
+    switch (Value->type)
+    {
+        case (SET_DATATYPE_STR):
+        {
+            if (!_SET_CACHEFITS(Reader, Value->data, 1) || memchr(Reader->data + Value->data, '\0', Reader->size - Value->data) == NULL)
+            {
+                _SET_SetError(_SET_ERRORID_READCACHEVALUE_CORRUPT, _SET_ERRORMES_CORRUPTCACHE, Value->data);
+                return false;
+            }
+
+            const char *String = (const char *)(Reader->data + Value->data);
+
+            // Strings in an arena tree point into the cache
+            if (Reader->arena != NULL)
+                Data->data.str = (char *)String;
+
+            else
+            {
+                size_t Length = strlen(String) + 1;
+                Data->data.str = (char *)malloc(sizeof(char) * Length);
+
+                if (Data->data.str == NULL)
+                {
+                    _SET_AddErrorForeign(_SET_ERRORID_READCACHEVALUE_MALLOC, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(char) * Length);
+                    return false;
+                }
+
+                memcpy(Data->data.str, String, sizeof(char) * Length);
+            }
+
+            break;
+        }
+
+        case (SET_DATATYPE_STRUCT):
+            Data->data.stct = _SET_ReadCacheStruct(Reader, Value->data);
+
+            if (Data->data.stct == NULL)
+            {
+                _SET_AddError(_SET_ERRORID_READCACHEVALUE_STRUCT, _SET_ERRORMES_CONVERTSTRUCT);
+                return false;
+            }
+
+            break;
+
+        case (SET_DATATYPE_LIST):
+        {
+            if (!_SET_CACHEFITS(Reader, Value->data, sizeof(uint64_t) * 3))
+            {
+                _SET_SetError(_SET_ERRORID_READCACHEVALUE_CORRUPT, _SET_ERRORMES_CORRUPTCACHE, Value->data);
+                return false;
+            }
+
+            const uint64_t *ListHeader = (const uint64_t *)(Reader->data + Value->data);
+            uint64_t ValuesOffset = Value->data + sizeof(uint64_t) * 3;
+
+            if (ListHeader[0] > (Reader->size - ValuesOffset) / sizeof(SET_CacheValue))
+            {
+                _SET_SetError(_SET_ERRORID_READCACHEVALUE_CORRUPT, _SET_ERRORMES_CORRUPTCACHE, Value->data);
+                return false;
+            }
+
+            // Numbers, bools and chars are packed if the list is not deeper and SET_PackLists is on
+            size_t PackedSize = 0;
+
+            if (ListHeader[2] == 1 && ListHeader[1] != SET_DATATYPE_STR && atomic_load(&_SET_PackLists))
+                PackedSize = _SET_TypeSize((SET_DataType)ListHeader[1]);
+
+            // Allocate the list, in an arena all of the values are placed after each other
+            SET_DataList *List;
+            SET_Data *Values = NULL;
+
+            if (Reader->arena != NULL)
+            {
+                List = (SET_DataList *)ARN_Alloc(Reader->arena, sizeof(SET_DataList));
+
+                if (List != NULL)
+                {
+                    SET_InitDataList(List);
+
+                    if (PackedSize > 0)
+                        List->packed = ARN_Alloc(Reader->arena, PackedSize * ListHeader[0]);
+
+                    else
+                    {
+                        List->list = (SET_Data **)ARN_Alloc(Reader->arena, sizeof(SET_Data *) * ListHeader[0]);
+                        Values = (SET_Data *)ARN_Alloc(Reader->arena, sizeof(SET_Data) * ListHeader[0]);
+                    }
+                }
+
+                if (List == NULL || (List->packed == NULL && (List->list == NULL || Values == NULL)))
+                {
+                    _SET_AddErrorForeign(_SET_ERRORID_READCACHEVALUE_MALLOC, ARN_GetError(), _SET_ERRORMES_MALLOC, (sizeof(SET_Data *) + sizeof(SET_Data)) * ListHeader[0]);
+                    return false;
+                }
+            }
+
+            else
+            {
+                List = (SET_DataList *)malloc(sizeof(SET_DataList));
+
+                if (List == NULL)
+                {
+                    _SET_AddErrorForeign(_SET_ERRORID_READCACHEVALUE_MALLOC, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(SET_DataList));
+                    return false;
+                }
+
+                SET_InitDataList(List);
+
+                if (PackedSize > 0)
+                    List->packed = malloc(PackedSize * ListHeader[0]);
+
+                else
+                    List->list = (SET_Data **)malloc(sizeof(SET_Data *) * ListHeader[0]);
+
+                if (List->packed == NULL && List->list == NULL)
+                {
+                    _SET_AddErrorForeign(_SET_ERRORID_READCACHEVALUE_MALLOC, strerror(errno), _SET_ERRORMES_MALLOC, ((PackedSize > 0) ? (PackedSize) : (sizeof(SET_Data *))) * ListHeader[0]);
+                    SET_DestroyDataList(List);
+                    return false;
+                }
+            }
+
+            List->count = 0;
+            List->type = (SET_DataType)ListHeader[1];
+            List->depth = (uint32_t)ListHeader[2];
+
+            // The values of a packed list are saved as they are
+            if (PackedSize > 0)
+            {
+                for (const SET_CacheValue *ValueList = (const SET_CacheValue *)(Reader->data + ValuesOffset), *EndValueList = ValueList + ListHeader[0]; ValueList < EndValueList; ++ValueList)
+                {
+                    if (ValueList->type != List->type)
+                    {
+                        _SET_SetError(_SET_ERRORID_READCACHEVALUE_PACKED, _SET_ERRORMES_CORRUPTCACHE, Value->data);
+
+                        if (Reader->arena == NULL)
+                            SET_DestroyDataList(List);
+
+                        return false;
+                    }
+
+                    memcpy((uint8_t *)List->packed + PackedSize * List->count++, &ValueList->data, PackedSize);
+                }
+
+                Data->data.list = List;
+                break;
+            }
+
+            // Read the values
+            for (const SET_CacheValue *ValueList = (const SET_CacheValue *)(Reader->data + ValuesOffset), *EndValueList = ValueList + ListHeader[0]; ValueList < EndValueList; ++ValueList)
+            {
+                SET_Data *Element = ((Values != NULL) ? (Values + List->count) : ((SET_Data *)malloc(sizeof(SET_Data))));
+
+                if (Element == NULL)
+                {
+                    _SET_AddErrorForeign(_SET_ERRORID_READCACHEVALUE_MALLOC, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(SET_Data));
+                    SET_DestroyDataList(List);
+                    return false;
+                }
+
+                SET_InitData(Element);
+
+                if (!_SET_ReadCacheValue(Reader, ValueList, Element))
+                {
+                    _SET_AddError(_SET_ERRORID_READCACHEVALUE_VALUE, _SET_ERRORMES_READVALUE, _SET_ELEMENTPREMES, (size_t)List->count);
+                    if (Reader->arena == NULL)
+                    {
+                        SET_DestroyData(Element);
+                        SET_DestroyDataList(List);
+                    }
+                    return false;
+                }
+
+                List->list[List->count++] = Element;
+            }
+
+            Data->data.list = List;
+            break;
+        }
+
+        default:
+            if (Value->type == SET_DATATYPE_NONE || Value->type > SET_DATATYPE_LIST)
+            {
+                _SET_SetError(_SET_ERRORID_READCACHEVALUE_TYPE, _SET_ERRORMES_WRONGTYPE, (uint32_t)Value->type);
+                return false;
+            }
+
+            memcpy(&Data->data, &Value->data, sizeof(uint64_t));
+            break;
+    }
+
+    Data->type = (SET_DataType)Value->type;
+    return true;
+}
+
+SET_Watcher *SET_CreateWatcher(const char *FileName)
+{
+    SET_Watcher *Watcher = (SET_Watcher *)malloc(sizeof(SET_Watcher));
+
+    if (Watcher == NULL)
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_CREATEWATCHER_MALLOC, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(SET_Watcher));
+        return NULL;
+    }
+
+    SET_InitWatcher(Watcher);
+
+    size_t Length = strlen(FileName) + 1;
+    Watcher->fileName = (char *)malloc(sizeof(char) * Length);
+
+    if (Watcher->fileName == NULL)
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_CREATEWATCHER_MALLOC, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(char) * Length);
+        SET_DestroyWatcher(Watcher);
+        return NULL;
+    }
+
+    memcpy(Watcher->fileName, FileName, sizeof(char) * Length);
+    const char *Slash = strrchr(Watcher->fileName, '/');
+    Watcher->baseName = ((Slash != NULL) ? (Slash + 1) : (Watcher->fileName));
+
+    // Start watching before loading so no change is missed
+    Watcher->fileID = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+    if (Watcher->fileID == -1)
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_CREATEWATCHER_INIT, strerror(errno), _SET_ERRORMES_INOTIFY, FileName);
+        SET_DestroyWatcher(Watcher);
+        return NULL;
+    }
+
+    // dirname may change the string so it gets a copy
+    char *Directory = (char *)malloc(sizeof(char) * Length);
+
+    if (Directory == NULL)
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_CREATEWATCHER_MALLOC, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(char) * Length);
+        SET_DestroyWatcher(Watcher);
+        return NULL;
+    }
+
+    memcpy(Directory, FileName, sizeof(char) * Length);
+    Watcher->watchID = inotify_add_watch(Watcher->fileID, dirname(Directory), IN_CLOSE_WRITE | IN_MOVED_TO);
+    free(Directory);
+
+    if (Watcher->watchID == -1)
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_CREATEWATCHER_WATCH, strerror(errno), _SET_ERRORMES_INOTIFY, FileName);
+        SET_DestroyWatcher(Watcher);
+        return NULL;
+    }
+
+    // Load it for the first time, every field is added
+    if (!_SET_ReloadWatcher(Watcher))
+    {
+        _SET_AddError(_SET_ERRORID_CREATEWATCHER_LOAD, _SET_ERRORMES_RELOAD, FileName);
+        SET_DestroyWatcher(Watcher);
+        return NULL;
+    }
+
+    SET_ClearDiff(&Watcher->diff);
+
+    return Watcher;
+}
+
+const SET_Diff *SET_UpdateWatcher(SET_Watcher *Watcher, bool Wait)
+{
+    SET_ClearDiff(&Watcher->diff);
+
+    bool Changed = false;
+
+    if (!_SET_ReadWatcherEvents(Watcher, Wait, &Changed))
+    {
+        _SET_AddError(_SET_ERRORID_UPDATEWATCHER_EVENTS, _SET_ERRORMES_READEVENTS);
+        return NULL;
+    }
+
+    if (Changed && !_SET_ReloadWatcher(Watcher))
+    {
+        _SET_AddError(_SET_ERRORID_UPDATEWATCHER_RELOAD, _SET_ERRORMES_RELOAD, Watcher->fileName);
+        return NULL;
+    }
+
+    return &Watcher->diff;
+}
+
+bool SET_TranslateDiff(void *Struct, SET_DataStruct *Dict, const SET_TranslationTable *Table, size_t Count, SET_TranslationMode Mode, const SET_Diff *Diff)
+{
+    if (Diff->count == 0)
+        return true;
+
+    // Find the parts of the table which have changed, the fields which were there before are split from the rest since they have to be freed
+    const SET_TranslationTable **ChangedTable = (const SET_TranslationTable **)malloc(sizeof(SET_TranslationTable *) * Count);
+    SET_TranslationTable *SubTable = (SET_TranslationTable *)calloc(Count, sizeof(SET_TranslationTable));
+
+    if (ChangedTable == NULL || SubTable == NULL)
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_TRANSLATEDIFF_MALLOC, strerror(errno), _SET_ERRORMES_MALLOC, (sizeof(SET_TranslationTable *) + sizeof(SET_TranslationTable)) * Count);
+        free(ChangedTable);
+        free(SubTable);
+        return false;
+    }
+
+    size_t ChangedCount = 0;
+
+    for (const SET_TranslationTable *TableList = Table, *EndTableList = Table + Count; TableList < EndTableList; ++TableList)
+        for (const SET_Change *Change = Diff->list, *EndChange = Diff->list + Diff->count; Change < EndChange; ++Change)
+            if (strcmp(Change->name, TableList->name) == 0)
+            {
+                ChangedTable[ChangedCount++] = TableList;
+                break;
+            }
+
+    // A new field must be in the table in EMPTY mode
+    if (Mode & SET_TRANSLATIONMODE_EMPTY)
+        for (const SET_Change *Change = Diff->list, *EndChange = Diff->list + Diff->count; Change < EndChange; ++Change)
+        {
+            if (Change->type != SET_CHANGETYPE_ADDED)
+                continue;
+
+            const SET_TranslationTable **TableList = ChangedTable;
+            for (const SET_TranslationTable **EndTableList = ChangedTable + ChangedCount; TableList < EndTableList; ++TableList)
+                if (strcmp(Change->name, (*TableList)->name) == 0)
+                    break;
+
+            if (TableList >= ChangedTable + ChangedCount)
+            {
+                _SET_SetError(_SET_ERRORID_TRANSLATEDIFF_EMPTY, _SET_ERRORMES_TRANSLATEEMPTY, Change->name);
+                free(ChangedTable);
+                free(SubTable);
+                return false;
+            }
+        }
+
+    // None of the changes are in the table
+    if (ChangedCount == 0)
+    {
+        free(ChangedTable);
+        free(SubTable);
+        return true;
+    }
+
+    // Free the old translations
+    size_t SubCount = 0;
+
+    for (const SET_TranslationTable **TableList = ChangedTable, **EndTableList = ChangedTable + ChangedCount; TableList < EndTableList; ++TableList)
+        if (DIC_CheckItem(Diff->old, (*TableList)->name))
+            SubTable[SubCount++] = **TableList;
+
+    _SET_ReverseTranslation(Struct, Diff->old, SubTable, SubCount);
+
+    // Translate the new values, the unchanged fields are not in the table so EMPTY mode has been checked above
+    SubCount = 0;
+
+    for (const SET_TranslationTable **TableList = ChangedTable, **EndTableList = ChangedTable + ChangedCount; TableList < EndTableList; ++TableList)
+        SubTable[SubCount++] = **TableList;
+
+    bool Translated = SET_Translate(Struct, Dict, SubTable, SubCount, Mode & ~SET_TRANSLATIONMODE_EMPTY);
+
+    if (!Translated)
+        _SET_AddError(_SET_ERRORID_TRANSLATEDIFF_TRANSLATE, _SET_ERRORMES_TRANSLATEDIFF);
+
+    free(ChangedTable);
+    free(SubTable);
+
+    return Translated;
+}
+
+bool _SET_ReadWatcherEvents(SET_Watcher *Watcher, bool Wait, bool *Changed)
+{
+    if (Wait)
+    {
+        struct pollfd Poll = {.fd = Watcher->fileID, .events = POLLIN, .revents = 0};
+
+        while (poll(&Poll, 1, -1) == -1)
+            if (errno != EINTR)
+            {
+                _SET_AddErrorForeign(_SET_ERRORID_READWATCHEREVENTS_POLL, strerror(errno), _SET_ERRORMES_POLL);
+                return false;
+            }
+    }
+
+    // Read until there are no more events
+    char Buffer[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+
+    while (true)
+    {
+        ssize_t Length = read(Watcher->fileID, Buffer, sizeof(Buffer));
+
+        if (Length == -1)
+        {
+            if (errno == EAGAIN)
+                return true;
+
+            if (errno == EINTR)
+                continue;
+
+            _SET_AddErrorForeign(_SET_ERRORID_READWATCHEREVENTS_READ, strerror(errno), _SET_ERRORMES_READEVENTS);
+            return false;
+        }
+
+        for (const char *Current = Buffer, *End = Buffer + Length; Current < End;)
+        {
+            const struct inotify_event *Event = (const struct inotify_event *)Current;
+
+            // Events might have been lost so it has to be reloaded
+            if (Event->mask & IN_Q_OVERFLOW)
+                *Changed = true;
+
+            else if (Event->len > 0 && strcmp(Event->name, Watcher->baseName) == 0)
+                *Changed = true;
+
+            Current += sizeof(struct inotify_event) + Event->len;
+        }
+    }
+}
+
+bool _SET_ReloadWatcher(SET_Watcher *Watcher)
+{
+    char *Text = FIL_Load(Watcher->fileName);
+
+    if (Text == NULL)
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_RELOADWATCHER_LOAD, FIL_GetError(), _SET_ERRORMES_LOADFILE, Watcher->fileName);
+        return false;
+    }
+
+    // Nothing to do if it was saved without changes
+    if (Watcher->text != NULL && strcmp(Text, Watcher->text) == 0)
+    {
+        free(Text);
+        return true;
+    }
+
+    // Find the fields without parsing them
+    SET_WatchField *Fields;
+    size_t Count;
+
+    if (!_SET_SplitFields(Text, &Fields, &Count))
+    {
+        _SET_AddError(_SET_ERRORID_RELOADWATCHER_SPLIT, _SET_ERRORMES_SPLITFIELDS);
+        free(Text);
+        return false;
+    }
+
+    // The fields which have not changed are blanked out so only the changed ones are parsed, newlines are kept so errors have the correct lines
+    size_t Length = strlen(Text);
+    char *ParseText = (char *)malloc(sizeof(char) * (Length + 1));
+    SET_WatchField **OldFields = (SET_WatchField **)malloc(sizeof(SET_WatchField *) * ((Count > 0) ? (Count) : (1)));
+    DIC_Dict *Index = DIC_CreateDict((Count > 0) ? (Count) : (1));
+
+    if (ParseText == NULL || OldFields == NULL || Index == NULL)
+    {
+        if (Index == NULL)
+            _SET_AddErrorForeign(_SET_ERRORID_RELOADWATCHER_CREATEDICT, DIC_GetError(), _SET_ERRORMES_CREATEDICT);
+
+        else
+        {
+            _SET_AddErrorForeign(_SET_ERRORID_RELOADWATCHER_MALLOC, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(char) * (Length + 1) + sizeof(SET_WatchField *) * Count);
+            DIC_DestroyDict(Index);
+        }
+
+        free(ParseText);
+        free(OldFields);
+        _SET_DestroyWatchFields(Fields, Count);
+        free(Text);
+        return false;
+    }
+
+    memcpy(ParseText, Text, sizeof(char) * (Length + 1));
+
+    for (size_t Pos = 0; Pos < Count; ++Pos)
+    {
+        SET_WatchField *Field = Fields + Pos;
+
+        if (DIC_CheckItem(Index, Field->name))
+        {
+            _SET_SetError(_SET_ERRORID_RELOADWATCHER_DUBLICATE, _SET_ERRORMES_DUBLICATE, _SET_LINEPREMES, (size_t)Field->line);
+            DIC_DestroyDict(Index);
+            free(ParseText);
+            free(OldFields);
+            _SET_DestroyWatchFields(Fields, Count);
+            free(Text);
+            return false;
+        }
+
+        if (!DIC_AddItem(Index, Field->name, (void *)Field, 0, DIC_MODE_POINTER))
+        {
+            _SET_AddErrorForeign(_SET_ERRORID_RELOADWATCHER_ADDITEM, DIC_GetError(), _SET_ERRORMES_DICTADD, Field->name);
+            DIC_DestroyDict(Index);
+            free(ParseText);
+            free(OldFields);
+            _SET_DestroyWatchFields(Fields, Count);
+            free(Text);
+            return false;
+        }
+
+        // Compare with the old text of the field
+        SET_WatchField *OldField = ((Watcher->index != NULL) ? ((SET_WatchField *)DIC_GetItem(Watcher->index, Field->name)) : (NULL));
+
+        if (OldField != NULL && (OldField->length != Field->length || OldField->hash != Field->hash || memcmp(Watcher->text + OldField->start, Text + Field->start, sizeof(char) * Field->length) != 0))
+            OldField = NULL;
+
+        OldFields[Pos] = OldField;
+
+        if (OldField != NULL)
+            for (char *Current = ParseText + Field->start, *End = ParseText + Field->start + Field->length; Current < End; ++Current)
+                if (*Current != '\n')
+                    *Current = ' ';
+    }
+
+    // Parse the changed fields
+    SET_DataStruct *ChangedData = _SET_ParseText(ParseText, NULL, NULL, false);
+    free(ParseText);
+
+    if (ChangedData == NULL)
+    {
+        _SET_AddError(_SET_ERRORID_RELOADWATCHER_PARSE, _SET_ERRORMES_PARSEFILE, Watcher->fileName);
+        DIC_DestroyDict(Index);
+        free(OldFields);
+        _SET_DestroyWatchFields(Fields, Count);
+        free(Text);
+        return false;
+    }
+
+    // Put the new settings together, the values are only moved once everything has succeeded
+    DIC_Dict *Data = DIC_CreateDict((Count > 0) ? (Count) : (1));
+    DIC_Dict *Old = DIC_CreateDict((Watcher->count > 0) ? (Watcher->count) : (1));
+    SET_Change *Changes = (SET_Change *)malloc(sizeof(SET_Change) * ((Count + Watcher->count > 0) ? (Count + Watcher->count) : (1)));
+    size_t ChangeCount = 0;
+    bool Success = true;
+
+    if (Data == NULL || Old == NULL)
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_RELOADWATCHER_CREATEDICT, DIC_GetError(), _SET_ERRORMES_CREATEDICT);
+        Success = false;
+    }
+
+    else if (Changes == NULL)
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_RELOADWATCHER_MALLOC, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(SET_Change) * (Count + Watcher->count));
+        Success = false;
+    }
+
+    else if (!DIC_AddBloomFilter(Data, Count))
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_RELOADWATCHER_BLOOM, DIC_GetError(), _SET_ERRORMES_BLOOM);
+        Success = false;
+    }
+
+    else if (!DIC_InternKeys(Data) || !DIC_InternKeys(Old))
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_RELOADWATCHER_INTERN, DIC_GetError(), _SET_ERRORMES_INTERN);
+        Success = false;
+    }
+
+    // Take the unchanged values from the old settings and the rest from the new ones
+    for (size_t Pos = 0; Success && Pos < Count; ++Pos)
+    {
+        const char *Name = Fields[Pos].name;
+        SET_Data *Value = (SET_Data *)DIC_GetItem(((OldFields[Pos] != NULL) ? (Watcher->data) : (ChangedData)), Name);
+
+        if (!DIC_AddItem(Data, Name, (void *)Value, 0, DIC_MODE_POINTER))
+        {
+            _SET_AddErrorForeign(_SET_ERRORID_RELOADWATCHER_ADDITEM, DIC_GetError(), _SET_ERRORMES_DICTADD, Name);
+            Success = false;
+            break;
+        }
+
+        if (OldFields[Pos] == NULL)
+        {
+            SET_InitChange(Changes + ChangeCount);
+            Changes[ChangeCount].name = (char *)Name;
+            Changes[ChangeCount++].type = ((Watcher->index != NULL && DIC_CheckItem(Watcher->index, Name)) ? (SET_CHANGETYPE_CHANGED) : (SET_CHANGETYPE_ADDED));
+        }
+    }
+
+    // Keep the old values which are not used anymore
+    for (SET_WatchField *Field = Watcher->fields, *EndField = Watcher->fields + Watcher->count; Success && Field < EndField; ++Field)
+    {
+        SET_WatchField *NewField = (SET_WatchField *)DIC_GetItem(Index, Field->name);
+
+        if (NewField != NULL && OldFields[NewField - Fields] != NULL)
+            continue;
+
+        if (!DIC_AddItem(Old, Field->name, DIC_GetItem(Watcher->data, Field->name), 0, DIC_MODE_POINTER))
+        {
+            _SET_AddErrorForeign(_SET_ERRORID_RELOADWATCHER_ADDITEM, DIC_GetError(), _SET_ERRORMES_DICTADD, Field->name);
+            Success = false;
+            break;
+        }
+
+        if (NewField == NULL)
+        {
+            SET_InitChange(Changes + ChangeCount);
+            Changes[ChangeCount].name = Field->name;
+            Changes[ChangeCount++].type = SET_CHANGETYPE_REMOVED;
+        }
+    }
+
+    // The names of the changes are copied since the fields they point to are freed
+    for (SET_Change *Change = Changes, *EndChange = Changes + ChangeCount; Success && Change < EndChange; ++Change)
+    {
+        size_t NameLength = strlen(Change->name) + 1;
+        char *Name = (char *)malloc(sizeof(char) * NameLength);
+
+        if (Name == NULL)
+        {
+            _SET_AddErrorForeign(_SET_ERRORID_RELOADWATCHER_MALLOC, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(char) * NameLength);
+
+            for (SET_Change *Copied = Changes; Copied < Change; ++Copied)
+                free(Copied->name);
+
+            Success = false;
+            break;
+        }
+
+        memcpy(Name, Change->name, sizeof(char) * NameLength);
+        Change->name = Name;
+    }
+
+    if (!Success)
+    {
+        if (Data != NULL)
+            DIC_DestroyDict(Data);
+
+        if (Old != NULL)
+            DIC_DestroyDict(Old);
+
+        free(Changes);
+        SET_DestroyDataStruct(ChangedData);
+        DIC_DestroyDict(Index);
+        free(OldFields);
+        _SET_DestroyWatchFields(Fields, Count);
+        free(Text);
+        return false;
+    }
+
+    // Everything has been moved so only the dicts are destroyed
+    DIC_DestroyDict(ChangedData);
+    free(OldFields);
+
+    if (Watcher->data != NULL)
+        DIC_DestroyDict(Watcher->data);
+
+    if (Watcher->index != NULL)
+        DIC_DestroyDict(Watcher->index);
+
+    _SET_DestroyWatchFields(Watcher->fields, Watcher->count);
+    free(Watcher->text);
+
+    Watcher->data = Data;
+    Watcher->text = Text;
+    Watcher->fields = Fields;
+    Watcher->count = Count;
+    Watcher->index = Index;
+    Watcher->diff.list = Changes;
+    Watcher->diff.count = ChangeCount;
+    Watcher->diff.old = Old;
+
+    return true;
+}
+
+bool _SET_SplitFields(char *Text, SET_WatchField **Fields, size_t *Count)
+{
+    SET_Stream Stream;
+    SET_InitStream(&Stream);
+    Stream.pos = Text;
+
+    *Fields = NULL;
+    *Count = 0;
+    size_t Capacity = 0;
+
+    while (true)
+    {
+        _SET_SkipBlank(&Stream);
+
+        if (*Stream.pos == '\0')
+            return true;
+
+        // Get memory for the field
+        if (*Count == Capacity)
+        {
+            size_t NewCapacity = ((Capacity == 0) ? (_SET_STREAMSIZE) : (Capacity * 2));
+            SET_WatchField *NewFields = (SET_WatchField *)realloc(*Fields, sizeof(SET_WatchField) * NewCapacity);
+
+            if (NewFields == NULL)
+            {
+                _SET_AddErrorForeign(_SET_ERRORID_SPLITFIELDS_REALLOC, strerror(errno), _SET_ERRORMES_REALLOC, sizeof(SET_WatchField) * NewCapacity);
+                _SET_DestroyWatchFields(*Fields, *Count);
+                return false;
+            }
+
+            *Fields = NewFields;
+            Capacity = NewCapacity;
+        }
+
+        SET_WatchField *Field = *Fields + *Count;
+        SET_InitWatchField(Field);
+        Field->start = Stream.pos - Text;
+        Field->line = Stream.line;
+
+        // Find the name the same way as when parsing
+        char *NameString = Stream.pos;
+        size_t NameLength = _SET_WordLength(NameString);
+        bool Pointer = false;
+
+        Stream.pos += NameLength;
+        _SET_SkipBlank(&Stream);
+
+        for (; *Stream.pos == '*'; _SET_SkipBlank(&Stream))
+        {
+            Pointer = true;
+            ++Stream.pos;
+        }
+
+        if (Pointer || _SET_WordLength(Stream.pos) > 0)
+        {
+            NameString = Stream.pos;
+            NameLength = _SET_WordLength(NameString);
+            Stream.pos += NameLength;
+            _SET_SkipBlank(&Stream);
+        }
+
+        if (NameLength == 0 || *Stream.pos != '=')
+        {
+            _SET_SetError(_SET_ERRORID_SPLITFIELDS_NOVALUE, _SET_ERRORMES_NOVALUE, _SET_LINEPREMES, Field->line);
+            _SET_DestroyWatchFields(*Fields, *Count);
+            return false;
+        }
+
+        Field->name = (char *)malloc(sizeof(char) * (NameLength + 1));
+
+        if (Field->name == NULL)
+        {
+            _SET_AddErrorForeign(_SET_ERRORID_SPLITFIELDS_MALLOC, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(char) * (NameLength + 1));
+            _SET_DestroyWatchFields(*Fields, *Count);
+            return false;
+        }
+
+        memcpy(Field->name, NameString, sizeof(char) * NameLength);
+        Field->name[NameLength] = '\0';
+        ++*Count;
+
+        // Skip the value
+        ++Stream.pos;
+
+        if (!_SET_SkipValue(&Stream))
+        {
+            _SET_AddError(_SET_ERRORID_SPLITFIELDS_SKIP, _SET_ERRORMES_SKIPVALUE, _SET_LINEPREMES, (size_t)Field->line);
+            _SET_DestroyWatchFields(*Fields, *Count);
+            return false;
+        }
+
+        ++Stream.pos;
+        Field->length = Stream.pos - Text - Field->start;
+        Field->hash = _SET_HashText(Text + Field->start, Field->length);
+    }
+}
+
+bool _SET_SkipValue(SET_Stream *Stream)
+{
+    // Only brackets, strings and comments matter, everything else is skipped a block at a time
+    size_t Depth = 0;
+    SET_ScanBlock Block;
+    SET_InitScanBlock(&Block);
+
+    for (Stream->pos = _SET_ScanStructural(&Block, Stream->pos, &Stream->line); Depth > 0 || *Stream->pos != ';'; Stream->pos = _SET_ScanStructural(&Block, Stream->pos + 1, &Stream->line))
+        switch (*Stream->pos)
+        {
+            case ('\0'):
+                _SET_SetError(_SET_ERRORID_SKIPVALUE_END, _SET_ERRORMES_WRONGEND);
+                return false;
+
+            case ('['):
+            case ('{'):
+                ++Depth;
+                break;
+
+            case (']'):
+            case ('}'):
+                if (Depth == 0)
+                {
+                    _SET_SetError(_SET_ERRORID_SKIPVALUE_UNEXPECTED, _SET_ERRORMES_UNEXPECTED, _SET_LINEPREMES, Stream->line, *Stream->pos);
+                    return false;
+                }
+
+                --Depth;
+                break;
+
+            case ('\"'):
+            case ('\''):
+            {
+                char Quote = *Stream->pos;
+
+                for (Stream->pos = _SET_ScanString(&Block, Stream->pos + 1); *Stream->pos != Quote; Stream->pos = _SET_ScanString(&Block, Stream->pos + 1))
+                {
+                    if (*Stream->pos == '\0')
+                    {
+                        _SET_SetError(_SET_ERRORID_SKIPVALUE_END, _SET_ERRORMES_WRONGEND);
+                        return false;
+                    }
+
+                    if (*Stream->pos == '\n')
+                        ++Stream->line;
+
+                    else if (*Stream->pos == '\\' && *(Stream->pos + 1) != '\0')
+                        ++Stream->pos;
+                }
+
+                break;
+            }
+
+            case ('/'):
+                if (*(Stream->pos + 1) == '/' || *(Stream->pos + 1) == '*')
+                {
+                    _SET_SkipBlank(Stream);
+                    --Stream->pos;
+                }
+
+                break;
+
+            default:
+                break;
+        }
+
+    return true;
+}
+
+void _SET_DestroyWatchFields(SET_WatchField *Fields, size_t Count)
+{
+    if (Fields == NULL)
+        return;
+
+    for (SET_WatchField *List = Fields, *EndList = Fields + Count; List < EndList; ++List)
+        if (List->name != NULL)
+            free(List->name);
+
+    free(Fields);
+}
+
+void _SET_SkipBlank(SET_Stream *Stream)
+{
+    extern const uint8_t _SET_CharClass[];
+
+    char *Current = Stream->pos;
+
+    while (true)
+    {
+        // Newlines
+        if (*Current == '\n')
+        {
+            ++Stream->line;
+            ++Current;
+        }
+
+        // Other blanks
+        else if (_SET_CharClass[(uint8_t)*Current] & _SET_CHARCLASS_BLANK)
+            ++Current;
+
+        // Line comments
+        else if (*Current == '/' && *(Current + 1) == '/')
+            for (Current += 2; *Current != '\n' && *Current != '\0'; ++Current)
+                ;
+
+        // Multiline comments
+        else if (*Current == '/' && *(Current + 1) == '*')
+        {
+            for (Current += 2; *Current != '\0' && !(*Current == '*' && *(Current + 1) == '/'); ++Current)
+                if (*Current == '\n')
+                    ++Stream->line;
+
+            if (*Current != '\0')
+                Current += 2;
+        }
+
+        else
+            break;
+    }
+
+    Stream->pos = Current;
+}
+
+size_t _SET_WordLength(const char *String)
+{
+    extern const uint8_t _SET_CharClass[];
+
+    const char *Current = String;
+
+    for (;; ++Current)
+    {
+        if (_SET_CharClass[(uint8_t)*Current] & _SET_CHARCLASS_WORDEND)
+            return Current - String;
+
+        if (*Current == '/' && (*(Current + 1) == '/' || *(Current + 1) == '*'))
+            return Current - String;
+    }
+}
+
+static inline char *_SET_ScanStructural(SET_ScanBlock *Block, char *Pos, uint32_t *Line)
+{
+#ifdef __SSE2__
+    // Go through aligned blocks, the characters before Pos in the first block are ignored
+    char *Start = (char *)((uintptr_t)Pos & ~(uintptr_t)(_SET_SCANBLOCK - 1));
+    uint64_t Keep = ~(uint64_t)0 << (Pos - Start);
+
+    for (;; Start += _SET_SCANBLOCK, Keep = ~(uint64_t)0)
+    {
+        if (Block->start != Start)
+            _SET_ReadBlock(Block, Start);
+
+        uint64_t Found = Block->structural & Keep;
+        uint64_t Newlines = Block->newline & Keep;
+
+        // Only count the newlines before the character found
+        if (Found != 0)
+        {
+            uint32_t Offset = __builtin_ctzll(Found);
+            *Line += __builtin_popcountll(Newlines & ((((uint64_t)1) << Offset) - 1));
+            return Start + Offset;
+        }
+
+        *Line += __builtin_popcountll(Newlines);
+    }
+#else
+    extern const uint8_t _SET_CharClass[];
+
+    (void)Block;
+
+    for (; !(_SET_CharClass[(uint8_t)*Pos] & _SET_CHARCLASS_STRUCTURAL); ++Pos)
+        if (*Pos == '\n')
+            ++*Line;
+
+    return Pos;
+#endif
+}
+
+static inline char *_SET_ScanString(SET_ScanBlock *Block, char *Pos)
+{
+#ifdef __SSE2__
+    // Go through aligned blocks, the characters before Pos in the first block are ignored
+    char *Start = (char *)((uintptr_t)Pos & ~(uintptr_t)(_SET_SCANBLOCK - 1));
+    uint64_t Keep = ~(uint64_t)0 << (Pos - Start);
+
+    for (;; Start += _SET_SCANBLOCK, Keep = ~(uint64_t)0)
+    {
+        if (Block->start != Start)
+            _SET_ReadBlock(Block, Start);
+
+        uint64_t Found = Block->string & Keep;
+
+        if (Found != 0)
+            return Start + __builtin_ctzll(Found);
+    }
+#else
+    extern const uint8_t _SET_CharClass[];
+
+    (void)Block;
+
+    for (; !(_SET_CharClass[(uint8_t)*Pos] & _SET_CHARCLASS_STRING); ++Pos)
+        ;
+
+    return Pos;
+#endif
+}
+
+#ifdef __SSE2__
+_SET_SCANATTRIBUTES static inline void _SET_ReadBlock(SET_ScanBlock *Block, const char *Start)
+{
+    SET_InitScanBlock(Block);
+    Block->start = Start;
+
+    for (uint32_t Chunk = 0; Chunk < _SET_SCANBLOCK / 16; ++Chunk)
+    {
+        __m128i Text = _mm_load_si128((const __m128i *)Start + Chunk);
+
+        // Setting the 0x20 bit turns [ into { and ] into } so each pair only needs one compare
+        __m128i Folded = _mm_or_si128(Text, _mm_set1_epi8(0x20));
+        __m128i Brackets = _mm_or_si128(_mm_cmpeq_epi8(Folded, _mm_set1_epi8('{')), _mm_cmpeq_epi8(Folded, _mm_set1_epi8('}')));
+        __m128i Ends = _mm_or_si128(_mm_cmpeq_epi8(Text, _mm_setzero_si128()), _mm_or_si128(_mm_cmpeq_epi8(Text, _mm_set1_epi8('\"')), _mm_cmpeq_epi8(Text, _mm_set1_epi8('\''))));
+        __m128i Newline = _mm_cmpeq_epi8(Text, _mm_set1_epi8('\n'));
+        __m128i Structural = _mm_or_si128(_mm_or_si128(Ends, Brackets), _mm_or_si128(_mm_cmpeq_epi8(Text, _mm_set1_epi8('/')), _mm_cmpeq_epi8(Text, _mm_set1_epi8(';'))));
+        __m128i String = _mm_or_si128(_mm_or_si128(Ends, Newline), _mm_or_si128(_mm_cmpeq_epi8(Text, _mm_set1_epi8('\\')), _mm_or_si128(_mm_cmpeq_epi8(Text, _mm_set1_epi8('\t')), _mm_cmpeq_epi8(Text, _mm_set1_epi8('\r')))));
+
+        Block->structural |= (uint64_t)(uint16_t)_mm_movemask_epi8(Structural) << (16 * Chunk);
+        Block->string |= (uint64_t)(uint16_t)_mm_movemask_epi8(String) << (16 * Chunk);
+        Block->newline |= (uint64_t)(uint16_t)_mm_movemask_epi8(Newline) << (16 * Chunk);
+    }
+}
+#endif
+
+static inline void *_SET_StreamAlloc(SET_Stream *Stream, size_t Size)
+{
+    if (Stream->arena != NULL)
+        return ARN_Alloc(Stream->arena, Size);
+
+    return malloc(Size);
+}
+
+static inline void _SET_DiscardData(SET_Stream *Stream, SET_Data *Data)
+{
+    if (Stream->arena == NULL)
+        SET_DestroyData(Data);
+}
+
+static inline void _SET_DiscardDataList(SET_Stream *Stream, SET_DataList *List)
+{
+    if (Stream->arena == NULL)
+        SET_DestroyDataList(List);
+}
+
+static inline void _SET_DiscardDataStruct(SET_Stream *Stream, SET_DataStruct *Struct)
+{
+    if (Stream->arena == NULL)
+        SET_DestroyDataStruct(Struct);
+}
+
+static inline void _SET_DiscardValues(SET_Stream *Stream, SET_Data *Values, size_t Count)
+{
+    if (Stream->arena != NULL)
+        return;
+
+    for (SET_Data *List = Values, *EndList = Values + Count; List < EndList; ++List)
+        if (List->type == SET_DATATYPE_STR)
+            free(List->data.str);
+}
+
+void _SET_DestroyStreamFields(SET_Stream *Stream, SET_StreamField *Fields, size_t Count)
+{
+    if (Stream->arena != NULL)
+        return;
+
+    for (SET_StreamField *List = Fields, *EndList = Fields + Count; List < EndList; ++List)
+        if (List->value != NULL)
+            SET_DestroyData(List->value);
+}
+
+bool _SET_ParseName(SET_Stream *Stream, char **Name, SET_DataType *Type, uint8_t *PointerCount)
+{
+    uint32_t Line = Stream->line;
+
+    // Read the first word, it is the name unless it is followed by pointers or another word
+    char *TypeString = NULL;
+    size_t TypeLength = 0;
+    char *NameString = Stream->pos;
+    size_t NameLength = _SET_WordLength(NameString);
+
+    *PointerCount = 0;
+    Stream->pos += NameLength;
+    _SET_SkipBlank(Stream);
+
+    for (; *Stream->pos == '*'; _SET_SkipBlank(Stream))
+    {
+        ++*PointerCount;
+        ++Stream->pos;
+    }
+
+    if (*PointerCount > 0 || _SET_WordLength(Stream->pos) > 0)
+    {
+        TypeString = NameString;
+        TypeLength = NameLength;
+        NameString = Stream->pos;
+        NameLength = _SET_WordLength(NameString);
+        Stream->pos += NameLength;
+        _SET_SkipBlank(Stream);
+    }
+
+    // Find the name-value separator
+    if (*Stream->pos != '=')
+    {
+        if (*Stream->pos == '\0')
+            _SET_SetError(_SET_ERRORID_PARSENAME_END, _SET_ERRORMES_WRONGEND);
+
+        else if (*Stream->pos == ';')
+            _SET_SetError(_SET_ERRORID_PARSENAME_NOVALUE, _SET_ERRORMES_NOVALUE, _SET_LINEPREMES, Line);
+
+        else if (_SET_WordLength(Stream->pos) > 0)
+            _SET_SetError(_SET_ERRORID_PARSENAME_TYPETWICE, _SET_ERRORMES_TYPETWICE, _SET_LINEPREMES, Line);
+
+        else
+            _SET_SetError(_SET_ERRORID_PARSENAME_UNEXPECTED, _SET_ERRORMES_UNEXPECTED, _SET_LINEPREMES, Stream->line, *Stream->pos);
+
+        return false;
+    }
+
+    ++Stream->pos;
+
+    // The characters after the type and name have been read so they can be terminated in place
+    if (TypeString != NULL)
+        TypeString[TypeLength] = '\0';
+
+    NameString[NameLength] = '\0';
+    *Name = NameString;
+
+    // Get the type
+    *Type = SET_DATATYPE_NONE;
+
+    if (TypeString != NULL)
+    {
+        *Type = _SET_ReadType(Stream->types, TypeString);
+
+        if (*Type == SET_DATATYPE_NONE)
+        {
+            _SET_AddError(_SET_ERRORID_PARSENAME_TYPE, _SET_ERRORMES_READTYPE, _SET_LINEPREMES, (size_t)Line);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+SET_DataStruct *_SET_ParseStruct(SET_Stream *Stream, bool Sub)
+{
+    // The fields are collected first so the dict can be created with the correct size
+    SET_StreamField *Fields = NULL;
+    size_t Count = 0;
+
+    if (!_SET_ParseFields(Stream, Sub, &Fields, &Count))
+    {
+        _SET_AddError(_SET_ERRORID_PARSESTRUCT_FIELDS, _SET_ERRORMES_PARSEFIELDS);
+        return NULL;
+    }
+
+    SET_DataStruct *Struct = _SET_CreateStruct(Stream, Fields, Count);
+
+    if (Struct == NULL)
+    {
+        _SET_AddError(_SET_ERRORID_PARSESTRUCT_CREATE, _SET_ERRORMES_CREATESTRUCT);
+        return NULL;
+    }
+
+    return Struct;
+}
+
+bool _SET_ParseFields(SET_Stream *Stream, bool Sub, SET_StreamField **OutFields, size_t *OutCount)
+{
+    SET_StreamField *Fields = NULL;
+    size_t Count = 0;
+    size_t Capacity = 0;
+
+    while (true)
+    {
+        _SET_SkipBlank(Stream);
+
+        // Check for the end
+        if (*Stream->pos == '\0')
+        {
+            if (Sub)
+            {
+                _SET_SetError(_SET_ERRORID_PARSEFIELDS_ENDSTRUCT, _SET_ERRORMES_ENDSTRUCT);
+                _SET_DestroyStreamFields(Stream, Fields, Count);
+                free(Fields);
+                return false;
+            }
+
+            break;
+        }
+
+        if (*Stream->pos == '}')
+        {
+            if (!Sub)
+            {
+                _SET_SetError(_SET_ERRORID_PARSEFIELDS_UNEXPECTED, _SET_ERRORMES_UNEXPECTED, _SET_LINEPREMES, Stream->line, *Stream->pos);
+                _SET_DestroyStreamFields(Stream, Fields, Count);
+                free(Fields);
+                return false;
+            }
+
+            ++Stream->pos;
+            break;
+        }
+
+        uint32_t Line = Stream->line;
+
+        // Read the type and name
+        char *NameString;
+        SET_DataType Type;
+        uint8_t PointerCount;
+
+        if (!_SET_ParseName(Stream, &NameString, &Type, &PointerCount))
+        {
+            _SET_AddError(_SET_ERRORID_PARSEFIELDS_NAME, _SET_ERRORMES_PARSENAME, _SET_LINEPREMES, (size_t)Line);
+            _SET_DestroyStreamFields(Stream, Fields, Count);
+            free(Fields);
+            return false;
+        }
+
+        // Get memory for the field
+        if (Count == Capacity)
+        {
+            size_t NewCapacity = ((Capacity == 0) ? (_SET_STREAMSIZE) : (Capacity * 2));
+            SET_StreamField *NewFields = (SET_StreamField *)realloc(Fields, sizeof(SET_StreamField) * NewCapacity);
+
+            if (NewFields == NULL)
+            {
+                _SET_AddErrorForeign(_SET_ERRORID_PARSEFIELDS_REALLOC, strerror(errno), _SET_ERRORMES_REALLOC, sizeof(SET_StreamField) * NewCapacity);
+                _SET_DestroyStreamFields(Stream, Fields, Count);
+                free(Fields);
+                return false;
+            }
+
+            Fields = NewFields;
+            Capacity = NewCapacity;
+        }
+
+        SET_StreamField *Field = Fields + Count;
+        SET_InitStreamField(Field);
+        Field->name = NameString;
+        Field->line = Line;
+
+        // Read the value
+        Field->value = _SET_ParseValue(Stream, Type, PointerCount);
+
+        if (Field->value == NULL)
+        {
+            _SET_AddError(_SET_ERRORID_PARSEFIELDS_VALUE, _SET_ERRORMES_READVALUE, _SET_LINEPREMES, (size_t)Line);
+            _SET_DestroyStreamFields(Stream, Fields, Count);
+            free(Fields);
+            return false;
+        }
+
+        ++Count;
+
+        // Find the end of the line
+        _SET_SkipBlank(Stream);
+
+        if (*Stream->pos != ';')
+        {
+            if (*Stream->pos == '\0')
+                _SET_SetError(_SET_ERRORID_PARSEFIELDS_END, _SET_ERRORMES_WRONGEND);
+
+            else
+                _SET_SetError(_SET_ERRORID_PARSEFIELDS_ENDVALUE, _SET_ERRORMES_ENDVALUE, ';', _SET_LINEPREMES, Stream->line, *Stream->pos);
+
+            _SET_DestroyStreamFields(Stream, Fields, Count);
+            free(Fields);
+            return false;
+        }
+
+        ++Stream->pos;
+    }
+
+
+    *OutFields = Fields;
+    *OutCount = Count;
+    return true;
+}
+
+SET_DataStruct *_SET_CreateStruct(SET_Stream *Stream, SET_StreamField *Fields, size_t Count)
+{
+    // Create the dictionary
+    DIC_Dict *Dict;
+
+    if (Stream->arena != NULL)
+        Dict = DIC_CreateArenaDict(Count, Stream->arena);
+
+    else
+        Dict = DIC_CreateDict(Count);
+
+    if (Dict == NULL)
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_CREATESTRUCT_CREATEDICT, DIC_GetError(), _SET_ERRORMES_CREATEDICT);
+        _SET_DestroyStreamFields(Stream, Fields, Count);
+        free(Fields);
+        return NULL;
+    }
+
+    // Optional fields are looked up without being there, let the bloom filter answer those
+    if (!DIC_AddBloomFilter(Dict, Count))
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_CREATESTRUCT_BLOOM, DIC_GetError(), _SET_ERRORMES_BLOOM);
+        _SET_DiscardDataStruct(Stream, Dict);
+        _SET_DestroyStreamFields(Stream, Fields, Count);
+        free(Fields);
+        return NULL;
+    }
+
+    // The names already point into the text
+    if (Stream->view)
+        DIC_BorrowKeys(Dict);
+
+    // The same field names are used in every element of a list of structs, so they are only stored once
+    // The intern pool is shared by all threads, structs read by a worker thread are interned once the workers have finished
+    else if (!Stream->parallel && !DIC_InternKeys(Dict))
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_CREATESTRUCT_INTERN, DIC_GetError(), _SET_ERRORMES_INTERN);
+        _SET_DiscardDataStruct(Stream, Dict);
+        _SET_DestroyStreamFields(Stream, Fields, Count);
+        free(Fields);
+        return NULL;
+    }
+
+    // Add the fields, the dict owns the values once they have been added
+    for (SET_StreamField *List = Fields, *EndList = Fields + Count; List < EndList; ++List)
+    {
+        // Test if the item is already there
+        if (DIC_CheckItem(Dict, List->name))
+        {
+            _SET_SetError(_SET_ERRORID_CREATESTRUCT_DUBLICATE, _SET_ERRORMES_DUBLICATE, _SET_LINEPREMES, (size_t)List->line);
+            _SET_DiscardDataStruct(Stream, Dict);
+            _SET_DestroyStreamFields(Stream, List, EndList - List);
+            free(Fields);
+            return NULL;
+        }
+
+        if (!DIC_AddItem(Dict, List->name, (void *)List->value, 0, DIC_MODE_POINTER))
+        {
+            _SET_AddErrorForeign(_SET_ERRORID_CREATESTRUCT_ADDITEM, DIC_GetError(), _SET_ERRORMES_DICTADD, List->name);
+            _SET_DiscardDataStruct(Stream, Dict);
+            _SET_DestroyStreamFields(Stream, List, EndList - List);
+            free(Fields);
+            return NULL;
+        }
+    }
+
+    free(Fields);
+    return Dict;
+}
+
+SET_Data *_SET_ParseValue(SET_Stream *Stream, SET_DataType Type, uint8_t Depth)
+{
+    _SET_SkipBlank(Stream);
+
+    // Allocate memory
+    SET_Data *Data = (SET_Data *)_SET_StreamAlloc(Stream, sizeof(SET_Data));
+
+    if (Data == NULL)
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_PARSEVALUE_MALLOC, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(SET_Data));
+        return NULL;
+    }
+
+    SET_InitData(Data);
+
+    switch (*Stream->pos)
+    {
+        // Lists
+        case ('['):
+            // Make sure it is supposed to be a list
+            if (Type != SET_DATATYPE_NONE && Depth == 0)
+            {
+                _SET_SetError(_SET_ERRORID_PARSEVALUE_LISTMATCH, _SET_ERRORMES_LISTMATCH, Type);
+                _SET_DiscardData(Stream, Data);
+                return NULL;
+            }
+
+            ++Stream->pos;
+            Data->data.list = _SET_ParseList(Stream, Type, Depth - 1);
+
+            if (Data->data.list == NULL)
+            {
+                _SET_AddError(_SET_ERRORID_PARSEVALUE_LIST, _SET_ERRORMES_CONVERTLIST);
+                _SET_DiscardData(Stream, Data);
+                return NULL;
+            }
+
+            Data->type = SET_DATATYPE_LIST;
+            break;
+
+        // Structs
+        case ('{'):
+            ++Stream->pos;
+            Data->data.stct = _SET_ParseStruct(Stream, true);
+
+            if (Data->data.stct == NULL)
+            {
+                _SET_AddError(_SET_ERRORID_PARSEVALUE_STRUCT, _SET_ERRORMES_CONVERTSTRUCT);
+                _SET_DiscardData(Stream, Data);
+                return NULL;
+            }
+
+            Data->type = SET_DATATYPE_STRUCT;
+            break;
+
+        // Everything else is a single value
+        default:
+            if (!_SET_ParseScalar(Stream, Data))
+            {
+                _SET_AddError(_SET_ERRORID_PARSEVALUE_CONVERT, _SET_ERRORMES_CONVERTVALUE);
+                _SET_DiscardData(Stream, Data);
+                return NULL;
+            }
+
+            break;
+    }
+
+    // Make sure it is a list if needed
+    if (Type != SET_DATATYPE_NONE && Depth > 0 && Data->type != SET_DATATYPE_LIST)
+    {
+        _SET_SetError(_SET_ERRORID_PARSEVALUE_LISTMATCH2, _SET_ERRORMES_LISTMATCH2, Data->type);
+        _SET_DiscardData(Stream, Data);
+        return NULL;
+    }
+
+    // Make sure the type is correct
+    if (Type != SET_DATATYPE_NONE && Data->type != SET_DATATYPE_LIST && !_SET_MatchType(Data, Type))
+    {
+        _SET_AddError(_SET_ERRORID_PARSEVALUE_TYPEMATCH, _SET_ERRORMES_MATCHTYPE, Type);
+        _SET_DiscardData(Stream, Data);
+        return NULL;
+    }
+
+    return Data;
+}
+
+SET_DataList *_SET_ParseList(SET_Stream *Stream, SET_DataType Type, uint8_t Depth)
+{
+    // Allocate memory
+    SET_DataList *ListObject = (SET_DataList *)_SET_StreamAlloc(Stream, sizeof(SET_DataList));
+
+    if (ListObject == NULL)
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_PARSELIST_MALLOC, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(SET_DataList));
+        return NULL;
+    }
+
+    SET_InitDataList(ListObject);
+
+    _SET_SkipBlank(Stream);
+
+    if (*Stream->pos == ']')
+    {
+        _SET_SetError(_SET_ERRORID_PARSELIST_NOELEMENTS, _SET_ERRORMES_NOELEMENTS);
+        _SET_DiscardDataList(Stream, ListObject);
+        return NULL;
+    }
+
+    // Lists of single values do not need a value for each element
+    if (*Stream->pos != '[' && *Stream->pos != '{')
+    {
+        if (!_SET_ParseScalarList(Stream, ListObject, Type, Depth))
+        {
+            _SET_AddError(_SET_ERRORID_PARSELIST_SCALAR, _SET_ERRORMES_CONVERTLIST);
+            _SET_DiscardDataList(Stream, ListObject);
+            return NULL;
+        }
+
+        return ListObject;
+    }
+
+    // Read the elements
+    size_t Capacity = 0;
+
+    while (true)
+    {
+        // Get memory for the element
+        if (ListObject->count == Capacity)
+        {
+            size_t NewCapacity = ((Capacity == 0) ? (_SET_STREAMSIZE) : (Capacity * 2));
+            SET_Data **NewList;
+
+            // Arenas cannot grow memory, so the elements are moved to a new list and the old one is left behind
+            if (Stream->arena != NULL)
+            {
+                NewList = (SET_Data **)ARN_Alloc(Stream->arena, sizeof(SET_Data *) * NewCapacity);
+
+                if (NewList != NULL && ListObject->count > 0)
+                    memcpy(NewList, ListObject->list, sizeof(SET_Data *) * ListObject->count);
+            }
+
+            else
+                NewList = (SET_Data **)realloc(ListObject->list, sizeof(SET_Data *) * NewCapacity);
+
+            if (NewList == NULL)
+            {
+                _SET_AddErrorForeign(_SET_ERRORID_PARSELIST_REALLOC, strerror(errno), _SET_ERRORMES_REALLOC, sizeof(SET_Data *) * NewCapacity);
+                _SET_DiscardDataList(Stream, ListObject);
+                return NULL;
+            }
+
+            ListObject->list = NewList;
+            Capacity = NewCapacity;
+        }
+
+        // Read the element
+        SET_Data *Element = _SET_ParseValue(Stream, Type, Depth);
+
+        if (Element == NULL)
+        {
+            _SET_AddError(_SET_ERRORID_PARSELIST_VALUE, _SET_ERRORMES_READVALUE, _SET_ELEMENTPREMES, (size_t)ListObject->count);
+            _SET_DiscardDataList(Stream, ListObject);
+            return NULL;
+        }
+
+        ListObject->list[ListObject->count++] = Element;
+
+        // Find the separator
+        _SET_SkipBlank(Stream);
+
+        if (*Stream->pos == ',')
+        {
+            ++Stream->pos;
+            continue;
+        }
+
+        if (*Stream->pos == ']')
+        {
+            ++Stream->pos;
+            break;
+        }
+
+        if (*Stream->pos == '\0')
+            _SET_SetError(_SET_ERRORID_PARSELIST_ENDLIST, _SET_ERRORMES_ENDLIST);
+
+        else
+            _SET_SetError(_SET_ERRORID_PARSELIST_UNEXPECTED, _SET_ERRORMES_ENDVALUE, ',', _SET_ELEMENTPREMES, ListObject->count - 1, *Stream->pos);
+
+        _SET_DiscardDataList(Stream, ListObject);
+        return NULL;
+    }
+
+    // Find the common type
+    if (!_SET_FinishList(ListObject))
+    {
+        _SET_AddError(_SET_ERRORID_PARSELIST_FINISH, _SET_ERRORMES_COMMONTYPE);
+        _SET_DiscardDataList(Stream, ListObject);
+        return NULL;
+    }
+
+    return ListObject;
+}
+
+bool _SET_ParseScalarList(SET_Stream *Stream, SET_DataList *List, SET_DataType Type, uint8_t Depth)
+{
+    extern _Atomic bool _SET_PackLists;
+
+    // Read all of the values into one block
+    SET_Data *Values = NULL;
+    uint32_t Count = 0;
+    size_t Capacity = 0;
+    SET_DataType CommonType = SET_DATATYPE_NONE;
+
+    while (true)
+    {
+        // Get memory for the element
+        if (Count == Capacity)
+        {
+            size_t NewCapacity = ((Capacity == 0) ? (_SET_STREAMSIZE) : (Capacity * 2));
+            SET_Data *NewValues = (SET_Data *)realloc(Values, sizeof(SET_Data) * NewCapacity);
+
+            if (NewValues == NULL)
+            {
+                _SET_AddErrorForeign(_SET_ERRORID_PARSESCALARLIST_REALLOC, strerror(errno), _SET_ERRORMES_REALLOC, sizeof(SET_Data) * NewCapacity);
+                _SET_DiscardValues(Stream, Values, Count);
+                free(Values);
+                return false;
+            }
+
+            Values = NewValues;
+            Capacity = NewCapacity;
+        }
+
+        // All elements must be single values
+        _SET_SkipBlank(Stream);
+
+        if (*Stream->pos == '[' || *Stream->pos == '{')
+        {
+            if (*Stream->pos == '[')
+                _SET_SetError(_SET_ERRORID_PARSESCALARLIST_LISTELEMENT, _SET_ERRORMES_LISTELEMENT, _SET_ELEMENTPREMES, (size_t)Count);
+
+            else
+                _SET_SetError(_SET_ERRORID_PARSESCALARLIST_TYPEELEMENT, _SET_ERRORMES_TYPEELEMENT, _SET_ELEMENTPREMES, (size_t)Count);
+
+            _SET_DiscardValues(Stream, Values, Count);
+            free(Values);
+            return false;
+        }
+
+        // Read the element
+        SET_Data *Value = Values + Count;
+        SET_InitData(Value);
+
+        if (!_SET_ParseScalar(Stream, Value))
+        {
+            _SET_AddError(_SET_ERRORID_PARSESCALARLIST_VALUE, _SET_ERRORMES_READVALUE, _SET_ELEMENTPREMES, (size_t)Count);
+            _SET_DiscardValues(Stream, Values, Count);
+            free(Values);
+            return false;
+        }
+
+        ++Count;
+
+        // Make sure it has the declared type
+        if (Type != SET_DATATYPE_NONE && Depth > 0)
+        {
+            _SET_SetError(_SET_ERRORID_PARSESCALARLIST_LISTMATCH, _SET_ERRORMES_LISTMATCH2, Value->type);
+            _SET_DiscardValues(Stream, Values, Count);
+            free(Values);
+            return false;
+        }
+
+        if (Type != SET_DATATYPE_NONE && !_SET_MatchType(Value, Type))
+        {
+            _SET_AddError(_SET_ERRORID_PARSESCALARLIST_TYPEMATCH, _SET_ERRORMES_MATCHTYPE, Type);
+            _SET_DiscardValues(Stream, Values, Count);
+            free(Values);
+            return false;
+        }
+
+        // Find the common type
+        if (Count == 1)
+            CommonType = Value->type;
+
+        else if (!_SET_MergeType(&CommonType, Value->type, Count - 1))
+        {
+            _SET_AddError(_SET_ERRORID_PARSESCALARLIST_MERGE, _SET_ERRORMES_COMMONTYPE);
+            _SET_DiscardValues(Stream, Values, Count);
+            free(Values);
+            return false;
+        }
+
+        // Find the separator
+        _SET_SkipBlank(Stream);
+
+        if (*Stream->pos == ',')
+        {
+            ++Stream->pos;
+            continue;
+        }
+
+        if (*Stream->pos == ']')
+        {
+            ++Stream->pos;
+            break;
+        }
+
+        if (*Stream->pos == '\0')
+            _SET_SetError(_SET_ERRORID_PARSESCALARLIST_ENDLIST, _SET_ERRORMES_ENDLIST);
+
+        else
+            _SET_SetError(_SET_ERRORID_PARSESCALARLIST_UNEXPECTED, _SET_ERRORMES_ENDVALUE, ',', _SET_ELEMENTPREMES, Count - 1, *Stream->pos);
+
+        _SET_DiscardValues(Stream, Values, Count);
+        free(Values);
+        return false;
+    }
+
+    List->count = Count;
+    List->type = CommonType;
+    List->depth = 1;
+
+    // Convert the elements to the same type
+    size_t Size = _SET_TypeSize(CommonType);
+
+    if (CommonType != SET_DATATYPE_STR && Size > 0)
+        for (SET_Data *ValueList = Values, *EndValueList = Values + Count; ValueList < EndValueList; ++ValueList)
+        {
+            if (ValueList->type == CommonType)
+                continue;
+
+            *ValueList = _SET_ConvertType(ValueList, CommonType);
+
+            if (ValueList->type == SET_DATATYPE_NONE)
+            {
+                _SET_AddError(_SET_ERRORID_PARSESCALARLIST_CONVERT, _SET_ERRORMES_CONVERTVALUE);
+                free(Values);
+                return false;
+            }
+        }
+
+    // Numbers, bools and chars are packed as their C type if SET_PackLists is on
+    if (CommonType != SET_DATATYPE_STR && Size > 0 && atomic_load(&_SET_PackLists))
+    {
+        uint8_t *Packed = (uint8_t *)_SET_StreamAlloc(Stream, Size * Count);
+
+        if (Packed == NULL)
+        {
+            _SET_AddErrorForeign(_SET_ERRORID_PARSESCALARLIST_MALLOC, strerror(errno), _SET_ERRORMES_MALLOC, Size * Count);
+            free(Values);
+            return false;
+        }
+
+        uint8_t *PackedList = Packed;
+
+        for (SET_Data *ValueList = Values, *EndValueList = Values + Count; ValueList < EndValueList; ++ValueList, PackedList += Size)
+            memcpy(PackedList, &ValueList->data, Size);
+
+        List->packed = Packed;
+        free(Values);
+        return true;
+    }
+
+    // Everything else gets a value for each element
+    List->list = (SET_Data **)_SET_StreamAlloc(Stream, sizeof(SET_Data *) * Count);
+
+    if (List->list == NULL)
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_PARSESCALARLIST_MALLOC2, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(SET_Data *) * Count);
+        _SET_DiscardValues(Stream, Values, Count);
+        free(Values);
+        return false;
+    }
+
+    for (uint32_t Pos = 0; Pos < Count; ++Pos)
+    {
+        List->list[Pos] = (SET_Data *)_SET_StreamAlloc(Stream, sizeof(SET_Data));
+
+        if (List->list[Pos] == NULL)
+        {
+            _SET_AddErrorForeign(_SET_ERRORID_PARSESCALARLIST_MALLOC2, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(SET_Data));
+            _SET_DiscardValues(Stream, Values + Pos, Count - Pos);
+            List->count = Pos;
+            free(Values);
+            return false;
+        }
+
+        *List->list[Pos] = Values[Pos];
+    }
+
+    free(Values);
+    return true;
+}
+
+bool _SET_ParseScalar(SET_Stream *Stream, SET_Data *Data)
+{
+    char *Start = Stream->pos;
+    char *End;
+
+    // Strings and chars, newlines and tabs inside them are removed by moving the rest back
+    if (*Start == '\"' || *Start == '\'')
+    {
+        char *Dst = Start + 1;
+        char *Src = Start + 1;
+        bool Special = false;
+        SET_ScanBlock Block;
+        SET_InitScanBlock(&Block);
+
+        while (true)
+        {
+            // Move everything up to the next character which needs care
+            char *Next = _SET_ScanString(&Block, Src);
+
+            if (Dst != Src)
+                memmove(Dst, Src, sizeof(char) * (Next - Src));
+
+            Dst += Next - Src;
+            Src = Next;
+
+            if (*Src == *Start)
+                break;
+
+            if (*Src == '\0')
+            {
+                if (*Start == '\"')
+                    _SET_SetError(_SET_ERRORID_PARSESCALAR_ENDSTRING, _SET_ERRORMES_ENDSTRING, _SET_LINEPREMES, Stream->line);
+
+                else
+                    _SET_SetError(_SET_ERRORID_PARSESCALAR_STOPCHAR, _SET_ERRORMES_EARLYSTOPCHAR, _SET_LINEPREMES, Stream->line);
+
+                return false;
+            }
+
+            if (*Src == '\n')
+            {
+                ++Stream->line;
+                ++Src;
+                continue;
+            }
+
+            if (*Src == '\t' || *Src == '\r')
+            {
+                ++Src;
+                continue;
+            }
+
+            // Keep special characters together
+            if (*Src == '\\' && *(Src + 1) != '\0')
+            {
+                Special = true;
+                *Dst++ = *Src++;
+            }
+
+            *Dst++ = *Src++;
+        }
+
+        Stream->pos = Src + 1;
+
+        // Strings which are the same after conversion are terminated in place of the end quote and used directly
+        if (Stream->view && *Start == '\"' && !Special)
+        {
+            *Dst = '\0';
+            Data->data.str = Start + 1;
+            Data->type = SET_DATATYPE_STR;
+            return true;
+        }
+
+        *Dst++ = *Start;
+        End = Dst;
+    }
+
+    // Everything else is a single word
+    else
+    {
+        Stream->pos += _SET_WordLength(Start);
+        End = Stream->pos;
+
+        if (End == Start)
+        {
+            _SET_SetError(_SET_ERRORID_PARSESCALAR_NOVALUE, _SET_ERRORMES_NOVALUE, _SET_LINEPREMES, Stream->line);
+            return false;
+        }
+    }
+
+    // Convert the value, the character after it may not have been read yet so it is restored afterwards
+    char EndChar = *End;
+    *End = '\0';
+    bool Converted = _SET_ConvertScalar(Data, Start, Stream->arena);
+    *End = EndChar;
+
+    if (!Converted)
+    {
+        _SET_AddError(_SET_ERRORID_PARSESCALAR_CONVERT, _SET_ERRORMES_CONVERTVALUE);
+        return false;
+    }
+
+    return true;
+}
+
+char *_SET_CleanString(const char *String)
+{
+    extern const uint8_t _SET_CharClass[];
+
+    size_t Size = strlen(String) + 1;
+    char *NewString = (char *)malloc(sizeof(char) * Size);
+
+    if (NewString == NULL)
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_CLEANSTRING_MALLOC, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(char) * Size);
+        return NULL;
+    }
+
+    // Go through string
+    bool InString = false;
+    bool InChar = false;
+    bool StringSpecial = false;
+    bool Leading = true;
+    char *DstString = NewString;
+    bool LineComment = false;
+    bool MultilineComment = false;
+
+    for (const char *Current = String; *Current != '\0'; ++Current)
+    {
+        // Skip if in line comment
+        if (LineComment)
+        {
+            // Test if it should stop
+            if (LineComment && *Current == '\n')
+                LineComment = false;
+
+            continue;
+        }
+
+        // Skip if in multiline comment
+        if (MultilineComment)
+        {
+            // Test if it should stop
+            if (*Current == '*' && *(Current + 1) == '/')
+            {
+                MultilineComment = false;
+                ++Current;
+            }
+
+            continue;
+        }
+
+        // Skip if it is a newline or tab
+        if (*Current == '\n' || *Current == '\t')
+            continue;
+
+        // Do stuff outside of strings
+        if (!InString && !InChar)
+        {
+            // Start comments
+            if (*Current == '/')
+            {
+                if (*(Current + 1) == '/')
+                {
+                    LineComment = true;
+                    ++Current;
+                    continue;
+                }
+
+                if (*(Current + 1) == '*')
+                {
+                    MultilineComment = true;
+                    ++Current;
+                    continue;
+                }
+            }
+
+            // Remove leading spaces
+            if (Leading)
+            {
+                if (*Current == ' ')
+                    continue;
+
+                else
+                    Leading = false;
+            }
+
+            // Start a string
+            if (*Current == '\"')
+                InString = true;
+
+            // Start char
+            if (*Current == '\'')
+                InChar = true;
+
+            // Find space ignoring characters
+            if (_SET_CharClass[(uint8_t)*Current] & _SET_CHARCLASS_SPECIAL)
+            {
+                Leading = true;
+
+                // Remove trailing spaces
+                while (DstString > NewString && *(DstString - 1) == ' ')
+                    DstString -= 1;
+            }
+        }
+
+        // Do stuff in strings
+        else if (!StringSpecial)
+        {
+            // Start a special character
+            if (*Current == '\\')
+                StringSpecial = true;
+
+            // End the string
+            if (*Current == '\"')
+                InString = false;
+
+            // End the char
+            if (*Current == '\'')
+                InChar = false;
+        }
+
+        // End special character
+        else
+            StringSpecial = false;
+
+        // Add character to new string
+        *DstString++ = *Current;
+    }
+
+    *DstString++ = '\0';
+
+    // Shorten string
+    Size = DstString - NewString;
+    NewString = (char *)realloc(NewString, sizeof(char) * Size);
+
+    if (NewString == NULL)
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_CLEANSTRING_REALLOC, strerror(errno), _SET_ERRORMES_REALLOC, Size);
+        return NULL;
+    }
+
+    return NewString;
+}
+
+SET_CodeStruct *_SET_SplitString(char *String)
+{
+    // Get memory for the struct
+    SET_CodeStruct *CodeStruct = (SET_CodeStruct *)malloc(sizeof(SET_CodeStruct));
+
+    if (CodeStruct == NULL)
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_SPLITSTRING_MALLOCSTRUCT, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(SET_CodeStruct));
+        return NULL;
+    }
+
+    SET_InitCodeStruct(CodeStruct);
+
+    if (String[0] == '\0')
+        return CodeStruct;
+
+    // Go through the string and split it
+    char *TypeString = NULL;
+    char *NameString = NULL;
+    char *Current = String;
+    int32_t ListCount = 0;
+    int32_t StructCount = 0;
+    uint8_t PointerCount = 0;
+    bool InString = false;
+    bool FoundType = false;
+    bool AfterEqual = false;
+
+    for (char *LastStart = String; *Current != '\0'; ++Current)
+    {
+        // Start or end a string
+        if (*Current == '\"')
+            InString = !InString;
+
+        if (InString)
+        {
+            // Do special character
+            if (*Current == '\\' && *(Current + 1) != '\0')
+                ++Current;
+
+            continue;
+        }
+
+        // Skip a char
+        if (*Current == '\'')
+        {
+            uint32_t WithSpecial = 0;
+
+            // With special character
+            if (*(Current + 1) == '\\')
+                WithSpecial = 1;
+
+            // Test if it stops
+            if (*(Current + WithSpecial + 1) == '\0')
+            {
+                _SET_SetError(_SET_ERRORID_SPLITSTRING_STOPCHAR, _SET_ERRORMES_EARLYSTOPCHAR, _SET_LINEPREMES, CodeStruct->count + 1);
+                SET_DestroyCodeStruct(CodeStruct);
+                return NULL;
+            }
+
+            // Make sure it ends
+            if (*(Current + WithSpecial + 2) != '\'')
+            {
+                _SET_SetError(_SET_ERRORID_SPLITSTRING_NOSTOPCHAR, _SET_ERRORMES_NOSTOPCHAR, _SET_LINEPREMES, CodeStruct->count + 1);
+                SET_DestroyCodeStruct(CodeStruct);
+                return NULL;
+            }
+
+            // Skip till the end
+            Current += 2 + WithSpecial;
+            continue;
+        }
+
+        // Start or end list and structs
+        if (*Current == '[')
+            ++ListCount;
+
+        else if (*Current == ']')
+            --ListCount;
+
+        else if (*Current == '{')
+            ++StructCount;
+
+        else if (*Current == '}')
+            --StructCount;
+
+        // Do the rest
+        else if (ListCount == 0 && StructCount == 0)
+        {
+            // Look for type-name separator
+            if (*Current == ' ' || (!AfterEqual && *Current == '*'))
+            {
+                // if there is an error
+                if (AfterEqual)
+                {
+                    _SET_SetError(_SET_ERRORID_SPLITSTRING_SPACEINVALUE, _SET_ERRORMES_SPACEINVALUE, _SET_LINEPREMES, CodeStruct->count + 1);
+                    SET_DestroyCodeStruct(CodeStruct);
+                    return NULL;
+                }
+
+                if (FoundType)
+                {
+                    _SET_SetError(_SET_ERRORID_SPLITSTRING_TYPETWICE, _SET_ERRORMES_TYPETWICE, _SET_LINEPREMES, CodeStruct->count + 1);
+                    SET_DestroyCodeStruct(CodeStruct);
+                    return NULL;
+                }
+
+                // Count the pointer depth
+                if (*Current == '*')
+                {
+                    PointerCount = 1;
+                    *Current = '\0';
+
+                    while (*(Current + 1) == '*')
+                    {
+                        ++PointerCount;
+                        ++Current;
+                    }
+                }     
+
+                // Add the type
+                TypeString = LastStart;
+                LastStart = Current + 1;
+                *Current = '\0';
+                FoundType = true;
+                continue;
+            }
+
+            // Look for name-value separator
+            if (*Current == '=')
+            {
+                // If there is an error
+                if (AfterEqual)
+                {
+                    _SET_SetError(_SET_ERRORID_SPLITSTRING_VALUETWICE, _SET_ERRORMES_VALUETWICE, _SET_LINEPREMES, CodeStruct->count + 1);
+                    SET_DestroyCodeStruct(CodeStruct);
+                    return NULL;
+                }
+
+                // Add name
+                NameString = LastStart;
+                LastStart = Current + 1;
+                *Current = '\0';
+                AfterEqual = true;
+                continue;
+            }
+
+            // Look for line stop
+            if (*Current == ';')
+            {
+                // If there is an error
+                if (!AfterEqual)
+                {
+                    _SET_SetError(_SET_ERRORID_SPLITSTRING_NOVALUE, _SET_ERRORMES_NOVALUE, _SET_LINEPREMES, CodeStruct->count + 1);
+                    SET_DestroyCodeStruct(CodeStruct);
+                    return NULL;
+                }
+
+                // Allocate memory for new line
+                SET_CodeName **NewNames = (SET_CodeName **)realloc(CodeStruct->names, sizeof(SET_CodeName *) * (CodeStruct->count + 1));
+
+                if (NewNames == NULL)
+                {
+                    _SET_SetError(_SET_ERRORID_SPLITSTRING_REALLOC, _SET_ERRORMES_REALLOC, sizeof(SET_CodeName *) * (CodeStruct->count + 1));
+                    SET_DestroyCodeStruct(CodeStruct);
+                    return NULL;
+                }
+
+                CodeStruct->names = NewNames;
+
+                CodeStruct->names[CodeStruct->count] = (SET_CodeName *)malloc(sizeof(SET_CodeName));
+
+                if (CodeStruct->names[CodeStruct->count] == NULL)
+                {
+                    _SET_SetError(_SET_ERRORID_SPLITSTRING_MALLOC, _SET_ERRORMES_MALLOC, sizeof(SET_CodeName));
+                    SET_DestroyCodeStruct(CodeStruct);
+                    return NULL;
+                }
+
+                SET_InitCodeName(CodeStruct->names[CodeStruct->count]);
+
+                SET_CodeValue **NewValues = (SET_CodeValue **)realloc(CodeStruct->values, sizeof(SET_CodeValue *) * (CodeStruct->count + 1));
+
+                if (NewValues == NULL)
+                {
+                    _SET_SetError(_SET_ERRORID_SPLITSTRING_REALLOC2, _SET_ERRORMES_REALLOC, sizeof(SET_CodeValue *) * (CodeStruct->count + 1));
+                    SET_DestroyCodeStruct(CodeStruct);
+                    return NULL;
+                }
+
+                CodeStruct->values = NewValues;
+
+                CodeStruct->values[CodeStruct->count] = (SET_CodeValue *)malloc(sizeof(SET_CodeValue));
+
+                if (CodeStruct->values[CodeStruct->count] == NULL)
+                {
+                    _SET_SetError(_SET_ERRORID_SPLITSTRING_MALLOC2, _SET_ERRORMES_MALLOC, sizeof(SET_CodeValue));
+                    SET_DestroyCodeStruct(CodeStruct);
+                    return NULL;
+                }
+
+                SET_InitCodeValue(CodeStruct->values[CodeStruct->count]);
+
+                // Add the new line
+                NewValues[CodeStruct->count]->type = SET_VALUETYPE_VALUE;
+                NewValues[CodeStruct->count]->value.value = LastStart;
+                NewNames[CodeStruct->count]->type = TypeString;
+                NewNames[CodeStruct->count]->pointer = PointerCount;
+                NewNames[CodeStruct->count++]->name = NameString;
+
+                // Update the string
+                LastStart = Current + 1;
+                *Current = '\0';
+                AfterEqual = false;
+                FoundType = false;
+                TypeString = NULL;
+                NameString = NULL;
+                PointerCount = 0;
+                continue;
+            }
+        }
+    }
+
+    // Make sure it is not inside of a string
+    if (InString)
+    {
+        _SET_SetError(_SET_ERRORID_SPLITSTRING_ENDSTRING, _SET_ERRORMES_ENDSTRING, _SET_LINEPREMES, CodeStruct->count + 1);
+        SET_DestroyCodeStruct(CodeStruct);
+        return NULL;
+    }
+
+    // Make sure it ended with a line end
+    if (*(Current - 1) != '\0' || FoundType || AfterEqual)
+    {
+        _SET_SetError(_SET_ERRORID_SPLITSTRING_END, _SET_ERRORMES_WRONGEND);
+        SET_DestroyCodeStruct(CodeStruct);
+        return NULL;
+    }
+
+    // Convert values into structs and lists
+    for (SET_CodeValue **List = CodeStruct->values, **EndList = CodeStruct->values + CodeStruct->count; List < EndList; ++List)
+        // Split the value
+        if (!_SET_SplitValue(*List))
+        {
+            _SET_AddError(_SET_ERRORID_SPLITSTRING_SPLITVALUE, _SET_ERRORMES_SPLITVALUE, _SET_LINEPREMES, CodeStruct->count + 1);
+            SET_DestroyCodeStruct(CodeStruct);
+            return NULL;
+        }
+
+    // Return the struct
+    return CodeStruct;
+}
+
+bool _SET_SplitValue(SET_CodeValue *Value)
+{
+    if (Value->value.value[0] == '\0')
+    {
+        _SET_SetError(_SET_ERRORID_SPLITVALUE_NOVALUE, _SET_ERRORMES_NOVALUE2);
+        return false;
+    }
+
+    // Check for a structs
+    if (*Value->value.value == '{')
+    {
+        // Make sure it ends with }
+        size_t Length = strlen(Value->value.value);
+
+        if (Value->value.value[Length - 1] != '}')
+        {
+            _SET_SetError(_SET_ERRORID_SPLITVALUE_ENDSTRUCT, _SET_ERRORMES_ENDSTRUCT);
+            return false;
+        }
+
+        // Split the struct
+        Value->value.value[Length - 1] = '\0';
+        SET_CodeStruct *StructValue = _SET_SplitString(Value->value.value + 1);
+
+        if (StructValue == NULL)
+        {
+            _SET_AddError(_SET_ERRORID_SPLITVALUE_CREATESUBSTRUCT, _SET_ERRORMES_SUBSTRUCT);
+            return false;
+        }
+
+        // Update the value
+        Value->type = SET_VALUETYPE_STRUCT;
+        Value->value.sub = StructValue;
+    }
+
+    // Check for a list
+    else if (*Value->value.value == '[')
+    {
+        // Make sure it ends with ]
+        size_t Length = strlen(Value->value.value);
+
+        if (Value->value.value[Length - 1] != ']')
+        {
+            _SET_SetError(_SET_ERRORID_SPLITVALUE_ENDLIST, _SET_ERRORMES_ENDLIST);
+            return false;
+        }
+
+        // Split the list
+        Value->value.value[Length - 1] = '\0';
+        SET_CodeList *ListValues = _SET_SplitList(Value->value.value + 1);
+
+        if (ListValues == NULL)
+        {
+            _SET_AddError(_SET_ERRORID_SPLITVALUE_CREATELIST, _SET_ERRORMES_SUBLIST);
+            return false;
+        }
+
+        // Update the value
+        Value->type = SET_VALUETYPE_LIST;
+        Value->value.list = ListValues;
+    }
+
+    return true;
+}
+
+SET_CodeList *_SET_SplitList(char *String)
+{
+    // Get memory for the struct
+    SET_CodeList *CodeList = (SET_CodeList *)malloc(sizeof(SET_CodeList));
+
+    if (CodeList == NULL)
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_SPLITLIST_MALLOCSTRUCT, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(SET_CodeList));
+        return NULL;
+    }
+
+    SET_InitCodeList(CodeList);
+
+    if (String[0] == '\0')
+        return CodeList;
+
+    // Get first memory for list
+    CodeList->list = (SET_CodeValue **)malloc(sizeof(SET_CodeValue *));
+
+    if (CodeList->list == NULL)
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_SPLITLIST_MALLOCLIST, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(SET_CodeValue *));
+        SET_DestroyCodeList(CodeList);
+        return NULL;
+    }
+
+    *CodeList->list = (SET_CodeValue *)malloc(sizeof(SET_CodeValue));
+
+    if (*CodeList->list == NULL)
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_SPLITLIST_MALLOCLIST2, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(SET_CodeValue));
+        SET_DestroyCodeList(CodeList);
+        return NULL;
+    }
+
+    SET_InitCodeValue(*CodeList->list);
+
+    char *LastStart = String;
+    int32_t ListCount = 0;
+    int32_t StructCount = 0;
+    bool InString = false;
+
+    for (char *Current = String; *Current != '\0'; ++Current)
+    {
+        // Start or end a string
+        if (*Current == '\"')
+            InString = !InString;
+
+        if (InString)
+        {
+            // Do special character
+            if (*Current == '\\' && *(Current + 1) != '\0')
+                ++Current;
+
+            continue;
+        }
+
+        // Skip a char
+        if (*Current == '\'')
+        {
+            uint32_t WithSpecial = 0;
+
+            // With special character
+            if (*(Current + 1) == '\\')
+                WithSpecial = 1;
+
+            // Test if it stops
+            if (*(Current + WithSpecial + 1) == '\0')
+            {
+                _SET_SetError(_SET_ERRORID_SPLITLIST_STOPCHAR, _SET_ERRORMES_EARLYSTOPCHAR, _SET_ELEMENTPREMES, CodeList->count + 1);
+                SET_DestroyCodeList(CodeList);
+                return NULL;
+            }
+
+            // Make sure it ends
+            if (*(Current + WithSpecial + 2) != '\'')
+            {
+                _SET_SetError(_SET_ERRORID_SPLITLIST_NOSTOPCHAR, _SET_ERRORMES_NOSTOPCHAR, _SET_ELEMENTPREMES, CodeList->count + 1);
+                SET_DestroyCodeList(CodeList);
+                return NULL;
+            }
+
+            // Skip till the end
+            Current += 2 + WithSpecial;
+            continue;
+        }
+
+        // Start or end list and structs
+        if (*Current == '[')
+            ++ListCount;
+
+        else if (*Current == ']')
+            --ListCount;
+
+        else if (*Current == '{')
+            ++StructCount;
+
+        else if (*Current == '}')
+            --StructCount;
+
+        // End element
+        else if (ListCount == 0 && StructCount == 0 && *Current == ',')
+        {
+            // Get memory for the list
+            SET_CodeValue **NewList = (SET_CodeValue **)realloc(CodeList->list, sizeof(SET_CodeValue *) * (CodeList->count + 2));
+
+            if (NewList == NULL)
+            {
+                _SET_SetError(_SET_ERRORID_SPLITLIST_REALLOCLIST, _SET_ERRORMES_REALLOC, sizeof(SET_CodeValue *) * (CodeList->count + 2));
+                SET_DestroyCodeList(CodeList);
+                return NULL;
+            }
+
+            CodeList->list = NewList;
+
+            CodeList->list[CodeList->count + 1] = (SET_CodeValue *)malloc(sizeof(SET_CodeValue));
+
+            if (CodeList->list[CodeList->count + 1] == NULL)
+            {
+                _SET_SetError(_SET_ERRORID_SPLITLIST_REALLOCLIST2, _SET_ERRORMES_MALLOC, sizeof(SET_CodeValue));
+                SET_DestroyCodeList(CodeList);
+                return NULL;
+            }
+
+            SET_InitCodeValue(CodeList->list[CodeList->count + 1]);
+
+            NewList[CodeList->count]->type = SET_VALUETYPE_VALUE;
+            NewList[CodeList->count++]->value.value = LastStart;
+
+            *Current = '\0';
+            LastStart = Current + 1;
+            continue;
+        }
+    }
+
+    // Make sure it is not inside of a string
+    if (InString)
+    {
+        _SET_SetError(_SET_ERRORID_SPLITSTRING_ENDSTRING, _SET_ERRORMES_ENDSTRING, _SET_ELEMENTPREMES, CodeList->count + 1);
+        SET_DestroyCodeList(CodeList);
+        return NULL;
+    }
+
+    // Add the last element
+    CodeList->list[CodeList->count]->type = SET_VALUETYPE_VALUE;
+    CodeList->list[CodeList->count++]->value.value = LastStart;
+
+    // Convert values into structs and lists
+    for (SET_CodeValue **List = CodeList->list, **EndList = CodeList->list + CodeList->count; List < EndList; ++List)
+        // Split the value
+        if (!_SET_SplitValue(*List))
+        {
+            _SET_AddError(_SET_ERRORID_SPLITLIST_SPLITVALUE, _SET_ERRORMES_SPLITVALUE, _SET_ELEMENTPREMES, CodeList->count + 1);
+            SET_DestroyCodeList(CodeList);
+            return NULL;
+        }
+
+    // Return the list
+    return CodeList;
+}
+
+SET_DataTypeBase _SET_GetPossibleType(const char *Value)
+{
+    // Make sure there is a string
+    if (*Value == '\0')
+    {
+        _SET_SetError(_SET_ERRORID_GETPOSSIBLETYPE_NOVALUE, _SET_ERRORMES_NOSTRING);
+        return SET_DATATYPEBASE_NONE;
+    }
+
+    const char *Current = Value;
+    SET_DataTypeBase Type = SET_DATATYPEBASE_NONE;
+    bool Hex = false;
+    bool Bin = false;
+    bool Dot = false;
+    bool Exp = false;
+
+    // Check for a bool
+    if (strcmp(Value, _SET_TRUENAME) == 0 || strcmp(Value, _SET_FALSENAME) == 0)
+        return SET_DATATYPEBASE_BOOL;
+
+    // Do the start
+    switch (*Current)
+    {
+        // Char
+        case ('\''):
+            Type = SET_DATATYPEBASE_CHAR;
+            break;
+
+        // String
+        case ('\"'):
+            Type = SET_DATATYPEBASE_STRING;
+            break;
+
+        // Signed
+        case ('-'):
+            Type = SET_DATATYPEBASE_SINT | SET_DATATYPEBASE_FLOAT;
+            break;
+
+        // Hex or Bin
+        case ('0'):
+            ++Current;
+            switch (*Current)
+            {
+                // Hex
+                case ('x'):
+                    Type = SET_DATATYPEBASE_UINT;
+                    Hex = true;
+                    break;
+
+                // Bin
+                case ('b'):
+                    Type = SET_DATATYPEBASE_UINT;
+                    Bin = true;
+                    break;
+                
+                default:
+                    Type = SET_DATATYPEBASE_SINT | SET_DATATYPEBASE_UINT | SET_DATATYPEBASE_FLOAT;
+                    Current -= 2;
+                    break;
+            }
+            break;
+        
+        default:
+            Type = SET_DATATYPEBASE_SINT | SET_DATATYPEBASE_UINT | SET_DATATYPEBASE_FLOAT;
+            --Current;
+            break;
+    }
+
+    // Add bool
+    if (strlen(Value) == 1 && (*Value == '0' || *Value == '1'))
+        Type |= SET_DATATYPEBASE_BOOL;
+
+    ++Current;
+
+    // Go through entire string
+    if (Type != SET_DATATYPEBASE_CHAR && Type != SET_DATATYPEBASE_STRING)
+        for (; *Current != '\0'; ++Current)
+        {
+            // Check binary
+            if (Bin)
+            {
+                if (*Current != '0' && *Current != '1')
+                {
+                    _SET_SetError(_SET_ERRORID_GETPOSSIBLETYPE_ILLIGALBIN, _SET_ERRORMES_ILLIGALBIN, Value, *Current);
+                    return SET_DATATYPEBASE_NONE;
+                }
+            }
+
+            else if (Hex)
+            {
+                if (!((*Current >= '0' && *Current <= '9') || (*Current >= 'a' && *Current <= 'f') || (*Current >= 'A' && *Current <= 'F')))
+                {
+                    _SET_SetError(_SET_ERRORID_GETPOSSIBLETYPE_ILLIGALHEX, _SET_ERRORMES_ILLIGALHEX, Value, *Current);
+                    return SET_DATATYPEBASE_NONE;
+                }
+            }
+
+            else
+            {
+                if (*Current == '.' && Type & SET_DATATYPEBASE_FLOAT)
+                {
+                    if (!Dot)
+                    {
+                        Dot = true;
+                        Type = SET_DATATYPEBASE_FLOAT;
+                    }
+
+                    else if (Exp)
+                    {
+                        _SET_SetError(_SET_ERRORID_GETPOSSIBLETYPE_ILLIGALDOT2, _SET_ERRORMES_ILLIGALDOT2, Value);
+                        return SET_DATATYPEBASE_NONE;
+                    }
+
+                    else
+                    {
+                        _SET_SetError(_SET_ERRORID_GETPOSSIBLETYPE_ILLIGALDOT, _SET_ERRORMES_ILLIGALDOT, Value);
+                        return SET_DATATYPEBASE_NONE;
+                    }
+                }
+
+                else if ((*Current == 'e' || *Current == 'E') && Type & SET_DATATYPEBASE_FLOAT)
+                {
+                    if (!Exp)
+                    {
+                        Exp = true;
+                        Type = SET_DATATYPEBASE_FLOAT;
+
+                        if (*(Current + 1) == '-')
+                            ++Current;
+                    }
+
+                    else
+                    {
+                        _SET_SetError(_SET_ERRORID_GETPOSSIBLETYPE_ILLIGALEXP, _SET_ERRORMES_ILLIGALEXP, Value);
+                        return SET_DATATYPEBASE_NONE;
+                    }
+                }
+
+                else if (!(*Current >= '0' && *Current <= '9'))
+                {
+                    _SET_SetError(_SET_ERRORID_GETPOSSIBLETYPE_ILLIGALNUM, _SET_ERRORMES_ILLIGALNUM, Value, *Current);
+                    return SET_DATATYPEBASE_NONE;
+                }
+            }
+        }
+
+    // Do the end
+    else
+    {
+        Current += strlen(Current) - 1;
+
+        if (Type == SET_DATATYPEBASE_CHAR)
+        {
+            // Make sure a char ends
+            if (*Current != '\'')
+            {
+                _SET_SetError(_SET_ERRORID_GETPOSSIBLETYPE_CHAREND, _SET_ERRORMES_NOENDCHAR, Value);
+                return SET_DATATYPEBASE_NONE;
+            }
+
+            // Make sure it is not too long or short
+            uint32_t CharLength = 3;
+
+            if (*(Value + 1) == '\\')
+                ++CharLength;
+
+            if (strlen(Value) != CharLength)
+            {
+                _SET_SetError(_SET_ERRORID_GETPOSSIBLETYPE_CHARLENGTH, _SET_ERRORMES_NOSTOPCHAR, Value);
+                return SET_DATATYPEBASE_NONE;
+            }
+        }
+
+        // Make sure a tring ends
+        else if (Type == SET_DATATYPEBASE_STRING)
+        {
+            // Check if it really ends
+            uint32_t SpecialCount = 0;
+
+            for (const char *Current2 = Current - 1; *Current2 == '\\'; --Current2)
+                ++SpecialCount;
+
+            // Check that it ends
+            if (SpecialCount % 2 == 1 || *Current != '\"')
+            {
+                _SET_SetError(_SET_ERRORID_GETPOSSIBLETYPE_STRINGEND, _SET_ERRORMES_NOENDSTRING, Value);
+                return SET_DATATYPEBASE_NONE;
+            }
+        }
+    } 
+
+    return Type;
+}
+
+SET_DataStruct *_SET_ConvertStruct(const SET_CodeStruct *Struct, DIC_Dict *Types)
+{
+    // Create a dictionary
+    DIC_Dict *Dict = DIC_CreateDict(Struct->count);
+
+    if (Dict == NULL)
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_CONVERTSTRUCT_CREATEDICT, DIC_GetError(), _SET_ERRORMES_CREATEDICT);
+        return NULL;
+    }
+
+    // Optional fields are looked up without being there, let the bloom filter answer those
+    if (!DIC_AddBloomFilter(Dict, Struct->count))
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_CONVERTSTRUCT_BLOOM, DIC_GetError(), _SET_ERRORMES_BLOOM);
+        DIC_DestroyDict(Dict);
+        return NULL;
+    }
+
+    // The same field names are used in every element of a list of structs, so they are only stored once
+    if (!DIC_InternKeys(Dict))
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_CONVERTSTRUCT_INTERN, DIC_GetError(), _SET_ERRORMES_INTERN);
+        DIC_DestroyDict(Dict);
+        return NULL;
+    }
+    
+    // Start filling it up
+    SET_CodeName **Names = Struct->names;
+    SET_CodeName **EndNames = Names + Struct->count;
+    SET_CodeValue **Values = Struct->values;
+
+    for (; Names < EndNames; ++Names, ++Values)
+    {
+        // Test if the item is already there
+        if (DIC_CheckItem(Dict, (*Names)->name))
+        {
+            _SET_SetError(_SET_ERRORID_CONVERTSTRUCT_DUBLICATE, _SET_ERRORMES_DUBLICATE, _SET_LINEPREMES, Names - Struct->names + 1);
+            SET_DestroyDataStruct(Dict);
+            return NULL;
+        }
+        
+        // Get the type
+        SET_DataType Type = SET_DATATYPE_NONE;
+
+        if ((*Names)->type != NULL)
+        {
+            Type = _SET_ReadType(Types, (*Names)->type);
+
+            if (Type == SET_DATATYPE_NONE)
+            {
+                _SET_AddError(_SET_ERRORID_CONVERTSTRUCT_TYPE, _SET_ERRORMES_READTYPE, _SET_LINEPREMES, Names - Struct->names + 1);
+                SET_DestroyDataStruct(Dict);
+                return NULL;
+            }
+        }
+        
+        // Read the value
+        SET_Data *Value = _SET_ConvertValue(*Values, Type, (*Names)->pointer, Types);
+
+        if (Value == NULL)
+        {
+            _SET_AddError(_SET_ERRORID_CONVERTSTRUCT_VALUE, _SET_ERRORMES_READVALUE, _SET_LINEPREMES, Names - Struct->names + 1);
+            SET_DestroyDataStruct(Dict);
+            return NULL;
+        }
+        
+        // Add to dict
+        if (!DIC_AddItem(Dict, (*Names)->name, (void *)Value, 0, DIC_MODE_POINTER))
+        {
+            _SET_AddErrorForeign(_SET_ERRORID_CONVERTSTRUCT_ADDITEM, _SET_ERRORMES_DICTADD, (*Names)->name);
+            SET_DestroyData(Value);
+            SET_DestroyDataStruct(Dict);
+            return NULL;
+        }
+    }
+    
+    return Dict;
+}
+
+SET_DataList *_SET_ConvertList(const SET_CodeList *List, SET_DataType Type, uint8_t Depth, DIC_Dict *Types)
+{
+    if (List->count == 0)
+    {
+        _SET_SetError(_SET_ERRORID_CONVERTLIST_NOELEMENTS, _SET_ERRORMES_NOELEMENTS);
+        return NULL;
+    }
+    
+    // Allocate memory
+    SET_DataList *ListObject = (SET_DataList *)malloc(sizeof(SET_DataList));
+
+    if (ListObject == NULL)
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_CONVERTLIST_MALLOC, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(SET_DataList));
+        return NULL;
+    }
+    
+    SET_InitDataList(ListObject);
+    
+    // Add in the list
+    ListObject->list = (SET_Data **)malloc(sizeof(SET_Data *) * List->count);
+
+    if (ListObject->list == NULL)
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_CONVERTLIST_MALLOCLIST, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(SET_Data *) * List->count);
+        SET_DestroyDataList(ListObject);
+        return NULL;
+    }
+    
+    for (SET_Data **Elements = ListObject->list, **EndElements = ListObject->list + List->count; Elements < EndElements; ++Elements)
+        *Elements = NULL;
+
+    ListObject->count = List->count;
+    
+    // Go through each element in the list and convert them
+    SET_Data **DataList = ListObject->list;
+
+    for (SET_CodeValue **ValueList = List->list, **EndValueList = List->list + List->count; ValueList < EndValueList; ++ValueList, ++DataList)
+    {
+        // Convert value
+        *DataList = _SET_ConvertValue(*ValueList, Type, Depth, Types);
+
+        if (*DataList == NULL)
+        {
+            _SET_AddError(_SET_ERRORID_CONVERTLIST_VALUE, _SET_ERRORMES_READVALUE, _SET_ELEMENTPREMES, ValueList - List->list);
+            SET_DestroyDataList(ListObject);
+            return NULL;
+        }
+    }
+    
+    // Find the common type
+    if (!_SET_FinishList(ListObject))
+    {
+        _SET_AddError(_SET_ERRORID_CONVERTLIST_FINISH, _SET_ERRORMES_COMMONTYPE);
+        SET_DestroyDataList(ListObject);
+        return NULL;
+    }
+
+    return ListObject;
+}
+
+SET_Data *_SET_ConvertValue(const SET_CodeValue *Value, SET_DataType Type, uint8_t Depth, DIC_Dict *Types)
+{
+    // Check that there is a value
+    if (Value->value.value == NULL)
+    {
+        _SET_SetError(_SET_ERRORID_CONVERTVALUE_NOVALUE, _SET_ERRORMES_NOVALUE2);
+        return NULL;
+    }
+    
+    // Allocate memory
+    SET_Data *Data = (SET_Data *)malloc(sizeof(SET_Data));
+
+    if (Data == NULL)
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_CONVERTVALUE_MALLOC, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(SET_Data));
+        return NULL;
+    }
+    
+    SET_InitData(Data);
+
+    // Make sure it is a list if needed
+    if (Type != SET_DATATYPE_NONE && Depth > 0 && Value->type != SET_VALUETYPE_LIST)
+    {
+        _SET_AddError(_SET_ERRORID_CONVERTVALUE_LISTMATCH2, _SET_ERRORMES_LISTMATCH2, Value->type);
+        SET_DestroyData(Data);
+        return NULL;
+    }
+    
+    // Find the type of value
+    switch (Value->type)
+    {
+        case (SET_VALUETYPE_LIST):
+            // Make sure it is supposed to be a list
+            if (Type != SET_DATATYPE_NONE && Depth == 0)
+            {
+                _SET_AddError(_SET_ERRORID_CONVERTVALUE_LISTMATCH, _SET_ERRORMES_LISTMATCH, Type);
+                SET_DestroyData(Data);
+                return NULL;
+            }
+
+            // Get the data
+            Data->data.list = _SET_ConvertList(Value->value.list, Type, Depth - 1, Types);
+
+            if (Data->data.list == NULL)
+            {
+                _SET_AddError(_SET_ERRORID_CONVERTVALUE_LIST, _SET_ERRORMES_CONVERTLIST);
+                SET_DestroyData(Data);
+                return NULL;
+            }
+
+            // Set the type
+            Data->type = SET_DATATYPE_LIST;
+            break;
+
+        case (SET_VALUETYPE_STRUCT):
+            // Get the data
+            Data->data.stct = _SET_ConvertStruct(Value->value.sub, Types);
+
+            if (Data->data.stct == NULL)
+            {
+                _SET_AddError(_SET_ERRORID_CONVERTVALUE_STRUCT, _SET_ERRORMES_CONVERTSTRUCT);
+                SET_DestroyData(Data);
+                return NULL;
+            }
+
+            // Set the type
+            Data->type = SET_DATATYPE_STRUCT;
+            break;
+
+        case (SET_VALUETYPE_VALUE):
+            if (!_SET_ConvertScalar(Data, Value->value.value, NULL))
+            {
+                _SET_AddError(_SET_ERRORID_CONVERTVALUE_CONVERT, _SET_ERRORMES_CONVERTVALUE);
+                SET_DestroyData(Data);
+                return NULL;
+            }
+
+            break;
+
+        default:
+            break;
+    }
+
+    // Make sure the type is correct
+    if (Type != SET_DATATYPE_NONE && Data->type != SET_DATATYPE_LIST && !_SET_MatchType(Data, Type))
+    {
+        _SET_AddError(_SET_ERRORID_CONVERTVALUE_TYPEMATCH, _SET_ERRORMES_MATCHTYPE, Type);
+        SET_DestroyData(Data);
+        return NULL;
+    }
+    
+    return Data;
+}
+
+bool _SET_ConvertScalar(SET_Data *Data, const char *Value, ARN_Arena *Arena)
+{
+    // Figure out what type it is
+    SET_DataTypeBase PossibleType = _SET_GetPossibleType(Value);
+
+    // Convert
+    if (PossibleType & SET_DATATYPEBASE_CHAR)
+        *Data = _SET_ConvertChar(Value);
+
+    else if (PossibleType & SET_DATATYPEBASE_STRING)
+        *Data = _SET_ConvertString(Value, Arena);
+
+    else if (PossibleType & SET_DATATYPEBASE_BOOL)
+        *Data = _SET_ConvertBool(Value);
+
+    else if (PossibleType & SET_DATATYPEBASE_UINT)
+        *Data = _SET_ConvertUint(Value);
+
+    else if (PossibleType & SET_DATATYPEBASE_SINT)
+        *Data = _SET_ConvertSint(Value);
+
+    else if (PossibleType & SET_DATATYPEBASE_FLOAT)
+        *Data = _SET_ConvertFloat(Value);
+
+    else
+    {
+        _SET_AddError(_SET_ERRORID_CONVERTSCALAR_NOPOSSIBLEVALUE, _SET_ERRORMES_NOPOSSIBLEVALUE);
+        return false;
+    }
+
+    if (Data->type == SET_DATATYPE_NONE)
+    {
+        _SET_AddError(_SET_ERRORID_CONVERTSCALAR_CONVERT, _SET_ERRORMES_CONVERTVALUE);
+        return false;
+    }
+
+    return true;
+}
+
+bool _SET_MatchType(SET_Data *Data, SET_DataType Type)
+{
+    // Check for special types
+    if (Type >= SET_DATATYPE_CHAR && Type <= SET_DATATYPE_STRUCT)
+    {
+        if (Data->type != Type)
+        {
+            _SET_SetError(_SET_ERRORID_MATCHTYPE_TYPEMATCH, _SET_ERRORMES_TYPEMATCH, Type, Data->type);
+            return false;
+        }
+    }
+
+    // Check for numbers
+    else if (Type >= SET_DATATYPE_INT && Type <= SET_DATATYPE_FLOAT)
+    {
+        // Convert it
+        SET_Data NewData = _SET_ConvertType(Data, Type);
+
+        if (NewData.type == SET_DATATYPE_NONE)
+        {
+            _SET_AddError(_SET_ERRORID_MATCHTYPE_NUMBERMATCH, _SET_ERRORMES_NUMBERCONVERT);
+            return false;
+        }
+
+        if (Data->type != NewData.type)
+            *Data = NewData;
+    }
+
+    else
+    {
+        _SET_SetError(_SET_ERRORID_MATCHTYPE_TYPE, _SET_ERRORMES_WRONGTYPE, Type);
+        return false;
+    }
+
+    return true;
+}
+
+bool _SET_FinishList(SET_DataList *List)
+{
+    // Find the common type
+    SET_DataType CommonType = (*List->list)->type;
+    uint8_t CommonDepth = 0;
+
+    if (CommonType == SET_DATATYPE_LIST)
+    {
+        CommonType = (*List->list)->data.list->type;
+        CommonDepth = (*List->list)->data.list->depth;
+    }
+    
+    for (SET_Data **ValueList = List->list + 1, **EndValueList = List->list + List->count; ValueList < EndValueList; ++ValueList)
+    {
+        // Check for lists
+        if (CommonDepth > 0)
+        {
+            if ((*ValueList)->type != SET_DATATYPE_LIST || (*ValueList)->data.list->depth != CommonDepth || (*ValueList)->data.list->type != CommonType)
+            {
+                _SET_SetError(_SET_ERRORID_FINISHLIST_LISTELEMENT, _SET_ERRORMES_LISTELEMENT, _SET_ELEMENTPREMES, ValueList - List->list);
+                return false;
+            }
+        }
+
+        else if ((*ValueList)->type == SET_DATATYPE_LIST)
+        {
+            _SET_SetError(_SET_ERRORID_FINISHLIST_LISTELEMENT2, _SET_ERRORMES_LISTELEMENT, _SET_ELEMENTPREMES, ValueList - List->list);
+            return false;
+        }
+
+        else if (!_SET_MergeType(&CommonType, (*ValueList)->type, ValueList - List->list))
+        {
+            _SET_AddError(_SET_ERRORID_FINISHLIST_MERGE, _SET_ERRORMES_COMMONTYPE);
+            return false;
+        }
+    }
+    
+    // Convert elements to the same type
+    if (CommonDepth == 0 && CommonType >= SET_DATATYPE_INT8 && CommonType <= SET_DATATYPE_FLOAT)
+        for (SET_Data **ValueList = List->list, **EndValueList = List->list + List->count; ValueList < EndValueList; ++ValueList)
+            if ((*ValueList)->type != CommonType)
+                **ValueList = _SET_ConvertType(*ValueList, CommonType);
+                
+    // Finish up
+    List->type = CommonType;
+    List->depth = CommonDepth + 1;
+
+    return true;
+}
+
+bool _SET_MergeType(SET_DataType *CommonType, SET_DataType Type, size_t Element)
+{
+    // Check for special types
+    if (Type >= SET_DATATYPE_CHAR && Type <= SET_DATATYPE_STRUCT)
+    {
+        if (Type != *CommonType)
+        {
+            _SET_SetError(_SET_ERRORID_MERGETYPE_TYPEELEMENT, _SET_ERRORMES_TYPEELEMENT, _SET_ELEMENTPREMES, Element);
+            return false;
+        }
+    }
+
+    // Check for numbers
+    else if (Type >= SET_DATATYPE_BOOL && Type <= SET_DATATYPE_FLOAT)
+    {
+        // Make sure it is supposed to be a number
+        if (!(*CommonType >= SET_DATATYPE_BOOL && *CommonType <= SET_DATATYPE_FLOAT))
+        {
+            _SET_SetError(_SET_ERRORID_MERGETYPE_NUMBERELEMENT, _SET_ERRORMES_NUMBERELEMENT, _SET_ELEMENTPREMES, Element);
+            return false;
+        }
+        
+        // Find out what number it must be
+        // Floats
+        if (*CommonType == SET_DATATYPE_DOUBLE || Type == SET_DATATYPE_DOUBLE)
+            *CommonType = SET_DATATYPE_DOUBLE;
+
+        else if (*CommonType == SET_DATATYPE_FLOAT || Type == SET_DATATYPE_FLOAT)
+            *CommonType = SET_DATATYPE_FLOAT;
+
+        // Signed ints
+        else if (*CommonType >= SET_DATATYPE_SINT8 || Type >= SET_DATATYPE_SINT8)
+        {
+            // Get what type of signed int it should be
+            uint8_t CommonSize;
+            uint8_t ValueSize;
+
+            if (*CommonType >= SET_DATATYPE_SINT8)
+                CommonSize = *CommonType - SET_DATATYPE_SINT8;
+
+            else
+                CommonSize = (*CommonType - SET_DATATYPE_INT8 + 1) / 2;
+
+            if (Type >= SET_DATATYPE_SINT8)
+                ValueSize = Type - SET_DATATYPE_SINT8;
+
+            else
+                ValueSize = (Type - SET_DATATYPE_INT8 + 1) / 2;
+
+            if (ValueSize > CommonSize)
+                CommonSize = ValueSize;
+                
+            *CommonType = SET_DATATYPE_SINT8 + CommonSize;
+        }
+
+        // Not a signed int
+        else if (Type > *CommonType)
+            *CommonType = Type;
+    }
+
+    else
+    {
+        _SET_SetError(_SET_ERRORID_MERGETYPE_TYPE, _SET_ERRORMES_WRONGTYPE, Type);
+        return false;
+    }
+
+    return true;
+}
+
+SET_DataType _SET_ReadType(DIC_Dict *Types, const char *Type)
+{
+    // Make sure the dict exists
+    if (Types == NULL)
+    {
+        _SET_SetError(_SET_ERRORID_READTYPE_DICT, _SET_ERRORMES_DICTEXIST);
+        return SET_DATATYPE_NONE;
+    }
+
+    // Check that it exists
+    if (!DIC_CheckItem(Types, Type))
+    {
+        _SET_SetError(_SET_ERRORID_READTYPE_WRONGTYPE, _SET_ERRORMES_UNKNOWNTYPE, Type);
+        return SET_DATATYPE_NONE;
+    }
+
+    // Get the item
+    SET_DataType *DataType = (SET_DataType *)DIC_GetItem(Types, Type);
+
+    if (DataType == NULL)
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_READTYPE_RETRIEVE, DIC_GetError(), _SET_ERRORMES_DICTITEM, Type);
+        return SET_DATATYPE_NONE;
+    }
+
+    return *DataType;
+}
+
+SET_Data _SET_ConvertType(SET_Data *Data, SET_DataType Type)
+{
+    // Setup output
+    SET_Data NewData;
+    SET_InitData(&NewData);
+
+    // Make sure it is legal
+    if (Type == SET_DATATYPE_LIST || Type == SET_DATATYPE_STRUCT)
+    {
+        _SET_SetError(_SET_ERRORID_CONVERTTYPE_NOSTRUCT, _SET_ERRORMES_NOSTRUCT);
+        return NewData;
+    }
+
+    // Do the standalones
+    else if (Type == SET_DATATYPE_CHAR || Type == SET_DATATYPE_STR)
+    {
+        if (Type != Data->type)
+        {
+            _SET_SetError(_SET_ERRORID_CONVERTTYPE_TYPEMATCH, _SET_ERRORMES_TYPEMATCH, Type, Data->type);
+            return NewData;
+        }
+    }
+
+    // Make sure the number match up
+    else if (Type >= SET_DATATYPE_INT && Type <= SET_DATATYPE_FLOAT)
+    {
+        if (!(Data->type >= SET_DATATYPE_BOOL && Data->type <= SET_DATATYPE_FLOAT))
+        {
+            _SET_SetError(_SET_ERRORID_CONVERTTYPE_NUMBERMATCH, _SET_ERRORMES_NUMBERMATCH, Data->type);
+            return NewData;
+        }
+
+        else if (Type >= SET_DATATYPE_DOUBLE)
+            ;
+
+        else if (Data->type >= SET_DATATYPE_DOUBLE)
+        {
+            _SET_SetError(_SET_ERRORID_CONVERTTYPE_FLOATMATCH, _SET_ERRORMES_FLOATMATCH);
+            return NewData;
+        }
+
+        else if (Type == SET_DATATYPE_INT)
+            return *Data;
+
+        else if (Type >= SET_DATATYPE_SINT8)
+        {
+            uint8_t Size;
+
+            if (Data->type >= SET_DATATYPE_SINT8)
+                Size = Data->type - SET_DATATYPE_SINT8;
+
+            else
+                Size = (Data->type - SET_DATATYPE_INT8 + 1) / 2;
+
+            if (Size > Type - SET_DATATYPE_SINT8)
+            {
+                _SET_SetError(_SET_ERRORID_CONVERTTYPE_SINTMATCH, _SET_ERRORMES_SINTMATCH, Type, Data->type);
+                return NewData;
+            }
+        }
+
+        else if (Data->type >= SET_DATATYPE_SINT8)
+        {
+            _SET_SetError(_SET_ERRORID_CONVERTTYPE_SINTMATCH2, _SET_ERRORMES_SINTMATCH2, Type, Data->type);
+            return NewData;
+        }
+
+        else if (Data->type > Type)
+        {
+            _SET_SetError(_SET_ERRORID_CONVERTTYPE_INTMATCH, _SET_ERRORMES_INTMATCH, Type, Data->type);
+            return NewData;
+        }
+    }
+
+    else
+    {
+        _SET_SetError(_SET_ERRORID_CONVERTTYPE_TYPEMATCH2, _SET_ERRORMES_TYPEMATCH, Type, Data->type);
+        return NewData;
+    }
+
+    NewData.type = Type;
+
+    // Convert the type to a general type
+    uint64_t Uint = 0;
+    bool UseUint = false;
+    int64_t Sint = 0;
+    bool UseSint = false;
+    double Float = 0.0;
+    bool UseFloat = false;
+
+    switch (Data->type)
+    {
+        // If a char or string, just return
+        case (SET_DATATYPE_CHAR):
+        case (SET_DATATYPE_STR):
+            return *Data;
+
+        // If it is an bool
+        case (SET_DATATYPE_BOOL):
+            Uint = (uint64_t)Data->data.b;
+            UseUint = true;
+            break;
+
+        // If an unsigned int
+        case (SET_DATATYPE_INT8):
+        case (SET_DATATYPE_UINT8):
+            Uint = (uint64_t)Data->data.u8;
+            UseUint = true;
+            break;
+
+        case (SET_DATATYPE_INT16):
+        case (SET_DATATYPE_UINT16):
+            Uint = (uint64_t)Data->data.u16;
+            UseUint = true;
+            break;
+
+        case (SET_DATATYPE_INT32):
+        case (SET_DATATYPE_UINT32):
+            Uint = (uint64_t)Data->data.u32;
+            UseUint = true;
+            break;
+
+        case (SET_DATATYPE_INT64):
+        case (SET_DATATYPE_UINT64):
+            Uint = (uint64_t)Data->data.u64;
+            UseUint = true;
+            break;
+
+        // If signed int
+        case (SET_DATATYPE_SINT8):
+            Sint = (int64_t)Data->data.i8;
+            UseSint = true;
+            break;
+
+        case (SET_DATATYPE_SINT16):
+            Sint = (int64_t)Data->data.i16;
+            UseSint = true;
+            break;
+
+        case (SET_DATATYPE_SINT32):
+            Sint = (int64_t)Data->data.i32;
+            UseSint = true;
+            break;
+
+        case (SET_DATATYPE_SINT64):
+            Sint = (int64_t)Data->data.i64;
+            UseSint = true;
+            break;
+
+        // If float
+        case (SET_DATATYPE_FLOAT):
+            Float = (double)Data->data.f;
+            UseFloat = true;
+            break;
+
+        case (SET_DATATYPE_DOUBLE):
+            Float = (double)Data->data.d;
+            UseFloat = true;
+            break;
+
+        default:
+            break;
+    }
+
+    if (Type >= SET_DATATYPE_DOUBLE)
+    {
+        if (UseUint)
+            Float = (double)Uint;
+
+        else if (UseSint)
+            Float = (double)Sint;
+    }
+
+    else if (Type >= SET_DATATYPE_SINT8)
+    {
+        if (UseUint)
+            Sint = (int64_t)Uint;
+
+        else if (UseFloat)
+            Sint = (int64_t)Float;
+    }
+
+    else
+    {
+        if (UseSint)
+            Uint = (uint64_t)Sint;
+
+        else if (UseFloat)
+            Uint = (uint64_t)Float;
+    }
+
+    // Convert to the correct type
+    switch (Type)
+    {
+        // Bool
+        case (SET_DATATYPE_BOOL):
+            NewData.data.b = (bool)Uint;
+            break;
+
+        // Unsigned int
+        case (SET_DATATYPE_INT8):
+        case (SET_DATATYPE_UINT8):
+            NewData.data.u8 = (uint8_t)Uint;
+            break;
+
+        case (SET_DATATYPE_INT16):
+        case (SET_DATATYPE_UINT16):
+            NewData.data.u16 = (uint16_t)Uint;
+            break;
+
+        case (SET_DATATYPE_INT32):
+        case (SET_DATATYPE_UINT32):
+            NewData.data.u32 = (uint32_t)Uint;
+            break;
+
+        case (SET_DATATYPE_INT64):
+        case (SET_DATATYPE_UINT64):
+            NewData.data.u64 = (uint64_t)Uint;
+            break;
+
+        // Signed int
+        case (SET_DATATYPE_SINT8):
+            NewData.data.i8 = (int8_t)Sint;
+            break;
+
+        case (SET_DATATYPE_SINT16):
+            NewData.data.i16 = (int16_t)Sint;
+            break;
+
+        case (SET_DATATYPE_SINT32):
+            NewData.data.i32 = (int32_t)Sint;
+            break;
+
+        case (SET_DATATYPE_SINT64):
+            NewData.data.i64 = (int64_t)Sint;
+            break;
+
+        // Float
+        case (SET_DATATYPE_FLOAT):
+            NewData.data.f = (float)Float;
+            break;
+
+        case (SET_DATATYPE_DOUBLE):
+            NewData.data.d = (double)Float;
+            break;
+
+        default:
+            break;
+    }
+
+    return NewData;
+}
+
+SET_Data _SET_ConvertBool(const char *String)
+{
+    // Go through different cases
+    size_t Length = strlen(String);
+    SET_Data Data;
+    SET_InitData(&Data);
+
+    if ((Length == 1 && *String == '0') || strcmp(String, _SET_FALSENAME) == 0)
+        Data.data.b = false;
+
+    else if ((Length == 1 && *String == '1') || strcmp(String, _SET_TRUENAME) == 0)
+        Data.data.b = true;
+
+    else
+    {
+        _SET_SetError(_SET_ERRORID_CONVERTBOOL_CORRECT, _SET_ERRORMES_ILLIGALBOOL, String);
+        return Data;
+    }
+
+    Data.type = SET_DATATYPE_BOOL;
+    return Data;
+}
+
+SET_Data _SET_ConvertUint(const char *String)
+{
+    SET_Data Value;
+    SET_InitData(&Value);
+
+    // Get the length
+    size_t Length = strlen(String);
+
+    // Convert number
+    if (Length >= 2 && String[1] == 'x')
+        Value = _SET_ReadHex(String + 2);
+
+    else if (Length >= 2 && String[1] == 'b')
+        Value = _SET_ReadBin(String + 2);
+
+    else
+        Value = _SET_ReadUint(String);
+
+    if (Value.type == SET_DATATYPE_NONE)
+    {
+        _SET_SetError(_SET_ERRORID_CONVERTUINT_CONVERT, _SET_ERRORMES_NUMBERCONVERT);
+        return Value;
+    }
+
+    // Convert it to the lowest possible type
+    if (Value.data.u64 <= _SET_HIGH_INT8)
+    {
+        Value.data.u8 = (uint8_t)Value.data.u64;
+        Value.type = SET_DATATYPE_INT8;
+    }
+
+    else if (Value.data.u64 <= _SET_HIGH_UINT8)
+    {
+        Value.data.u8 = (uint8_t)Value.data.u64;
+        Value.type = SET_DATATYPE_UINT8;
+    }
+
+    else if (Value.data.u64 <= _SET_HIGH_INT16)
+    {
+        Value.data.u16 = (uint16_t)Value.data.u64;
+        Value.type = SET_DATATYPE_INT16;
+    }
+
+    else if (Value.data.u64 <= _SET_HIGH_UINT16)
+    {
+        Value.data.u16 = (uint16_t)Value.data.u64;
+        Value.type = SET_DATATYPE_UINT16;
+    }
+
+    else if (Value.data.u64 <= _SET_HIGH_INT32)
+    {
+        Value.data.u32 = (uint32_t)Value.data.u64;
+        Value.type = SET_DATATYPE_INT32;
+    }
+
+    else if (Value.data.u64 <= _SET_HIGH_UINT32)
+    {
+        Value.data.u32 = (uint32_t)Value.data.u64;
+        Value.type = SET_DATATYPE_UINT32;
+    }
+
+    else if (Value.data.u64 <= _SET_HIGH_INT64)
+        Value.type = SET_DATATYPE_INT64;
+
+    return Value;
+}
+
+SET_Data _SET_ReadUint(const char *String)
+{
+    SET_Data Value;
+    Value.type = SET_DATATYPE_NONE;
+    Value.data.u64 = 0;
 
     // Get the length
+    if (strlen(String) == 0)
+    {
+        _SET_AddError(_SET_ERRORID_READUINT_NOSTRING, _SET_ERRORMES_NOVALUE2);
+        return Value;
+    }
+
+    // Remove leading 0
+    for (; *String == '0'; ++String)
+        ;
+
     size_t Length = strlen(String);
 
-    // Convert number
-    if (Length >= 2 && String[1] == 'x')
-        Value = _SET_ReadHex(String + 2);
+    if (Length > 20)
+    {
+        _SET_SetError(_SET_ERRORID_READUINT_HIGH, _SET_ERRORMES_HIGHNUMBER, _SET_HIGH_UINT64, String);
+        return Value;
+    }
+
+    // The first 19 digits cannot overflow so they are read 8 at a time without checks
+    const char *Current = String;
+    const char *SafeEnd = String + ((Length > 19) ? (19) : (Length));
+
+    for (; SafeEnd - Current >= 8; Current += 8)
+        Value.data.u64 = Value.data.u64 * 100000000 + _SET_ReadEightDigits(Current);
+
+    for (; Current < SafeEnd; ++Current)
+        Value.data.u64 = Value.data.u64 * 10 + *Current - '0';
+
+    // The last digit might overflow
+    if (*Current != '\0')
+    {
+        uint64_t Digit = *Current - '0';
+
+        if (Value.data.u64 > (_SET_HIGH_UINT64 - Digit) / 10)
+        {
+            _SET_SetError(_SET_ERRORID_READUINT_HIGH2, _SET_ERRORMES_HIGHNUMBER, _SET_HIGH_UINT64, String);
+            return Value;
+        }
+
+        Value.data.u64 = Value.data.u64 * 10 + Digit;
+    }
+
+    Value.type = SET_DATATYPE_UINT64;
+    return Value;
+}
+
+SET_Data _SET_ReadHex(const char *String)
+{
+    SET_Data Value;
+    Value.type = SET_DATATYPE_NONE;
+    Value.data.u64 = 0;
+
+    // Get the length
+    if (strlen(String) == 0)
+    {
+        _SET_AddError(_SET_ERRORID_READHEX_NOSTRING, _SET_ERRORMES_NOVALUE2);
+        return Value;
+    }
+
+    // Remove leading 0
+    for (; *String == '0'; ++String)
+        ;
+
+    // Make sure it is not too large
+    if (strlen(String) > sizeof(uint64_t) * 2)
+    {
+        _SET_SetError(_SET_ERRORID_READHEX_HIGH, _SET_ERRORMES_HIGHHEX, _SET_HIGH_UINT64, String);
+        return Value;
+    }
+
+    // Read
+    for (const char *NewString = String; *NewString != '\0'; ++NewString)
+    {
+        Value.data.u64 *= 0x10;
+
+        if (*NewString >= '0' && *NewString <= '9')
+            Value.data.u64 += *NewString - '0';
+
+        else if (*NewString >= 'a' && *NewString <= 'f')
+            Value.data.u64 += *NewString - 'a' + 0xA;
+
+        else
+            Value.data.u64 += *NewString - 'A' + 0xA;
+    }
+
+    Value.type = SET_DATATYPE_UINT64;
+    return Value;
+}
+
+SET_Data _SET_ReadBin(const char *String)
+{
+    SET_Data Value;
+    Value.type = SET_DATATYPE_NONE;
+    Value.data.u64 = 0;
+
+    // Get the length
+    if (strlen(String) == 0)
+    {
+        _SET_AddError(_SET_ERRORID_READBIN_NOSTRING, _SET_ERRORMES_NOVALUE2);
+        return Value;
+    }
+
+    // Remove leading 0
+    for (; *String == '0'; ++String)
+        ;
+
+    // Make sure it is not too large
+    if (strlen(String) > sizeof(uint64_t) * 8)
+    {
+        _SET_SetError(_SET_ERRORID_READBIN_HIGH, _SET_ERRORMES_HIGHHEX, _SET_HIGH_UINT64, String);
+        return Value;
+    }
+
+    // Read
+    for (const char *NewString = String; *NewString != '\0'; ++NewString)
+        Value.data.u64 = Value.data.u64 * 2 + *NewString - '0';
+
+    Value.type = SET_DATATYPE_UINT64;
+    return Value;
+}
+
+SET_Data _SET_ReadSint(const char *String)
+{
+    bool Negative = false;
+
+    // Check if it is negative
+    if (*String == '-')
+        Negative = true;
+
+    // Read the positive part
+    SET_Data Value = _SET_ReadUint(String + Negative);
+
+    if (Value.type == SET_DATATYPE_NONE)
+    {
+        _SET_AddError(_SET_ERRORID_READSINT_UINT, _SET_ERRORMES_NUMBERCONVERT);
+        return Value;
+    }
+
+    // Make sure it is not too large
+    if (Value.data.u64 > (uint64_t)_SET_HIGH_INT64 + ((Negative) ? (1) : (0)))
+    {
+        _SET_SetError(_SET_ERRORID_READSINT_HIGH, _SET_ERRORMES_HIGHNUMBERSIGNED, ((Negative) ? ("small") : ("large")), ((Negative) ? ("Min") : ("Max")), (_SET_HIGH_INT64 + Negative) * ((Negative) ? (-1) : (1)), String);
+        Value.type = SET_DATATYPE_NONE;
+        return Value;
+    }
+
+    // Convert to signed int
+    Value.data.i64 = (int64_t)Value.data.u64 * ((Negative) ? (-1) : (1));
+    Value.type = SET_DATATYPE_SINT64;
+    return Value;
+}
+
+SET_Data _SET_ConvertSint(const char *String)
+{
+    // Read
+    SET_Data Value = _SET_ReadSint(String);
+
+    if (Value.type == SET_DATATYPE_NONE)
+    {
+        _SET_SetError(_SET_ERRORID_CONVERTSINT_READ, _SET_ERRORMES_NUMBERCONVERT);
+        return Value;
+    }
+
+    // Find the correct type
+    bool Negative = ((Value.data.i64 < 0) ? (true) : (false));
+    uint64_t Pos = (uint64_t)Value.data.i64 * ((Negative) ? (-1) : (1));
+
+    if (Pos <= (uint64_t)_SET_HIGH_INT8 + Negative)
+    {
+        Value.data.i8 = (int8_t)Value.data.i64;
+        Value.type = SET_DATATYPE_SINT8;
+    }
+
+    else if (Pos <= (uint64_t)_SET_HIGH_INT16 + Negative)
+    {
+        Value.data.i16 = (int16_t)Value.data.i64;
+        Value.type = SET_DATATYPE_SINT16;
+    }
+
+    else if (Pos <= (uint64_t)_SET_HIGH_INT32 + Negative)
+    {
+        Value.data.i32 = (int32_t)Value.data.i64;
+        Value.type = SET_DATATYPE_SINT32;
+    }
+
+    else
+        Value.type = SET_DATATYPE_SINT64;
+
+    return Value;
+}
+
+SET_Data _SET_ConvertFloat(const char *String)
+{
+    bool Negative = false;
+
+    // Check if it is negative
+    if (*String == '-')
+        Negative = true;
+
+    SET_Data Value;
+    Value.data.d = 0.;
+    Value.type = SET_DATATYPE_NONE;
+
+    // Read up to 19 significant digits into an integer, the rest only change the exponent
+    const char *Current = String + Negative;
+    const char *End = Current + strlen(Current);
+    uint64_t Mantissa = 0;
+    int64_t Exp = 0;
+    size_t Digits = 0;
+    bool Truncated = false;
+
+    // Remove leading 0
+    for (; *Current == '0'; ++Current)
+        ;
+
+    for (; End - Current >= 8 && Digits <= 11 && _SET_IsEightDigits(_SET_LoadEightChars(Current)); Current += 8, Digits += 8)
+        Mantissa = Mantissa * 100000000 + _SET_ReadEightDigits(Current);
+
+    for (; *Current >= '0' && *Current <= '9'; ++Current)
+    {
+        if (Digits < 19)
+        {
+            Mantissa = Mantissa * 10 + *Current - '0';
+            ++Digits;
+        }
+
+        else
+        {
+            ++Exp;
+            Truncated |= (*Current != '0');
+        }
+    }
+
+    // Add after .
+    if (*Current == '.')
+    {
+        ++Current;
+
+        // Zeros before the first significant digit
+        if (Mantissa == 0)
+            for (; *Current == '0'; ++Current)
+                --Exp;
+
+        for (; End - Current >= 8 && Digits <= 11 && _SET_IsEightDigits(_SET_LoadEightChars(Current)); Current += 8, Digits += 8, Exp -= 8)
+            Mantissa = Mantissa * 100000000 + _SET_ReadEightDigits(Current);
+
+        for (; *Current >= '0' && *Current <= '9'; ++Current)
+        {
+            if (Digits < 19)
+            {
+                Mantissa = Mantissa * 10 + *Current - '0';
+                ++Digits;
+                --Exp;
+            }
+
+            else
+                Truncated |= (*Current != '0');
+        }
+    }
+
+    // Add exponentiation
+    if (*Current == 'e' || *Current == 'E')
+    {
+        // Convert int
+        SET_Data ExpValue = _SET_ReadSint(Current + 1);
+
+        if (ExpValue.type == SET_DATATYPE_NONE)
+        {
+            _SET_AddError(_SET_ERRORID_CONVERTFLOAT_EXP, _SET_ERRORMES_CONVERTEXP, String);
+            return Value;
+        }
+
+        // Exponents this large always give 0 or infinity, they are limited so the sum cannot overflow
+        if (ExpValue.data.i64 > 100000)
+            ExpValue.data.i64 = 100000;
+
+        else if (ExpValue.data.i64 < -100000)
+            ExpValue.data.i64 = -100000;
+
+        Exp += ExpValue.data.i64;
+    }
+
+    // Both the mantissa and the power of 10 are exact so a single operation rounds correctly
+    if (Mantissa == 0)
+        Value.data.d = 0.;
+
+    else if (!Truncated && Mantissa <= ((uint64_t)1 << 53) && Exp >= -22 && Exp <= 22)
+        Value.data.d = ((Exp < 0) ? ((double)Mantissa / _SET_Pow10[-Exp]) : ((double)Mantissa * _SET_Pow10[Exp]));
+
+    // Fall back to the slow but correct conversion when the fast one cannot decide
+    else if (Truncated || !_SET_EiselLemire(&Value.data.d, Mantissa, Exp))
+        Value.data.d = _SET_Strtod(String + Negative);
+
+    if (Negative)
+        Value.data.d *= -1.;
+
+    // Check if it is finite
+    if (!isfinite(Value.data.d))
+    {
+        _SET_SetError(_SET_ERRORID_CONVERTFLOAT_FINITE, _SET_ERRORMES_FINITE, String);
+        return Value;
+    }
+
+    Value.type = SET_DATATYPE_DOUBLE;
+    return Value;
+}
+
+static inline uint64_t _SET_LoadEightChars(const char *String)
+{
+    uint64_t Value;
+    memcpy(&Value, String, sizeof(uint64_t));
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    Value = __builtin_bswap64(Value);
+#endif
+
+    return Value;
+}
+
+static inline bool _SET_IsEightDigits(uint64_t Value)
+{
+    // The high half of every byte must be 3 and adding 6 to the low half must not carry
+    return ((Value & 0xF0F0F0F0F0F0F0F0) | (((Value + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) == 0x3333333333333333;
+}
+
+static inline uint32_t _SET_ReadEightDigits(const char *String)
+{
+    // Combine the digits pairwise into 2, 4 and then 8 digit numbers
+    uint64_t Value = _SET_LoadEightChars(String) - 0x3030303030303030;
+    Value = Value * 10 + (Value >> 8);
+    Value = (((Value & 0x000000FF000000FF) * (100 + (1000000ULL << 32))) + (((Value >> 16) & 0x000000FF000000FF) * (1 + (10000ULL << 32)))) >> 32;
+
+    return (uint32_t)Value;
+}
+
+static inline uint64_t _SET_Mul128(uint64_t A, uint64_t B, uint64_t *High)
+{
+#ifdef __SIZEOF_INT128__
+    unsigned __int128 Product = (unsigned __int128)A * B;
+    *High = (uint64_t)(Product >> 64);
+    return (uint64_t)Product;
+#else
+    uint64_t LowLow = (A & 0xFFFFFFFF) * (B & 0xFFFFFFFF);
+    uint64_t LowHigh = (A & 0xFFFFFFFF) * (B >> 32);
+    uint64_t HighLow = (A >> 32) * (B & 0xFFFFFFFF);
+    uint64_t HighHigh = (A >> 32) * (B >> 32);
+    uint64_t Middle = (LowLow >> 32) + (LowHigh & 0xFFFFFFFF) + (HighLow & 0xFFFFFFFF);
+
+    *High = HighHigh + (LowHigh >> 32) + (HighLow >> 32) + (Middle >> 32);
+    return (Middle << 32) | (LowLow & 0xFFFFFFFF);
+#endif
+}
+
+bool _SET_EiselLemire(double *Value, uint64_t Mantissa, int64_t Exp)
+{
+    extern const uint64_t _SET_Pow5Table[];
+
+    if (Exp < _SET_POW5MIN || Exp > _SET_POW5MAX)
+        return false;
+
+    // Move the highest bit to the top
+    int LeadingZeros = __builtin_clzll(Mantissa);
+    Mantissa <<= LeadingZeros;
+
+    // Multiply by the power of 5, the low word of the power is only needed if the bits below the result might carry into it
+    const uint64_t *Pow5 = _SET_Pow5Table + 2 * (Exp - _SET_POW5MIN);
+    uint64_t High;
+    uint64_t Low = _SET_Mul128(Mantissa, Pow5[0], &High);
+
+    if ((High & 0x1FF) == 0x1FF)
+    {
+        uint64_t SecondHigh;
+        _SET_Mul128(Mantissa, Pow5[1], &SecondHigh);
+        Low += SecondHigh;
+
+        if (SecondHigh > Low)
+            ++High;
+
+        // Too close to halfway to know which way to round
+        if (Low == 0xFFFFFFFFFFFFFFFF && (Exp < -27 || Exp > 55))
+            return false;
+    }
+
+    // Keep 54 bits, the last one is for rounding
+    uint64_t UpperBit = High >> 63;
+    uint64_t Result = High >> (UpperBit + 9);
+    int64_t Power2 = ((217706 * Exp) >> 16) + 63 + (int64_t)UpperBit - LeadingZeros + 1023;
+
+    // Subnormal numbers are left for strtod
+    if (Power2 <= 0)
+        return false;
+
+    // Exactly halfway, round to even, this can only happen when 5^Exp is exact
+    if (Low <= 1 && Exp >= -4 && Exp <= 23 && (Result & 3) == 1 && (Result << (UpperBit + 9)) == High)
+        Result &= ~(uint64_t)1;
+
+    Result += Result & 1;
+    Result >>= 1;
+
+    // Rounding up may overflow into the next power of 2
+    if (Result >= ((uint64_t)2 << 52))
+    {
+        Result = (uint64_t)1 << 52;
+        ++Power2;
+    }
+
+    if (Power2 >= 0x7FF)
+        return false;
+
+    uint64_t Bits = (Result & ~((uint64_t)1 << 52)) | ((uint64_t)Power2 << 52);
+    memcpy(Value, &Bits, sizeof(double));
+    return true;
+}
+
+double _SET_Strtod(const char *String)
+{
+    extern locale_t _SET_NumericLocale;
+    extern pthread_mutex_t _SET_NumericLocaleLock;
+
+    // Other threads may create the locale at the same time
+    pthread_mutex_lock(&_SET_NumericLocaleLock);
+
+    if (_SET_NumericLocale == (locale_t)0)
+        _SET_NumericLocale = newlocale(LC_NUMERIC_MASK, "C", (locale_t)0);
+
+    locale_t Locale = _SET_NumericLocale;
+    pthread_mutex_unlock(&_SET_NumericLocaleLock);
+
+    // The C locale always exists, but if it could not be created the locale of the program is used
+    if (Locale == (locale_t)0)
+        return strtod(String, NULL);
+
+    // Only the locale of this thread is changed
+    locale_t OldLocale = uselocale(Locale);
+    double Value = strtod(String, NULL);
+    uselocale(OldLocale);
+
+    return Value;
+}
+
+char _SET_ConvertSpecialChar(char Char)
+{
+    // Figure out what it is
+    switch (Char)
+    {
+        case ('n'):
+            return '\n';
+
+        case ('t'):
+            return '\t';
+
+        case ('r'):
+            return '\r';
+
+        case ('s'):
+            return '\0';
+
+        case ('\''):
+            return '\'';
+
+        case ('\"'):
+            return '\"';
+
+        case ('\\'):
+            return '\\';
+        
+        default:
+            _SET_SetError(_SET_ERRORID_CONVERTSPECIALCHAR_UNKNOWN, _SET_ERRORMES_UNKNOWNSPECIAL, Char);
+            return EOF;
+    }
+}
+
+SET_Data _SET_ConvertChar(const char *String)
+{
+    SET_Data Value;
+    SET_InitData(&Value);
+
+    // Check if it needs a special char
+    if (String[1] == '\\')
+    {
+        char Char = _SET_ConvertSpecialChar(String[2]);
+
+        if (Char == EOF || Char == '\0')
+        {
+            _SET_AddError(_SET_ERRORID_CONVERTCHAR_SPECIAL, _SET_ERRORMES_CONVERTSPECIALCHAR, String);
+            return Value;
+        }
+
+        Value.data.c = Char;
+    }
+
+    else
+        Value.data.c = String[1];
+
+    Value.type = SET_DATATYPE_CHAR;
+    return Value;
+}
+
+SET_Data _SET_ConvertString(const char *String, ARN_Arena *Arena)
+{
+    SET_Data Value;
+    SET_InitData(&Value);
+
+    // Allocate memory
+    size_t Length = strlen(String) - 2;
+
+    char *NewString;
+
+    if (Arena != NULL)
+        NewString = (char *)ARN_AllocAligned(Arena, sizeof(char) * (Length + 1), 1);
+
+    else
+        NewString = (char *)malloc(sizeof(char) * (Length + 1));
+
+    if (NewString == NULL)
+    {
+        _SET_SetError(_SET_ERRORID_CONVERTSTRING_MALLOC, _SET_ERRORMES_MALLOC, sizeof(char) * (Length + 1));
+        return Value;
+    }
+
+    // Go through and copy
+    char *Dst = NewString;
+    for (const char *Src = String + 1; *Src != '\"'; ++Src, ++Dst)
+    {
+        // If it is a special char
+        if (*Src == '\\')
+        {
+            char NewChar = _SET_ConvertSpecialChar(*(++Src));
+
+            if (NewChar == EOF)
+            {
+                _SET_AddError(_SET_ERRORID_CONVERTSTRING_SPECIAL, _SET_ERRORMES_CONVERTSPECIALCHAR, String);
+                if (Arena == NULL)
+                    free(NewString);
+                return Value;
+            }
 
-    else if (Length >= 2 && String[1] == 'b')
-        Value = _SET_ReadBin(String + 2);
+            else if (NewChar != '\0')
+                *Dst = NewChar;
+
+            else
+                --Dst;
+        }
+
+        else
+            *Dst = *Src;
+    }
+
+    *(Dst++) = '\0';
+
+    // Strings in an arena keep their size since the memory cannot be given back
+    if (Arena != NULL)
+        Value.data.str = NewString;
 
     else
-        Value = _SET_ReadUint(String);
+        Value.data.str = (char *)realloc(NewString, sizeof(char) * (Dst - NewString));
 
-    if (Value.type == SET_DATATYPE_NONE)
+    Value.type = SET_DATATYPE_STR;
+    return Value;
+}
+
+bool SET_SaveSettings(const char *FileName, SET_DataStruct *Struct)
+{
+    SET_TextWriter Writer;
+    SET_InitTextWriter(&Writer);
+    Writer.fileName = FileName;
+
+    // Get the buffer
+    Writer.buffer = (char *)malloc(sizeof(char) * _SET_WRITESIZE);
+
+    if (Writer.buffer == NULL)
     {
-        _SET_SetError(_SET_ERRORID_CONVERTUINT_CONVERT, _SET_ERRORMES_NUMBERCONVERT);
-        return Value;
+        _SET_AddErrorForeign(_SET_ERRORID_SAVESETTINGS_MALLOC, strerror(errno), _SET_ERRORMES_MALLOC, sizeof(char) * _SET_WRITESIZE);
+        return false;
     }
 
-    // Convert it to the lowest possible type
-    if (Value.data.u64 <= _SET_HIGH_INT8)
+    // Open the file
+    Writer.file = fopen(FileName, "wb");
+
+    if (Writer.file == NULL)
     {
-        Value.data.u8 = (uint8_t)Value.data.u64;
-        Value.type = SET_DATATYPE_INT8;
+        _SET_AddErrorForeign(_SET_ERRORID_SAVESETTINGS_OPEN, strerror(errno), _SET_ERRORMES_OPENFILE, FileName);
+        free(Writer.buffer);
+        return false;
+    }
+
+    // Write the fields and what is left in the buffer
+    if (!_SET_SaveFields(&Writer, Struct, 0) || !_SET_WriteFlush(&Writer))
+    {
+        _SET_AddError(_SET_ERRORID_SAVESETTINGS_SAVE, _SET_ERRORMES_SAVEFILE, FileName);
+        fclose(Writer.file);
+        free(Writer.buffer);
+        return false;
+    }
+
+    free(Writer.buffer);
+
+    if (fclose(Writer.file) != 0)
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_SAVESETTINGS_WRITE, strerror(errno), _SET_ERRORMES_WRITEFILE, FileName);
+        return false;
+    }
+
+    return true;
+}
+
+bool _SET_WriteFlush(SET_TextWriter *Writer)
+{
+    if (Writer->size > 0 && fwrite(Writer->buffer, sizeof(char), Writer->size, Writer->file) != Writer->size)
+    {
+        _SET_AddErrorForeign(_SET_ERRORID_WRITEFLUSH_WRITE, strerror(errno), _SET_ERRORMES_WRITEFILE, Writer->fileName);
+        return false;
+    }
+
+    Writer->size = 0;
+    return true;
+}
+
+static inline char *_SET_WriteReserve(SET_TextWriter *Writer, size_t Size)
+{
+    if (Writer->size + Size > _SET_WRITESIZE && !_SET_WriteFlush(Writer))
+        return NULL;
+
+    return Writer->buffer + Writer->size;
+}
+
+static inline bool _SET_WriteText(SET_TextWriter *Writer, const char *Text, size_t Length)
+{
+    // Fill up the buffer until the rest fits
+    while (Writer->size + Length > _SET_WRITESIZE)
+    {
+        size_t Part = _SET_WRITESIZE - Writer->size;
+        memcpy(Writer->buffer + Writer->size, Text, sizeof(char) * Part);
+        Writer->size += Part;
+        Text += Part;
+        Length -= Part;
+
+        if (!_SET_WriteFlush(Writer))
+            return false;
+    }
+
+    memcpy(Writer->buffer + Writer->size, Text, sizeof(char) * Length);
+    Writer->size += Length;
+
+    return true;
+}
+
+bool _SET_WriteIndent(SET_TextWriter *Writer, uint32_t Indent)
+{
+    for (size_t Length = (size_t)Indent * _SET_INDENTSIZE; Length > 0;)
+    {
+        size_t Part = ((Length < _SET_WRITESIZE) ? (Length) : (_SET_WRITESIZE));
+        char *Buffer = _SET_WriteReserve(Writer, Part);
+
+        if (Buffer == NULL)
+            return false;
+
+        memset(Buffer, ' ', sizeof(char) * Part);
+        Writer->size += Part;
+        Length -= Part;
+    }
+
+    return true;
+}
+
+bool _SET_SaveFields(SET_TextWriter *Writer, SET_DataStruct *Struct, uint32_t Indent)
+{
+    DIC_ForEach(Struct, Item)
+    {
+        if (!_SET_SaveName(Writer, Item.key, (const SET_Data *)Item.value, Indent))
+        {
+            _SET_AddError(_SET_ERRORID_SAVEFIELDS_NAME, _SET_ERRORMES_SAVEFIELD, Item.key);
+            return false;
+        }
+
+        if (!_SET_SaveValue(Writer, (const SET_Data *)Item.value, Indent))
+        {
+            _SET_AddError(_SET_ERRORID_SAVEFIELDS_VALUE, _SET_ERRORMES_SAVEFIELD, Item.key);
+            return false;
+        }
+
+        if (!_SET_WriteText(Writer, ";\n", 2))
+        {
+            _SET_AddError(_SET_ERRORID_SAVEFIELDS_WRITE, _SET_ERRORMES_SAVEFIELD, Item.key);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool _SET_SaveName(SET_TextWriter *Writer, const char *Name, const SET_Data *Data, uint32_t Indent)
+{
+    // Lists are declared with the type of the elements and a * for each level
+    uint32_t Depth = ((Data->type == SET_DATATYPE_LIST) ? (Data->data.list->depth) : (0));
+    const char *TypeName = _SET_DeclaredType(Data);
+
+    // The name must be read back as a single word, if it is empty the type would be read as the name
+    size_t Length = strlen(Name);
+
+    if (_SET_WordLength(Name) != Length || (Length == 0 && TypeName != NULL))
+    {
+        _SET_SetError(_SET_ERRORID_SAVENAME_NAME, _SET_ERRORMES_SAVENAME, Name);
+        return false;
+    }
+
+    if (!_SET_WriteIndent(Writer, Indent))
+    {
+        _SET_AddError(_SET_ERRORID_SAVENAME_WRITE, _SET_ERRORMES_SAVEFIELD, Name);
+        return false;
+    }
+
+    if (TypeName != NULL)
+    {
+        if (!_SET_WriteText(Writer, TypeName, strlen(TypeName)))
+        {
+            _SET_AddError(_SET_ERRORID_SAVENAME_WRITE, _SET_ERRORMES_SAVEFIELD, Name);
+            return false;
+        }
+
+        for (uint32_t Level = 0; Level < Depth; ++Level)
+            if (!_SET_WriteText(Writer, "*", 1))
+            {
+                _SET_AddError(_SET_ERRORID_SAVENAME_WRITE, _SET_ERRORMES_SAVEFIELD, Name);
+                return false;
+            }
+
+        if (!_SET_WriteText(Writer, " ", 1))
+        {
+            _SET_AddError(_SET_ERRORID_SAVENAME_WRITE, _SET_ERRORMES_SAVEFIELD, Name);
+            return false;
+        }
+    }
+
+    if (!_SET_WriteText(Writer, Name, Length) || !_SET_WriteText(Writer, " = ", 3))
+    {
+        _SET_AddError(_SET_ERRORID_SAVENAME_WRITE, _SET_ERRORMES_SAVEFIELD, Name);
+        return false;
+    }
+
+    return true;
+}
+
+bool _SET_SaveValue(SET_TextWriter *Writer, const SET_Data *Data, uint32_t Indent)
+{
+    // Numbers are written straight into the buffer
+    if (Data->type >= SET_DATATYPE_INT8 && Data->type <= SET_DATATYPE_FLOAT)
+    {
+        if ((Data->type == SET_DATATYPE_DOUBLE && !isfinite(Data->data.d)) || (Data->type == SET_DATATYPE_FLOAT && !isfinite(Data->data.f)))
+        {
+            _SET_SetError(_SET_ERRORID_SAVEVALUE_FINITE, _SET_ERRORMES_SAVEFINITE, ((Data->type == SET_DATATYPE_DOUBLE) ? (Data->data.d) : ((double)Data->data.f)));
+            return false;
+        }
+
+        char *Buffer = _SET_WriteReserve(Writer, _SET_NUMBERSIZE);
+
+        if (Buffer == NULL)
+        {
+            _SET_AddError(_SET_ERRORID_SAVEVALUE_WRITE, _SET_ERRORMES_SAVEVALUE, Data->type);
+            return false;
+        }
+
+        switch (Data->type)
+        {
+            case (SET_DATATYPE_INT8):
+            case (SET_DATATYPE_UINT8):
+                Writer->size += _SET_FormatUint(Buffer, Data->data.u8);
+                break;
+
+            case (SET_DATATYPE_INT16):
+            case (SET_DATATYPE_UINT16):
+                Writer->size += _SET_FormatUint(Buffer, Data->data.u16);
+                break;
+
+            case (SET_DATATYPE_INT32):
+            case (SET_DATATYPE_UINT32):
+                Writer->size += _SET_FormatUint(Buffer, Data->data.u32);
+                break;
+
+            case (SET_DATATYPE_INT64):
+            case (SET_DATATYPE_UINT64):
+                Writer->size += _SET_FormatUint(Buffer, Data->data.u64);
+                break;
+
+            case (SET_DATATYPE_SINT8):
+                Writer->size += _SET_FormatSint(Buffer, Data->data.i8);
+                break;
+
+            case (SET_DATATYPE_SINT16):
+                Writer->size += _SET_FormatSint(Buffer, Data->data.i16);
+                break;
+
+            case (SET_DATATYPE_SINT32):
+                Writer->size += _SET_FormatSint(Buffer, Data->data.i32);
+                break;
+
+            case (SET_DATATYPE_SINT64):
+                Writer->size += _SET_FormatSint(Buffer, Data->data.i64);
+                break;
+
+            case (SET_DATATYPE_DOUBLE):
+                Writer->size += _SET_FormatDouble(Buffer, Data->data.d);
+                break;
+
+            default:
+                Writer->size += _SET_FormatFloat(Buffer, Data->data.f);
+                break;
+        }
+
+        return true;
+    }
+
+    bool Written;
+
+    switch (Data->type)
+    {
+        case (SET_DATATYPE_BOOL):
+            if (Data->data.b)
+                Written = _SET_WriteText(Writer, _SET_TRUENAME, sizeof(_SET_TRUENAME) - 1);
+
+            else
+                Written = _SET_WriteText(Writer, _SET_FALSENAME, sizeof(_SET_FALSENAME) - 1);
+
+            break;
+
+        case (SET_DATATYPE_CHAR):
+            if (Data->data.c == '\0')
+            {
+                _SET_SetError(_SET_ERRORID_SAVEVALUE_CHAR, _SET_ERRORMES_SAVECHAR);
+                return false;
+            }
+
+            Written = _SET_SaveString(Writer, &Data->data.c, 1, '\'');
+            break;
+
+        case (SET_DATATYPE_STR):
+            Written = _SET_SaveString(Writer, Data->data.str, strlen(Data->data.str), '\"');
+            break;
+
+        // The fields of a struct are placed on lines of their own
+        case (SET_DATATYPE_STRUCT):
+            if (DIC_DictLength(Data->data.stct) == 0)
+            {
+                Written = _SET_WriteText(Writer, "{}", 2);
+                break;
+            }
+
+            if (!_SET_WriteText(Writer, "{\n", 2))
+            {
+                Written = false;
+                break;
+            }
+
+            if (!_SET_SaveFields(Writer, Data->data.stct, Indent + 1))
+            {
+                _SET_AddError(_SET_ERRORID_SAVEVALUE_STRUCT, _SET_ERRORMES_CONVERTSTRUCT);
+                return false;
+            }
+
+            Written = _SET_WriteIndent(Writer, Indent) && _SET_WriteText(Writer, "}", 1);
+            break;
+
+        // The elements of a list are placed after each other
+        case (SET_DATATYPE_LIST):
+        {
+            const SET_DataList *List = Data->data.list;
+
+            if (List->count == 0)
+            {
+                _SET_SetError(_SET_ERRORID_SAVEVALUE_NOELEMENTS, _SET_ERRORMES_NOELEMENTS);
+                return false;
+            }
+
+            if (!_SET_WriteText(Writer, "[", 1))
+            {
+                Written = false;
+                break;
+            }
+
+            for (uint32_t Pos = 0; Pos < List->count; ++Pos)
+            {
+                if (Pos > 0 && !_SET_WriteText(Writer, ", ", 2))
+                {
+                    _SET_AddError(_SET_ERRORID_SAVEVALUE_WRITE, _SET_ERRORMES_SAVEVALUE, Data->type);
+                    return false;
+                }
+
+                SET_Data Element = SET_ListElement(List, Pos);
+
+                if (!_SET_SaveValue(Writer, &Element, Indent))
+                {
+                    _SET_AddError(_SET_ERRORID_SAVEVALUE_ELEMENT, _SET_ERRORMES_SAVEELEMENT, _SET_ELEMENTPREMES, (size_t)Pos);
+                    return false;
+                }
+            }
+
+            Written = _SET_WriteText(Writer, "]", 1);
+            break;
+        }
+
+        default:
+            _SET_SetError(_SET_ERRORID_SAVEVALUE_TYPE, _SET_ERRORMES_WRONGTYPE, (uint32_t)Data->type);
+            return false;
     }
 
-    else if (Value.data.u64 <= _SET_HIGH_UINT8)
+    if (!Written)
     {
-        Value.data.u8 = (uint8_t)Value.data.u64;
-        Value.type = SET_DATATYPE_UINT8;
+        _SET_AddError(_SET_ERRORID_SAVEVALUE_WRITE, _SET_ERRORMES_SAVEVALUE, Data->type);
+        return false;
     }
 
-    else if (Value.data.u64 <= _SET_HIGH_INT16)
-    {
-        Value.data.u16 = (uint16_t)Value.data.u64;
-        Value.type = SET_DATATYPE_INT16;
-    }
+    return true;
+}
 
-    else if (Value.data.u64 <= _SET_HIGH_UINT16)
-    {
-        Value.data.u16 = (uint16_t)Value.data.u64;
-        Value.type = SET_DATATYPE_UINT16;
-    }
+bool _SET_SaveString(SET_TextWriter *Writer, const char *String, size_t Length, char Quote)
+{
+    extern const uint8_t _SET_CharClass[];
 
-    else if (Value.data.u64 <= _SET_HIGH_INT32)
-    {
-        Value.data.u32 = (uint32_t)Value.data.u64;
-        Value.type = SET_DATATYPE_INT32;
-    }
+    if (!_SET_WriteText(Writer, &Quote, 1))
+        return false;
 
-    else if (Value.data.u64 <= _SET_HIGH_UINT32)
+    const char *End = String + Length;
+
+    for (const char *Start = String;;)
     {
-        Value.data.u32 = (uint32_t)Value.data.u64;
-        Value.type = SET_DATATYPE_UINT32;
-    }
+        // Copy everything up to the next character which would be changed by loading, only the quote in use ends it
+        const char *Current = Start;
 
-    else if (Value.data.u64 <= _SET_HIGH_INT64)
-        Value.type = SET_DATATYPE_INT64;
+        for (; Current < End && (!(_SET_CharClass[(uint8_t)*Current] & _SET_CHARCLASS_STRING) || ((*Current == '\'' || *Current == '\"') && *Current != Quote)); ++Current)
+            ;
 
-    return Value;
-}
+        if (!_SET_WriteText(Writer, Start, Current - Start))
+            return false;
 
-SET_Data _SET_ReadUint(const char *String)
-{
-    SET_Data Value;
-    Value.type = SET_DATATYPE_NONE;
-    Value.data.u64 = 0;
+        if (Current == End)
+            break;
 
-    // Get the length
-    if (strlen(String) == 0)
-    {
-        _SET_AddError(_SET_ERRORID_READUINT_NOSTRING, _SET_ERRORMES_NOVALUE2);
-        return Value;
-    }
+        // Write it as a special character
+        char Special[2] = {'\\', *Current};
 
-    // Remove leading 0
-    for (; *String == '0'; ++String)
-        ;
+        if (*Current == '\n')
+            Special[1] = 'n';
 
-    // Start reading
-    for (const char *NewString = String; *NewString != '\0'; ++NewString)
-    {
-        if (Value.data.u64 > _SET_HIGH_UINT64 / 10)
-        {
-            _SET_SetError(_SET_ERRORID_READUINT_HIGH, _SET_ERRORMES_HIGHNUMBER, _SET_HIGH_UINT64, String);
-            return Value;
-        }
+        else if (*Current == '\t')
+            Special[1] = 't';
 
-        uint64_t NewInt = Value.data.u64 * 10 + *NewString - '0';
+        else if (*Current == '\r')
+            Special[1] = 'r';
 
-        if (NewInt < Value.data.u64)
-        {
-            _SET_SetError(_SET_ERRORID_READUINT_HIGH2, _SET_ERRORMES_HIGHNUMBER, _SET_HIGH_UINT64, String);
-            return Value;
-        }
+        if (!_SET_WriteText(Writer, Special, 2))
+            return false;
 
-        Value.data.u64 = NewInt;
+        Start = Current + 1;
     }
 
-    Value.type = SET_DATATYPE_UINT64;
-    return Value;
+    return _SET_WriteText(Writer, &Quote, 1);
 }
 
-SET_Data _SET_ReadHex(const char *String)
+const char *_SET_DeclaredType(const SET_Data *Data)
 {
-    SET_Data Value;
-    Value.type = SET_DATATYPE_NONE;
-    Value.data.u64 = 0;
-
-    // Get the length
-    if (strlen(String) == 0)
-    {
-        _SET_AddError(_SET_ERRORID_READHEX_NOSTRING, _SET_ERRORMES_NOVALUE2);
-        return Value;
-    }
-
-    // Remove leading 0
-    for (; *String == '0'; ++String)
-        ;
+    extern char *_SET_TypeNames[];
+    extern SET_DataType _SET_Types[];
 
-    // Make sure it is not too large
-    if (strlen(String) > sizeof(uint64_t) * 2)
-    {
-        _SET_SetError(_SET_ERRORID_READHEX_HIGH, _SET_ERRORMES_HIGHHEX, _SET_HIGH_UINT64, String);
-        return Value;
-    }
+    SET_DataType Type = ((Data->type == SET_DATATYPE_LIST) ? (Data->data.list->type) : (Data->type));
 
-    // Read
-    for (const char *NewString = String; *NewString != '\0'; ++NewString)
+    // Other values can only be loaded as one type
+    switch (Type)
     {
-        Value.data.u64 *= 0x10;
+        // Integers without a sign are loaded as the smallest type which fits
+        case (SET_DATATYPE_INT8):
+        case (SET_DATATYPE_INT16):
+        case (SET_DATATYPE_INT32):
+        case (SET_DATATYPE_INT64):
+            if (_SET_LoadedIntType(Data) == Type)
+                return NULL;
 
-        if (*NewString >= '0' && *NewString <= '9')
-            Value.data.u64 += *NewString - '0';
+            break;
 
-        else if (*NewString >= 'a' && *NewString <= 'f')
-            Value.data.u64 += *NewString - 'a' + 0xA;
+        case (SET_DATATYPE_UINT8):
+        case (SET_DATATYPE_UINT16):
+        case (SET_DATATYPE_UINT32):
+        case (SET_DATATYPE_UINT64):
+        case (SET_DATATYPE_SINT8):
+        case (SET_DATATYPE_SINT16):
+        case (SET_DATATYPE_SINT32):
+        case (SET_DATATYPE_SINT64):
+        case (SET_DATATYPE_FLOAT):
+            break;
 
-        else
-            Value.data.u64 += *NewString - 'A' + 0xA;
+        default:
+            return NULL;
     }
 
-    Value.type = SET_DATATYPE_UINT64;
-    return Value;
+    for (size_t Pos = 0; Pos < _SET_TYPECOUNT; ++Pos)
+        if (_SET_Types[Pos] == Type)
+            return _SET_TypeNames[Pos];
+
+    return NULL;
 }
 
-SET_Data _SET_ReadBin(const char *String)
+SET_DataType _SET_LoadedIntType(const SET_Data *Data)
 {
-    SET_Data Value;
-    Value.type = SET_DATATYPE_NONE;
-    Value.data.u64 = 0;
+    uint64_t Value;
 
-    // Get the length
-    if (strlen(String) == 0)
+    switch (Data->type)
     {
-        _SET_AddError(_SET_ERRORID_READBIN_NOSTRING, _SET_ERRORMES_NOVALUE2);
-        return Value;
-    }
+        // The elements of a list are loaded as the largest type of them, but the lists in a list must all be loaded as the same type
+        case (SET_DATATYPE_LIST):
+        {
+            SET_DataType Type = SET_DATATYPE_BOOL;
 
-    // Remove leading 0
-    for (; *String == '0'; ++String)
-        ;
+            for (uint32_t Pos = 0; Pos < Data->data.list->count; ++Pos)
+            {
+                SET_Data Element = SET_ListElement(Data->data.list, Pos);
+                SET_DataType ElementType = _SET_LoadedIntType(&Element);
 
-    // Make sure it is not too large
-    if (strlen(String) > sizeof(uint64_t) * 8)
-    {
-        _SET_SetError(_SET_ERRORID_READBIN_HIGH, _SET_ERRORMES_HIGHHEX, _SET_HIGH_UINT64, String);
-        return Value;
-    }
+                if (Data->data.list->depth > 1 && Pos > 0 && ElementType != Type)
+                    return SET_DATATYPE_NONE;
 
-    // Read
-    for (const char *NewString = String; *NewString != '\0'; ++NewString)
-        Value.data.u64 = Value.data.u64 * 2 + *NewString - '0';
+                if (ElementType > Type || Data->data.list->depth > 1)
+                    Type = ElementType;
+            }
 
-    Value.type = SET_DATATYPE_UINT64;
-    return Value;
-}
+            return Type;
+        }
 
-SET_Data _SET_ReadSint(const char *String)
-{
-    bool Negative = false;
+        case (SET_DATATYPE_INT8):
+            Value = Data->data.u8;
+            break;
 
-    // Check if it is negative
-    if (*String == '-')
-        Negative = true;
+        case (SET_DATATYPE_INT16):
+            Value = Data->data.u16;
+            break;
 
-    // Read the positive part
-    SET_Data Value = _SET_ReadUint(String + Negative);
+        case (SET_DATATYPE_INT32):
+            Value = Data->data.u32;
+            break;
 
-    if (Value.type == SET_DATATYPE_NONE)
-    {
-        _SET_AddError(_SET_ERRORID_READSINT_UINT, _SET_ERRORMES_NUMBERCONVERT);
-        return Value;
+        default:
+            Value = Data->data.u64;
+            break;
     }
 
-    // Make sure it is not too large
-    if (Value.data.u64 > _SET_HIGH_INT64 + ((Negative) ? (1) : (0)))
-    {
-        _SET_SetError(_SET_ERRORID_READSINT_HIGH, _SET_ERRORMES_HIGHNUMBERSIGNED, ((Negative) ? ("small") : ("large")), ((Negative) ? ("Min") : ("Max")), (_SET_HIGH_INT64 + Negative) * ((Negative) ? (-1) : (1)), String);
-        Value.type = SET_DATATYPE_NONE;
-        return Value;
-    }
+    // 0 and 1 are bools, the rest is the same as _SET_ConvertUint
+    if (Value <= 1)
+        return SET_DATATYPE_BOOL;
 
-    // Convert to signed int
-    Value.data.i64 = (int64_t)Value.data.u64 * ((Negative) ? (-1) : (1));
-    Value.type = SET_DATATYPE_SINT64;
-    return Value;
+    if (Value <= _SET_HIGH_INT8)
+        return SET_DATATYPE_INT8;
+
+    if (Value <= _SET_HIGH_UINT8)
+        return SET_DATATYPE_UINT8;
+
+    if (Value <= _SET_HIGH_INT16)
+        return SET_DATATYPE_INT16;
+
+    if (Value <= _SET_HIGH_UINT16)
+        return SET_DATATYPE_UINT16;
+
+    if (Value <= _SET_HIGH_INT32)
+        return SET_DATATYPE_INT32;
+
+    if (Value <= _SET_HIGH_UINT32)
+        return SET_DATATYPE_UINT32;
+
+    return SET_DATATYPE_INT64;
 }
 
-SET_Data _SET_ConvertSint(const char *String)
+static inline size_t _SET_DigitCount(uint64_t Value)
 {
-    // Read
-    SET_Data Value = _SET_ReadSint(String);
+    extern const uint64_t _SET_Pow10Int[];
 
-    if (Value.type == SET_DATATYPE_NONE)
-    {
-        _SET_SetError(_SET_ERRORID_CONVERTSINT_READ, _SET_ERRORMES_NUMBERCONVERT);
-        return Value;
-    }
+    // Guess from the number of bits, the guess is at most 1 too small
+    Value |= 1;
+    size_t Count = ((64 - __builtin_clzll(Value)) * 1233) >> 12;
 
-    // Find the correct type
-    bool Negative = ((Value.data.i64 < 0) ? (true) : (false));
-    uint64_t Pos = (uint64_t)Value.data.i64 * ((Negative) ? (-1) : (1));
+    return Count + (Value >= _SET_Pow10Int[Count]);
+}
 
-    if (Pos <= _SET_HIGH_INT8 + Negative)
-    {
-        Value.data.i8 = (int8_t)Value.data.i64;
-        Value.type = SET_DATATYPE_SINT8;
-    }
+static inline void _SET_WriteDigits(char *Buffer, uint64_t Value, size_t Count)
+{
+    extern const char _SET_DigitPairs[];
 
-    else if (Pos <= _SET_HIGH_INT16 + Negative)
-    {
-        Value.data.i16 = (int16_t)Value.data.i64;
-        Value.type = SET_DATATYPE_SINT16;
-    }
+    char *Current = Buffer + Count;
 
-    else if (Pos <= _SET_HIGH_INT32 + Negative)
+    for (; Value >= 100; Value /= 100)
     {
-        Value.data.i32 = (int32_t)Value.data.i64;
-        Value.type = SET_DATATYPE_SINT32;
+        Current -= 2;
+        memcpy(Current, _SET_DigitPairs + 2 * (Value % 100), 2);
     }
 
-    else
-        Value.type = SET_DATATYPE_SINT64;
+    if (Value >= 10)
+        memcpy(Current - 2, _SET_DigitPairs + 2 * Value, 2);
 
-    return Value;
+    else
+        *(Current - 1) = '0' + (char)Value;
 }
 
-SET_Data _SET_ConvertFloat(const char *String)
+size_t _SET_FormatUint(char *Buffer, uint64_t Value)
 {
-    bool Negative = false;
-
-    // Check if it is negative
-    if (*String == '-')
-        Negative = true;
+    size_t Count = _SET_DigitCount(Value);
+    _SET_WriteDigits(Buffer, Value, Count);
 
-    // Read number
-    const char *NewString;
-    SET_Data Value;
-    Value.data.d = 0.;
-    Value.type = SET_DATATYPE_NONE;
+    return Count;
+}
 
-    for (NewString = String + Negative; *NewString != '\0' && *NewString != '.' && *NewString != 'e' && *NewString != 'E'; ++NewString)
-        Value.data.d = Value.data.d * 10. + (double)(*NewString - '0');
+size_t _SET_FormatSint(char *Buffer, int64_t Value)
+{
+    if (Value >= 0)
+        return _SET_FormatUint(Buffer, (uint64_t)Value);
 
-    // Add after .
-    if (*NewString == '.')
-    {
-        ++NewString;
+    // Negate as unsigned so the lowest number does not overflow
+    *Buffer = '-';
+    return _SET_FormatUint(Buffer + 1, (uint64_t)0 - (uint64_t)Value) + 1;
+}
 
-        for (double Size = 0.1; *NewString != '\0' && *NewString != 'e' && *NewString != 'E'; ++NewString, Size /= 10.)
-            Value.data.d += (double)(*NewString - '0') * Size;
-    }
+size_t _SET_FormatDouble(char *Buffer, double Value)
+{
+    uint64_t Bits;
+    memcpy(&Bits, &Value, sizeof(double));
 
-    if (Negative)
-        Value.data.d *= -1.;
+    bool Negative = (Bits >> 63) != 0;
+    uint64_t Mantissa = Bits & (((uint64_t)1 << 52) - 1);
+    int32_t Exponent = (int32_t)((Bits >> 52) & 0x7FF);
 
-    // Add exponentiation
-    if (*NewString == 'e' || *NewString == 'E')
+    // Zero has no significant digits
+    if (Mantissa == 0 && Exponent == 0)
     {
-        // Convert int
-        SET_Data Exp = _SET_ReadSint(NewString + 1);
-
-        if (Exp.type == SET_DATATYPE_NONE)
+        if (Negative)
         {
-            _SET_AddError(_SET_ERRORID_CONVERTFLOAT_EXP, _SET_ERRORMES_CONVERTEXP, String);
-            return Value;
+            memcpy(Buffer, "-0.0", 4);
+            return 4;
         }
 
-        // Change the value
-        Value.data.d *= pow(10., (double)Exp.data.i64);
+        memcpy(Buffer, "0.0", 3);
+        return 3;
     }
 
-    // Check if it is finite
-    if (!isfinite(Value.data.d))
-    {
-        _SET_SetError(_SET_ERRORID_CONVERTFLOAT_FINITE, _SET_ERRORMES_FINITE, String);
-        return Value;
-    }
+    // The lower neighbour is closer for powers of 2 since the exponent changes, subnormal numbers have no hidden bit
+    bool LowerGap = (Mantissa != 0 || Exponent <= 1);
+    int32_t Exp10;
+    uint64_t Digits;
 
-    Value.type = SET_DATATYPE_DOUBLE;
-    return Value;
+    if (Exponent == 0)
+        Digits = _SET_ShortestDecimal(Mantissa, 1 - 1023 - 52, LowerGap, &Exp10);
+
+    else
+        Digits = _SET_ShortestDecimal(Mantissa | ((uint64_t)1 << 52), Exponent - 1023 - 52, LowerGap, &Exp10);
+
+    return _SET_FormatDecimal(Buffer, Negative, Digits, Exp10);
 }
 
-char _SET_ConvertSpecialChar(char Char)
+size_t _SET_FormatFloat(char *Buffer, float Value)
 {
-    // Figure out what it is
-    switch (Char)
+    uint32_t Bits;
+    memcpy(&Bits, &Value, sizeof(float));
+
+    bool Negative = (Bits >> 31) != 0;
+    uint64_t Mantissa = Bits & (((uint32_t)1 << 23) - 1);
+    int32_t Exponent = (int32_t)((Bits >> 23) & 0xFF);
+
+    // Zero has no significant digits
+    if (Mantissa == 0 && Exponent == 0)
     {
-        case ('n'):
-            return '\n';
+        if (Negative)
+        {
+            memcpy(Buffer, "-0.0", 4);
+            return 4;
+        }
 
-        case ('t'):
-            return '\t';
+        memcpy(Buffer, "0.0", 3);
+        return 3;
+    }
+
+    // The digits are found with the same algorithm as for doubles, only the bounds are closer
+    bool LowerGap = (Mantissa != 0 || Exponent <= 1);
+    int32_t Exp10;
+    uint64_t Digits;
+
+    if (Exponent == 0)
+        Digits = _SET_ShortestDecimal(Mantissa, 1 - 127 - 23, LowerGap, &Exp10);
 
-        case ('s'):
-            return '\0';
+    else
+        Digits = _SET_ShortestDecimal(Mantissa | ((uint64_t)1 << 23), Exponent - 127 - 23, LowerGap, &Exp10);
 
-        case ('\''):
-            return '\'';
+    size_t Length = _SET_FormatDecimal(Buffer, Negative, Digits, Exp10);
 
-        case ('\"'):
-            return '\"';
+    // Floats are loaded as doubles first, for a few values rounding twice gives another float so the digits of the double are used
+    double Loaded;
 
-        case ('\\'):
-            return '\\';
-        
-        default:
-            _SET_SetError(_SET_ERRORID_CONVERTSPECIALCHAR_UNKNOWN, _SET_ERRORMES_UNKNOWNSPECIAL, Char);
-            return EOF;
+    if (!_SET_EiselLemire(&Loaded, Digits, Exp10))
+    {
+        Buffer[Length] = '\0';
+        Loaded = _SET_Strtod(Buffer + Negative);
     }
+
+    if ((float)Loaded != fabsf(Value))
+        return _SET_FormatDouble(Buffer, (double)Value);
+
+    return Length;
 }
 
-SET_Data _SET_ConvertChar(const char *String)
+size_t _SET_FormatDecimal(char *Buffer, bool Negative, uint64_t Digits, int32_t Exp)
 {
-    SET_Data Value;
-    SET_InitData(&Value);
+    char *Current = Buffer;
 
-    // Check if it needs a special char
-    if (String[1] == '\\')
+    if (Negative)
+        *Current++ = '-';
+
+    // The number of digits before the decimal point
+    int32_t Count = (int32_t)_SET_DigitCount(Digits);
+    int32_t Point = Count + Exp;
+
+    // Integers, zeros are added after the digits
+    if (Exp >= 0 && Point <= _SET_FIXEDMAX)
     {
-        char Char = _SET_ConvertSpecialChar(String[2]);
+        _SET_WriteDigits(Current, Digits, Count);
+        Current += Count;
+        memset(Current, '0', sizeof(char) * Exp);
+        Current += Exp;
+        memcpy(Current, ".0", 2);
+        Current += 2;
+    }
 
-        if (Char == EOF || Char == '\0')
-        {
-            _SET_AddError(_SET_ERRORID_CONVERTCHAR_SPECIAL, _SET_ERRORMES_CONVERTSPECIALCHAR, String);
-            return Value;
-        }
+    // The point is between the digits, the digits before it are moved to make room for it
+    else if (Exp < 0 && Point > 0)
+    {
+        _SET_WriteDigits(Current + 1, Digits, Count);
+        memmove(Current, Current + 1, sizeof(char) * Point);
+        Current[Point] = '.';
+        Current += Count + 1;
+    }
 
-        Value.data.c = Char;
+    // The point is before the digits
+    else if (Point <= 0 && Point > _SET_FIXEDMIN)
+    {
+        memcpy(Current, "0.", 2);
+        Current += 2;
+        memset(Current, '0', sizeof(char) * -Point);
+        Current -= Point;
+        _SET_WriteDigits(Current, Digits, Count);
+        Current += Count;
     }
 
+    // Write it with an exponent, the point is after the first digit
     else
-        Value.data.c = String[1];
+    {
+        _SET_WriteDigits(Current + 1, Digits, Count);
+        *Current = *(Current + 1);
 
-    Value.type = SET_DATATYPE_CHAR;
-    return Value;
+        if (Count > 1)
+        {
+            *(Current + 1) = '.';
+            Current += Count + 1;
+        }
+
+        else
+            ++Current;
+
+        *Current++ = 'e';
+        Current += _SET_FormatSint(Current, Point - 1);
+    }
+
+    return Current - Buffer;
 }
 
-SET_Data _SET_ConvertString(const char *String)
+uint64_t _SET_ShortestDecimal(uint64_t Mantissa, int32_t Exp2, bool LowerGap, int32_t *Exp10)
 {
-    SET_Data Value;
-    SET_InitData(&Value);
+    extern const uint64_t _SET_Pow5Split[];
+    extern const uint64_t _SET_Pow5InvSplit[];
+
+    // Work with 4 times the mantissa so the bounds half way to the neighbours are integers
+    Exp2 -= 2;
+    bool AcceptBounds = ((Mantissa & 1) == 0);
+    uint64_t Middle = 4 * Mantissa;
+    uint64_t LowerMiddle = Middle - 1 - LowerGap;
+    uint64_t Value;
+    uint64_t Upper;
+    uint64_t Lower;
+    bool ValueZeros = false;
+    bool LowerZeros = false;
+    int32_t Exp;
+
+    // Find the value and the bounds in decimal with q digits less than needed, the removed digits are only known to be 0 when they are a multiple of 10^q
+    if (Exp2 >= 0)
+    {
+        // Multiply by 2^Exp2 / 10^q
+        int32_t Q = (int32_t)(((uint32_t)Exp2 * 78913) >> 18) - (Exp2 > 3);
+        int32_t Shift = -Exp2 + Q + _SET_POW5INVBITS + (int32_t)(((uint32_t)Q * 1217359) >> 19);
+        const uint64_t *Mul = _SET_Pow5InvSplit + 2 * Q;
+
+        Exp = Q;
+        Value = _SET_MulShift(Middle, Mul, Shift);
+        Upper = _SET_MulShift(Middle + 2, Mul, Shift);
+        Lower = _SET_MulShift(LowerMiddle, Mul, Shift);
+
+        // Only one of the three can be a multiple of 5
+        if (Q <= 21)
+        {
+            if (Middle % 5 == 0)
+                ValueZeros = _SET_MultipleOfPow5(Middle, Q);
 
-    // Allocate memory
-    size_t Length = strlen(String) - 2;
+            else if (AcceptBounds)
+                LowerZeros = _SET_MultipleOfPow5(LowerMiddle, Q);
 
-    char *NewString = (char *)malloc(sizeof(char) * (Length + 1));
+            else
+                Upper -= _SET_MultipleOfPow5(Middle + 2, Q);
+        }
+    }
 
-    if (NewString == NULL)
+    else
     {
-        _SET_SetError(_SET_ERRORID_CONVERTSTRING_MALLOC, _SET_ERRORMES_MALLOC, sizeof(char) * (Length + 1));
-        return Value;
+        // Multiply by 5^-Exp2 / 10^q
+        int32_t Q = (int32_t)(((uint32_t)-Exp2 * 732923) >> 20) - (-Exp2 > 1);
+        int32_t Index = -Exp2 - Q;
+        int32_t Shift = Q - ((int32_t)(((uint32_t)Index * 1217359) >> 19) + 1 - _SET_POW5BITS);
+        const uint64_t *Mul = _SET_Pow5Split + 2 * Index;
+
+        Exp = Q + Exp2;
+        Value = _SET_MulShift(Middle, Mul, Shift);
+        Upper = _SET_MulShift(Middle + 2, Mul, Shift);
+        Lower = _SET_MulShift(LowerMiddle, Mul, Shift);
+
+        // The value has at least 2 zero bits so it is a multiple of 2^q for small q
+        if (Q <= 1)
+        {
+            ValueZeros = true;
+
+            if (AcceptBounds)
+                LowerZeros = LowerGap;
+
+            else
+                --Upper;
+        }
+
+        else if (Q < 63)
+            ValueZeros = ((Middle & (((uint64_t)1 << Q) - 1)) == 0);
     }
 
-    // Go through and copy
-    char *Dst = NewString;
-    for (const char *Src = String + 1; *Src != '\"'; ++Src, ++Dst)
+    // Remove digits as long as the bounds are still different
+    int32_t Removed = 0;
+    uint8_t LastDigit = 0;
+    uint64_t Output;
+
+    if (LowerZeros || ValueZeros)
     {
-        // If it is a special char
-        if (*Src == '\\')
+        // The rare case where ties and the bounds have to be handled exactly
+        for (; Upper / 10 > Lower / 10; ++Removed)
         {
-            char NewChar = _SET_ConvertSpecialChar(*(++Src));
+            LowerZeros &= (Lower % 10 == 0);
+            ValueZeros &= (LastDigit == 0);
+            LastDigit = (uint8_t)(Value % 10);
+            Value /= 10;
+            Upper /= 10;
+            Lower /= 10;
+        }
 
-            if (NewChar == EOF)
+        if (LowerZeros)
+            for (; Lower % 10 == 0; ++Removed)
             {
-                _SET_AddError(_SET_ERRORID_CONVERTSTRING_SPECIAL, _SET_ERRORMES_CONVERTSPECIALCHAR, String);
-                free(NewString);
-                return Value;
+                ValueZeros &= (LastDigit == 0);
+                LastDigit = (uint8_t)(Value % 10);
+                Value /= 10;
+                Upper /= 10;
+                Lower /= 10;
             }
 
-            else if (NewChar != '\0')
-                *Dst = NewChar;
+        // Exactly half way, round to even
+        if (ValueZeros && LastDigit == 5 && Value % 2 == 0)
+            LastDigit = 4;
 
-            else
-                --Dst;
+        Output = Value + ((Value == Lower && (!AcceptBounds || !LowerZeros)) || LastDigit >= 5);
+    }
+
+    else
+    {
+        // The common case, most numbers have several digits too many so 2 are removed at once first
+        bool RoundUp = false;
+
+        if (Upper / 100 > Lower / 100)
+        {
+            RoundUp = (Value % 100 >= 50);
+            Value /= 100;
+            Upper /= 100;
+            Lower /= 100;
+            Removed += 2;
         }
 
-        else
-            *Dst = *Src;
+        for (; Upper / 10 > Lower / 10; ++Removed)
+        {
+            RoundUp = (Value % 10 >= 5);
+            Value /= 10;
+            Upper /= 10;
+            Lower /= 10;
+        }
+
+        Output = Value + (Value == Lower || RoundUp);
     }
 
-    *(Dst++) = '\0';
-    Value.data.str = (char *)realloc(NewString, sizeof(char) * (Dst - NewString));
-    Value.type = SET_DATATYPE_STR;
-    return Value;
+    *Exp10 = Exp + Removed;
+    return Output;
+}
+
+static inline uint64_t _SET_MulShift(uint64_t Value, const uint64_t *Mul, int32_t Shift)
+{
+    // Only the high word of the product with the low word of Mul is needed
+    uint64_t LowHigh;
+    _SET_Mul128(Value, Mul[1], &LowHigh);
+
+    uint64_t High;
+    uint64_t Low = _SET_Mul128(Value, Mul[0], &High);
+    Low += LowHigh;
+    High += (Low < LowHigh);
+
+    Shift -= 64;
+    return (High << (64 - Shift)) | (Low >> Shift);
+}
+
+static inline bool _SET_MultipleOfPow5(uint64_t Value, int32_t Power)
+{
+    for (; Power > 0 && Value % 5 == 0; --Power)
+        Value /= 5;
+
+    return (Power <= 0);
 }
 
 void SET_InitData(SET_Data *Struct)
@@ -2884,6 +10483,7 @@ void SET_InitDataList(SET_DataList *Struct)
     Struct->list = NULL;
     Struct->depth = 0;
     Struct->type = SET_DATATYPE_NONE;
+    Struct->packed = NULL;
 }
 
 void SET_InitCodeStruct(SET_CodeStruct *Struct)
@@ -2920,6 +10520,84 @@ void SET_InitTranslationTable(SET_TranslationTable *Struct)
     Struct->type = SET_DATATYPE_NONE;
     Struct->depth = 0;
     Struct->count = 0;
+    Struct->length = 0;
+}
+
+void SET_InitStream(SET_Stream *Struct)
+{
+    Struct->pos = NULL;
+    Struct->line = 1;
+    Struct->arena = NULL;
+    Struct->view = false;
+    Struct->parallel = false;
+    Struct->types = NULL;
+}
+
+void SET_InitStreamField(SET_StreamField *Struct)
+{
+    Struct->name = NULL;
+    Struct->value = NULL;
+    Struct->line = 0;
+}
+
+void SET_InitSettings(SET_Settings *Struct)
+{
+    Struct->data = NULL;
+    Struct->arena = NULL;
+    Struct->text = NULL;
+    Struct->map = NULL;
+    Struct->mapSize = 0;
+}
+
+void SET_InitCacheWriter(SET_CacheWriter *Struct)
+{
+    Struct->data = NULL;
+    Struct->size = 0;
+    Struct->capacity = 0;
+}
+
+void SET_InitCacheReader(SET_CacheReader *Struct)
+{
+    Struct->data = NULL;
+    Struct->size = 0;
+    Struct->arena = NULL;
+    Struct->hashes = false;
+}
+
+void SET_InitWatchField(SET_WatchField *Struct)
+{
+    Struct->name = NULL;
+    Struct->start = 0;
+    Struct->length = 0;
+    Struct->hash = 0;
+    Struct->line = 0;
+}
+
+void SET_InitChange(SET_Change *Struct)
+{
+    Struct->name = NULL;
+    Struct->type = SET_CHANGETYPE_NONE;
+}
+
+void SET_InitDiff(SET_Diff *Struct)
+{
+    Struct->list = NULL;
+    Struct->count = 0;
+    Struct->old = NULL;
+}
+
+void SET_InitWatcher(SET_Watcher *Struct)
+{
+    Struct->fileName = NULL;
+    Struct->baseName = NULL;
+    Struct->fileID = -1;
+    Struct->watchID = -1;
+    Struct->data = NULL;
+    Struct->text = NULL;
+    Struct->fields = NULL;
+    Struct->count = 0;
+    Struct->index = NULL;
+    SET_InitDiff(&Struct->diff);
 }
 
 void SET_DestroyData(SET_Data *Struct)
@@ -2959,18 +10637,18 @@ void SET_DestroyDataList(SET_DataList *Struct)
         free(Struct->list);
     }
 
+    if (Struct->packed != NULL)
+        free(Struct->packed);
+
     free(Struct);
 }
 
 void SET_DestroyDataStruct(SET_DataStruct *Struct)
 {
-    for (DIC_LinkList **List = Struct->list, **EndList = Struct->list + Struct->length; List < EndList; ++List)
-        for (DIC_LinkList *Link = *List; Link != NULL; Link = Link->next)
-            if (Link->value != NULL)
-            {
-                SET_DestroyData((SET_Data *)Link->value);
-                Link->value = NULL;
-            }
+    // The values are stored as pointers so the dict does not free them
+    DIC_ForEach(Struct, Item)
+        if (Item.value != NULL)
+            SET_DestroyData((SET_Data *)Item.value);
 
     DIC_DestroyDict(Struct);
 }
@@ -3043,4 +10721,239 @@ void SET_DestroyCodeList(SET_CodeList *Struct)
     free(Struct);
 }
 
+void SET_DestroySettings(SET_Settings *Struct)
+{
+    // The entire tree is in the arena
+    if (Struct->arena != NULL)
+    {
+        ARN_DestroyArena(Struct->arena);
+        DIC_ReleaseHash();
+    }
+
+    if (Struct->text != NULL)
+        free(Struct->text);
+
+    if (Struct->map != NULL)
+        munmap(Struct->map, Struct->mapSize);
+
+    free(Struct);
+}
+
+void SET_DestroyLazySettings(SET_LazySettings *Struct)
+{
+    if (Struct->index != NULL)
+        DIC_DestroyDict(Struct->index);
+
+    if (Struct->types != NULL)
+        DIC_DestroyDict(Struct->types);
+
+    if (Struct->fields != NULL)
+    {
+        for (SET_LazyField *List = Struct->fields, *EndList = Struct->fields + Struct->count; List < EndList; ++List)
+            if (List->value != NULL)
+                SET_DestroyData(List->value);
+
+        free(Struct->fields);
+    }
+
+    if (Struct->text != NULL)
+        free(Struct->text);
+
+    free(Struct);
+}
+
+void SET_DestroyParser(SET_Parser *Struct)
+{
+    if (Struct->types != NULL)
+        DIC_DestroyDict(Struct->types);
+
+    if (Struct->buffer != NULL)
+        free(Struct->buffer);
+
+    free(Struct);
+}
+
+void SET_InitCompiledTable(SET_CompiledTable *Struct)
+{
+    Struct->table = NULL;
+    Struct->count = 0;
+    Struct->hashes = NULL;
+    Struct->seeds = NULL;
+    Struct->slots = NULL;
+    Struct->bucketShift = 64;
+    Struct->slotShift = 64;
+    Struct->sub = NULL;
+}
+
+void SET_InitLoadAlloc(SET_LoadAlloc *Struct)
+{
+    Struct->pointer = NULL;
+    Struct->location = NULL;
+}
+
+void SET_InitLoader(SET_Loader *Struct)
+{
+    SET_InitStream(&Struct->stream);
+    Struct->allocs = NULL;
+    Struct->count = 0;
+    Struct->capacity = 0;
+}
+
+void SET_InitParseChunk(SET_ParseChunk *Struct)
+{
+    SET_InitStream(&Struct->stream);
+    Struct->fields = NULL;
+    Struct->count = 0;
+}
+
+void SET_InitParseJob(SET_ParseJob *Struct)
+{
+    Struct->chunks = NULL;
+    Struct->count = 0;
+    atomic_init(&Struct->next, 0);
+    atomic_init(&Struct->failed, false);
+}
+
+void SET_InitLazyField(SET_LazyField *Struct)
+{
+    Struct->name = NULL;
+    Struct->start = NULL;
+    Struct->length = 0;
+    Struct->line = 0;
+    Struct->type = SET_DATATYPE_NONE;
+    Struct->depth = 0;
+    Struct->value = NULL;
+}
+
+void SET_InitLazySettings(SET_LazySettings *Struct)
+{
+    Struct->text = NULL;
+    Struct->fields = NULL;
+    Struct->count = 0;
+    Struct->index = NULL;
+    Struct->types = NULL;
+}
+
+void SET_InitParser(SET_Parser *Struct)
+{
+    Struct->types = NULL;
+    Struct->buffer = NULL;
+    Struct->bufferSize = 0;
+}
+
+void SET_InitScanBlock(SET_ScanBlock *Struct)
+{
+    Struct->start = NULL;
+    Struct->structural = 0;
+    Struct->string = 0;
+    Struct->newline = 0;
+}
+
+void SET_InitTextWriter(SET_TextWriter *Struct)
+{
+    Struct->file = NULL;
+    Struct->fileName = NULL;
+    Struct->buffer = NULL;
+    Struct->size = 0;
+}
+
+void SET_InitPathSegment(SET_PathSegment *Struct)
+{
+    Struct->name = NULL;
+    Struct->hash = 0;
+    Struct->index = 0;
+}
+
+void SET_InitPath(SET_Path *Struct)
+{
+    Struct->segments = NULL;
+    Struct->count = 0;
+}
+
+void SET_DestroyWatcher(SET_Watcher *Struct)
+{
+    SET_ClearDiff(&Struct->diff);
+
+    if (Struct->data != NULL)
+        SET_DestroyDataStruct(Struct->data);
+
+    if (Struct->index != NULL)
+        DIC_DestroyDict(Struct->index);
+
+    _SET_DestroyWatchFields(Struct->fields, Struct->count);
+
+    if (Struct->text != NULL)
+        free(Struct->text);
+
+    // Closing the instance removes the watch
+    if (Struct->fileID != -1)
+        close(Struct->fileID);
+
+    if (Struct->fileName != NULL)
+        free(Struct->fileName);
+
+    free(Struct);
+}
+
+void SET_DestroyCompiledTable(SET_CompiledTable *Struct)
+{
+    _SET_ClearCompiledTable(Struct);
+    free(Struct);
+    DIC_ReleaseHash();
+}
+
+void SET_DestroyPath(SET_Path *Struct)
+{
+    if (Struct->segments != NULL)
+    {
+        for (SET_PathSegment *List = Struct->segments, *EndList = Struct->segments + Struct->count; List < EndList; ++List)
+            if (List->name != NULL)
+                DIC_Release(List->name);
+
+        free(Struct->segments);
+    }
+
+    free(Struct);
+    DIC_ReleaseHash();
+}
+
+void _SET_ClearCompiledTable(SET_CompiledTable *Struct)
+{
+    if (Struct->sub != NULL)
+    {
+        for (SET_CompiledTable *List = Struct->sub, *EndList = Struct->sub + Struct->count; List < EndList; ++List)
+            _SET_ClearCompiledTable(List);
+
+        free(Struct->sub);
+    }
+
+    if (Struct->hashes != NULL)
+        free(Struct->hashes);
+
+    if (Struct->seeds != NULL)
+        free(Struct->seeds);
+
+    if (Struct->slots != NULL)
+        free(Struct->slots);
+
+    SET_InitCompiledTable(Struct);
+}
+
+void SET_ClearDiff(SET_Diff *Struct)
+{
+    if (Struct->list != NULL)
+    {
+        for (SET_Change *List = Struct->list, *EndList = Struct->list + Struct->count; List < EndList; ++List)
+            if (List->name != NULL)
+                free(List->name);
+
+        free(Struct->list);
+    }
+
+    if (Struct->old != NULL)
+        SET_DestroyDataStruct(Struct->old);
+
+    SET_InitDiff(Struct);
+}
+
 #endif
\ No newline at end of file
@@ -0,0 +1,380 @@
+// Template for dictionaries with keys which are not strings, it can be included multiple times with different prefixes
+// Setup by defining the following macros before including:
+// TDIC_PREFIX: The prefix used for all types and functions (required)
+// TDIC_KEYTYPE: The type of the key, it is passed by value (required)
+// TDIC_HASH(Key): Returns a uint64_t hash of the key, the upper bits are used to find the bucket (required)
+// TDIC_EQUAL(Key1, Key2): Returns true if the two keys are equal, defaults to ==
+// TDIC_COPYKEY(Dst, Src): Copies Src into Dst when a new item is added, returns false on error, defaults to assignment
+// TDIC_FREEKEY(Key): Frees a key copied with TDIC_COPYKEY, defaults to doing nothing
+
+#include <Dictionary.h>
+
+#ifndef TDIC_PREFIX
+#error "TDIC_PREFIX must be defined before including TypedDictionary.h"
+#endif
+
+#ifndef TDIC_KEYTYPE
+#error "TDIC_KEYTYPE must be defined before including TypedDictionary.h"
+#endif
+
+#ifndef TDIC_HASH
+#error "TDIC_HASH must be defined before including TypedDictionary.h"
+#endif
+
+#ifndef TDIC_EQUAL
+#define TDIC_EQUAL(Key1, Key2) ((Key1) == (Key2))
+#endif
+
+#ifndef TDIC_COPYKEY
+#define TDIC_COPYKEY(Dst, Src) ((Dst) = (Src), true)
+#endif
+
+#ifndef TDIC_FREEKEY
+#define TDIC_FREEKEY(Key)
+#endif
+
+// Create names
+#define __TDIC_SETUPNAME(PREFIX, NAME) PREFIX##_##NAME
+#define TDIC_SETUPNAME(PREFIX, NAME) __TDIC_SETUPNAME(PREFIX, NAME)
+#define __TDIC_SETUPNAMEPRE(PREFIX, NAME) __##PREFIX##_##NAME
+#define TDIC_SETUPNAMEPRE(PREFIX, NAME) __TDIC_SETUPNAMEPRE(PREFIX, NAME)
+
+// The types
+#define TDIC_DICT TDIC_SETUPNAME(TDIC_PREFIX, Dict)
+#define TDIC_LINKLIST TDIC_SETUPNAME(TDIC_PREFIX, LinkList)
+#define __TDIC_DICT TDIC_SETUPNAMEPRE(TDIC_PREFIX, Dict)
+#define __TDIC_LINKLIST TDIC_SETUPNAMEPRE(TDIC_PREFIX, LinkList)
+
+// The functions
+#define TDIC_CREATEDICT TDIC_SETUPNAME(TDIC_PREFIX, CreateDict)
+#define TDIC_ADDITEM TDIC_SETUPNAME(TDIC_PREFIX, AddItem)
+#define TDIC_REMOVEITEM TDIC_SETUPNAME(TDIC_PREFIX, RemoveItem)
+#define TDIC_GETITEM TDIC_SETUPNAME(TDIC_PREFIX, GetItem)
+#define TDIC_CHECKITEM TDIC_SETUPNAME(TDIC_PREFIX, CheckItem)
+#define TDIC_DICTLENGTH TDIC_SETUPNAME(TDIC_PREFIX, DictLength)
+#define TDIC_FIND TDIC_SETUPNAMEPRE(TDIC_PREFIX, Find)
+#define TDIC_INITLINKLIST TDIC_SETUPNAME(TDIC_PREFIX, InitLinkList)
+#define TDIC_INITDICT TDIC_SETUPNAME(TDIC_PREFIX, InitDict)
+#define TDIC_DESTROYLINKLIST TDIC_SETUPNAME(TDIC_PREFIX, DestroyLinkList)
+#define TDIC_DESTROYDICT TDIC_SETUPNAME(TDIC_PREFIX, DestroyDict)
+
+typedef struct __TDIC_DICT TDIC_DICT;
+typedef struct __TDIC_LINKLIST TDIC_LINKLIST;
+
+struct __TDIC_LINKLIST {
+    TDIC_KEYTYPE key; // The key for the item
+    uint64_t hash; // The hash of the key
+    void *value; // A pointer to the value
+    size_t size; // The size of the value, only used if pointer is false
+    bool pointer; // If it is false then it contains a pointer to private information which must be freed when dict is destroyed
+    TDIC_LINKLIST *next; // The next element in the list
+    uint64_t inlineValue[(DIC_INLINESIZE + sizeof(uint64_t) - 1) / sizeof(uint64_t)]; // Storage for small copied values, value points here when it is used
+};
+
+struct __TDIC_DICT {
+    TDIC_LINKLIST **list; // The buckets, the length is always a power of 2
+    size_t length; // The number of buckets
+    uint8_t shift; // How much to shift a hash to get the bucket
+    size_t count; // The number of items
+};
+
+// Creates a empty dictionary
+// Size: The size of the dict list, it is rounded up to a power of 2, this should be about the same size as the expected number of entries
+TDIC_DICT *TDIC_CREATEDICT(size_t Size);
+
+// Add an item to a dictionary
+// Dict: The dictionary to add the item to
+// Key: The key for the item
+// Value: A pointer to the value to store
+// ValueLength: The size of the value data, only used if mode is not DIC_MODE_POINTER
+// Mode: If DIC_MODE_POINTER, then it will just save the pointer, if DIC_INSERT, then it will save the pointer and free it when destroying the dict, if DIC_COPY, then it will copy the value pointet to, values no larger than DIC_INLINESIZE are copied into the entry itself
+bool TDIC_ADDITEM(TDIC_DICT *Dict, TDIC_KEYTYPE Key, void *Value, size_t ValueLength, DIC_Mode Mode);
+
+// Remove an item from a dictionary
+// Dict: The dictionary to remove an item from
+// Key: The key for the item
+bool TDIC_REMOVEITEM(TDIC_DICT *Dict, TDIC_KEYTYPE Key);
+
+// Get an item from a dictionary
+// Dict: The dictionary to get the item from
+// Key: The key for the item
+void *TDIC_GETITEM(TDIC_DICT *Dict, TDIC_KEYTYPE Key);
+
+// Checks if an item exists in a dictionary
+// Dict: The dictionary to search
+// Key: The key for the item
+bool TDIC_CHECKITEM(TDIC_DICT *Dict, TDIC_KEYTYPE Key);
+
+// Returns the number of elements in the dictionary
+// Dict: The dict to get the length of
+size_t TDIC_DICTLENGTH(TDIC_DICT *Dict);
+
+// Finds the position of the pointer to the item, if it is not there then it points to the NULL at the end of the bucket
+// Dict: The dictionary to search
+// Key: The key for the item
+// Hash: The hash of the key
+TDIC_LINKLIST **TDIC_FIND(TDIC_DICT *Dict, TDIC_KEYTYPE Key, uint64_t Hash);
+
+void TDIC_INITLINKLIST(TDIC_LINKLIST *Struct);
+void TDIC_INITDICT(TDIC_DICT *Struct);
+
+void TDIC_DESTROYLINKLIST(TDIC_LINKLIST *LinkList);
+void TDIC_DESTROYDICT(TDIC_DICT *Dict);
+
+TDIC_DICT *TDIC_CREATEDICT(size_t Size)
+{
+    // Allocate memory
+    TDIC_DICT *Dict = (TDIC_DICT *)malloc(sizeof(TDIC_DICT));
+
+    if (Dict == NULL)
+    {
+        _DIC_AddErrorForeign(_DIC_ERRORID_TYPEDCREATEDICT_MALLOC, strerror(errno), _DIC_ERRORMES_MALLOC, sizeof(TDIC_DICT));
+        return NULL;
+    }
+
+    // Initialize
+    TDIC_INITDICT(Dict);
+
+    // Find the number of buckets
+    Dict->length = 1;
+    Dict->shift = 64;
+
+    while (Dict->length < Size)
+    {
+        Dict->length <<= 1;
+        --Dict->shift;
+    }
+
+    // Get memory for the list
+    Dict->list = (TDIC_LINKLIST **)malloc(sizeof(TDIC_LINKLIST *) * Dict->length);
+
+    if (Dict->list == NULL)
+    {
+        _DIC_AddErrorForeign(_DIC_ERRORID_TYPEDCREATEDICT_MALLOCLIST, strerror(errno), _DIC_ERRORMES_MALLOC, sizeof(TDIC_LINKLIST *) * Dict->length);
+        TDIC_DESTROYDICT(Dict);
+        return NULL;
+    }
+
+    // Initialize list
+    for (TDIC_LINKLIST **List = Dict->list, **EndList = Dict->list + Dict->length; List < EndList; ++List)
+        *List = NULL;
+
+    return Dict;
+}
+
+TDIC_LINKLIST **TDIC_FIND(TDIC_DICT *Dict, TDIC_KEYTYPE Key, uint64_t Hash)
+{
+    // A shift of 64 is undefined so a single bucket is handled seperately
+    TDIC_LINKLIST **ItemPos = Dict->list + ((Dict->shift == 64) ? (0) : (Hash >> Dict->shift));
+
+    while (*ItemPos != NULL)
+    {
+        // Check if it found it, the hash is checked first to skip expensive compares
+        if ((*ItemPos)->hash == Hash && TDIC_EQUAL((*ItemPos)->key, Key))
+            break;
+
+        // Get the next item
+        ItemPos = &(*ItemPos)->next;
+    }
+
+    return ItemPos;
+}
+
+bool TDIC_ADDITEM(TDIC_DICT *Dict, TDIC_KEYTYPE Key, void *Value, size_t ValueLength, DIC_Mode Mode)
+{
+    // Find the position of the item
+    uint64_t Hash = TDIC_HASH(Key);
+    TDIC_LINKLIST **ItemPos = TDIC_FIND(Dict, Key, Hash);
+
+    // Copy the value, small values are copied into the entry later
+    void *CopyValue = Value;
+
+    if (Mode == DIC_MODE_COPY && ValueLength > DIC_INLINESIZE)
+    {
+        CopyValue = malloc(ValueLength);
+
+        if (CopyValue == NULL)
+        {
+            _DIC_AddErrorForeign(_DIC_ERRORID_TYPEDADDITEM_MALLOCVALUE, strerror(errno), _DIC_ERRORMES_MALLOC, ValueLength);
+            return false;
+        }
+
+        memcpy(CopyValue, Value, ValueLength);
+    }
+
+    // If it did not find the item, create a new item
+    if (*ItemPos == NULL)
+    {
+        TDIC_LINKLIST *NewItem = (TDIC_LINKLIST *)malloc(sizeof(TDIC_LINKLIST));
+
+        if (NewItem == NULL)
+        {
+            _DIC_AddErrorForeign(_DIC_ERRORID_TYPEDADDITEM_MALLOCITEM, strerror(errno), _DIC_ERRORMES_MALLOC, sizeof(TDIC_LINKLIST));
+            if (CopyValue != Value)
+                free(CopyValue);
+            return false;
+        }
+
+        TDIC_INITLINKLIST(NewItem);
+
+        // Copy the key
+        if (!TDIC_COPYKEY(NewItem->key, Key))
+        {
+            _DIC_AddErrorForeign(_DIC_ERRORID_TYPEDADDITEM_MALLOCKEY, strerror(errno), _DIC_ERRORMES_COPYKEY);
+            free(NewItem);
+            if (CopyValue != Value)
+                free(CopyValue);
+            return false;
+        }
+
+        // Set values
+        NewItem->hash = Hash;
+        *ItemPos = NewItem;
+        ++Dict->count;
+    }
+
+    // Find the old value, it is removed after the new value is copied in case they overlap
+    void *OldValue = NULL;
+
+    if (!(*ItemPos)->pointer && !_DIC_ISINLINE(*ItemPos))
+        OldValue = (*ItemPos)->value;
+
+    // Copy small values into the entry
+    if (Mode == DIC_MODE_COPY && ValueLength <= DIC_INLINESIZE)
+    {
+        if (ValueLength > 0)
+            memmove((*ItemPos)->inlineValue, Value, ValueLength);
+
+        CopyValue = (void *)(*ItemPos)->inlineValue;
+    }
+
+    // Remove old value
+    if (OldValue != NULL)
+        free(OldValue);
+
+    (*ItemPos)->value = CopyValue;
+    (*ItemPos)->pointer = (Mode == DIC_MODE_POINTER);
+    (*ItemPos)->size = ValueLength;
+
+    return true;
+}
+
+void *TDIC_GETITEM(TDIC_DICT *Dict, TDIC_KEYTYPE Key)
+{
+    TDIC_LINKLIST *Item = *TDIC_FIND(Dict, Key, TDIC_HASH(Key));
+
+    if (Item == NULL)
+    {
+        _DIC_SetError(_DIC_ERRORID_TYPEDGETITEM_NOITEM, _DIC_ERRORMES_NOITEM);
+        return NULL;
+    }
+
+    return Item->value;
+}
+
+bool TDIC_CHECKITEM(TDIC_DICT *Dict, TDIC_KEYTYPE Key)
+{
+    return *TDIC_FIND(Dict, Key, TDIC_HASH(Key)) != NULL;
+}
+
+bool TDIC_REMOVEITEM(TDIC_DICT *Dict, TDIC_KEYTYPE Key)
+{
+    TDIC_LINKLIST **ItemPos = TDIC_FIND(Dict, Key, TDIC_HASH(Key));
+
+    // Make sure that it found something
+    if (*ItemPos == NULL)
+    {
+        _DIC_SetError(_DIC_ERRORID_TYPEDREMOVEITEM_NOITEM, _DIC_ERRORMES_NOITEM);
+        return false;
+    }
+
+    // Remove the item
+    TDIC_LINKLIST *NextList = (*ItemPos)->next;
+    (*ItemPos)->next = NULL;
+
+    TDIC_DESTROYLINKLIST(*ItemPos);
+    *ItemPos = NextList;
+    --Dict->count;
+
+    return true;
+}
+
+size_t TDIC_DICTLENGTH(TDIC_DICT *Dict)
+{
+    return Dict->count;
+}
+
+void TDIC_INITLINKLIST(TDIC_LINKLIST *Struct)
+{
+    Struct->hash = 0;
+    Struct->value = NULL;
+    Struct->size = 0;
+    Struct->pointer = true;
+    Struct->next = NULL;
+}
+
+void TDIC_INITDICT(TDIC_DICT *Struct)
+{
+    Struct->list = NULL;
+    Struct->length = 0;
+    Struct->shift = 64;
+    Struct->count = 0;
+}
+
+void TDIC_DESTROYLINKLIST(TDIC_LINKLIST *LinkList)
+{
+    // Go through the rest of the bucket without recursion
+    for (TDIC_LINKLIST *Next; LinkList != NULL; LinkList = Next)
+    {
+        Next = LinkList->next;
+
+        TDIC_FREEKEY(LinkList->key);
+
+        if (!LinkList->pointer && LinkList->value != NULL && !_DIC_ISINLINE(LinkList))
+            free(LinkList->value);
+
+        free(LinkList);
+    }
+}
+
+void TDIC_DESTROYDICT(TDIC_DICT *Dict)
+{
+    // Destroy the dict
+    if (Dict->list != NULL)
+    {
+        for (TDIC_LINKLIST **List = Dict->list, **EndList = Dict->list + Dict->length; List < EndList; ++List)
+            if (*List != NULL)
+                TDIC_DESTROYLINKLIST(*List);
+
+        free(Dict->list);
+    }
+
+    free(Dict);
+}
+
+// Undefine definitions
+#undef TDIC_PREFIX
+#undef TDIC_KEYTYPE
+#undef TDIC_HASH
+#undef TDIC_EQUAL
+#undef TDIC_COPYKEY
+#undef TDIC_FREEKEY
+#undef __TDIC_SETUPNAME
+#undef TDIC_SETUPNAME
+#undef __TDIC_SETUPNAMEPRE
+#undef TDIC_SETUPNAMEPRE
+#undef TDIC_DICT
+#undef TDIC_LINKLIST
+#undef __TDIC_DICT
+#undef __TDIC_LINKLIST
+#undef TDIC_CREATEDICT
+#undef TDIC_ADDITEM
+#undef TDIC_REMOVEITEM
+#undef TDIC_GETITEM
+#undef TDIC_CHECKITEM
+#undef TDIC_DICTLENGTH
+#undef TDIC_FIND
+#undef TDIC_INITLINKLIST
+#undef TDIC_INITDICT
+#undef TDIC_DESTROYLINKLIST
+#undef TDIC_DESTROYDICT
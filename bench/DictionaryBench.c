@@ -0,0 +1,490 @@
+// Benchmark for Dictionary.h
+// Measures insert, hit lookup, miss lookup, remove, copy and destroy for different sizes, load factors, key distributions and value modes
+// Usage: DictionaryBench [Output.csv]
+//
+// The result is written as csv with one line per configuration and operation:
+// workload: 0 = random keys of 8 to 32 characters, 1 = settings like keys (short camelCase names, misses are other plausible names)
+// mode: 0 = DIC_MODE_POINTER, 1 = DIC_MODE_COPY with 8 byte values (stored inline), 2 = DIC_MODE_COPY with 64 byte values
+// bloom: 1 if the dict has a bloom filter
+// operation: 0 = insert, 1 = hit lookup, 2 = miss lookup, 3 = remove, 4 = copy, 5 = destroy
+// size: The number of items, load: The number of items per bucket
+// samples: The number of timed samples, for insert, lookup and remove a sample is BEN_BATCH operations, for copy and destroy it is the whole dict
+// nsperitem: The average time per item in ns, p50, p90, p99 and max: Percentiles of the time of a sample in ns
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <Dictionary.h>
+#include <Files.h>
+#include <Random.h>
+
+#define BEN_BATCH 8 // The number of operations timed together for insert, lookup and remove, this hides the cost of reading the clock
+#define BEN_REPEAT 5 // The number of times copy and destroy are timed for each configuration
+#define BEN_VALUESIZE 64 // The size of the largest values
+
+enum BEN_Workload {
+    BEN_WORKLOAD_RANDOM,
+    BEN_WORKLOAD_SETTINGS,
+    BEN_WORKLOAD_COUNT
+};
+
+enum BEN_Mode {
+    BEN_MODE_POINTER,
+    BEN_MODE_COPYSMALL,
+    BEN_MODE_COPYLARGE,
+    BEN_MODE_COUNT
+};
+
+enum BEN_Operation {
+    BEN_OPERATION_INSERT,
+    BEN_OPERATION_HIT,
+    BEN_OPERATION_MISS,
+    BEN_OPERATION_REMOVE,
+    BEN_OPERATION_COPY,
+    BEN_OPERATION_DESTROY,
+    BEN_OPERATION_COUNT
+};
+
+typedef struct __BEN_Results BEN_Results;
+
+// All the lines of the csv file, one list per column
+struct __BEN_Results {
+    size_t count; // The number of lines
+    size_t length; // The number of lines there is space for
+    uint8_t *workload; // The key distribution
+    uint8_t *mode; // The value mode
+    uint8_t *bloom; // 1 if the dict had a bloom filter
+    uint8_t *operation; // The operation timed
+    uint64_t *size; // The number of items
+    double *load; // The number of items per bucket
+    uint64_t *samples; // The number of samples
+    double *nsPerItem; // The average time per item
+    uint64_t *p50; // The median time of a sample
+    uint64_t *p90; // The 90th percentile
+    uint64_t *p99; // The 99th percentile
+    uint64_t *max; // The slowest sample
+};
+
+const size_t BEN_Sizes[] = {16, 256, 4096, 65536};
+const double BEN_Loads[] = {0.5, 1.0, 2.0, 4.0};
+
+// Words used to build settings like keys
+const char *BEN_Words[] = {"window", "width", "height", "title", "font", "size", "color", "border", "max", "min", "count", "name", "path", "file", "log", "level",
+                           "enable", "timeout", "retry", "delay", "buffer", "cache", "thread", "port", "host", "user", "mode", "scale", "speed", "offset", "limit", "format"};
+#define BEN_WORDCOUNT (sizeof(BEN_Words) / sizeof(*BEN_Words))
+
+// Returns the time in ns
+static inline uint64_t BEN_Time(void)
+{
+    struct timespec Time;
+    clock_gettime(CLOCK_MONOTONIC, &Time);
+
+    return (uint64_t)Time.tv_sec * 1000000000 + (uint64_t)Time.tv_nsec;
+}
+
+// Creates Count unique keys, returns NULL on error
+// Workload: The key distribution
+// Count: The number of keys
+// Miss: If true it creates keys which are never created when this is false
+// Seed: The seed for the random numbers
+char **BEN_CreateKeys(enum BEN_Workload Workload, size_t Count, bool Miss, RNG_Seed Seed);
+
+// Destroys a list of keys
+// Keys: The keys to destroy
+// Count: The number of keys
+void BEN_DestroyKeys(char **Keys, size_t Count);
+
+// Shuffles a list of keys
+// Keys: The keys to shuffle
+// Count: The number of keys
+// Seed: The seed for the random numbers
+void BEN_Shuffle(char **Keys, size_t Count, RNG_Seed Seed);
+
+// Calculates the statistics of a list of samples and adds a line to the results, returns false on error
+// Results: The results to add to
+// Workload, Mode, Bloom, Operation, Size, Load: The configuration
+// Samples: The time of each sample in ns, it is sorted
+// Count: The number of samples
+// Items: The number of items the samples cover together
+bool BEN_AddResult(BEN_Results *Results, enum BEN_Workload Workload, enum BEN_Mode Mode, bool Bloom, enum BEN_Operation Operation, size_t Size, double Load, uint64_t *Samples, size_t Count, size_t Items);
+
+// Runs all operations for one configuration, returns false on error
+// Results: The results to add to
+// Workload, Mode, Bloom, Size, Load: The configuration
+// Keys: The keys to add, Size long, it is shuffled after inserting
+// MissKeys: Keys which are not in the dict, Size long
+// Values: Size values of BEN_VALUESIZE bytes
+// Samples: Space for at least Size samples
+bool BEN_Run(BEN_Results *Results, enum BEN_Workload Workload, enum BEN_Mode Mode, bool Bloom, size_t Size, double Load, char **Keys, char **MissKeys, uint8_t *Values, uint64_t *Samples);
+
+int BEN_CompareTime(const void *Time1, const void *Time2);
+
+void BEN_InitResults(BEN_Results *Struct);
+void BEN_DestroyResults(BEN_Results *Results);
+
+char **BEN_CreateKeys(enum BEN_Workload Workload, size_t Count, bool Miss, RNG_Seed Seed)
+{
+    char **Keys = (char **)malloc(sizeof(char *) * Count);
+
+    if (Keys == NULL)
+        return NULL;
+
+    for (size_t Pos = 0; Pos < Count; ++Pos)
+    {
+        char Key[64];
+
+        if (Workload == BEN_WORKLOAD_RANDOM)
+        {
+            // Random characters, misses start with a character never used for hits
+            size_t Length = 8 + RNG_RandS(Seed) % 25;
+            char *KeyList = Key;
+
+            if (Miss)
+                *KeyList++ = '_';
+
+            for (char *EndKeyList = KeyList + Length; KeyList < EndKeyList; ++KeyList)
+                *KeyList = 'a' + RNG_RandS(Seed) % 26;
+
+            // Make it unique
+            sprintf(KeyList, "%lu", Pos);
+        }
+
+        else
+        {
+            // Two words in camelCase followed by a number if there are not enough combinations, misses have three words like optional fields do
+            const char *Word1 = BEN_Words[Pos % BEN_WORDCOUNT];
+            const char *Word2 = BEN_Words[Pos / BEN_WORDCOUNT % BEN_WORDCOUNT];
+            size_t Number = Pos / (BEN_WORDCOUNT * BEN_WORDCOUNT);
+            size_t Length = sprintf(Key, "%s%c%s", Word1, Word2[0] - 'a' + 'A', Word2 + 1);
+
+            if (Miss)
+            {
+                const char *Word3 = BEN_Words[RNG_RandS(Seed) % BEN_WORDCOUNT];
+                Length += sprintf(Key + Length, "%c%s", Word3[0] - 'a' + 'A', Word3 + 1);
+            }
+
+            if (Number > 0)
+                sprintf(Key + Length, "%lu", Number);
+        }
+
+        Keys[Pos] = (char *)malloc(sizeof(char) * (strlen(Key) + 1));
+
+        if (Keys[Pos] == NULL)
+        {
+            BEN_DestroyKeys(Keys, Pos);
+            return NULL;
+        }
+
+        strcpy(Keys[Pos], Key);
+    }
+
+    return Keys;
+}
+
+void BEN_DestroyKeys(char **Keys, size_t Count)
+{
+    for (char **List = Keys, **EndList = Keys + Count; List < EndList; ++List)
+        free(*List);
+
+    free(Keys);
+}
+
+void BEN_Shuffle(char **Keys, size_t Count, RNG_Seed Seed)
+{
+    for (size_t Pos = Count; Pos > 1; --Pos)
+    {
+        size_t Other = RNG_RandS(Seed) % Pos;
+        char *Temp = Keys[Pos - 1];
+        Keys[Pos - 1] = Keys[Other];
+        Keys[Other] = Temp;
+    }
+}
+
+int BEN_CompareTime(const void *Time1, const void *Time2)
+{
+    uint64_t Value1 = *(const uint64_t *)Time1;
+    uint64_t Value2 = *(const uint64_t *)Time2;
+
+    return (Value1 > Value2) - (Value1 < Value2);
+}
+
+bool BEN_AddResult(BEN_Results *Results, enum BEN_Workload Workload, enum BEN_Mode Mode, bool Bloom, enum BEN_Operation Operation, size_t Size, double Load, uint64_t *Samples, size_t Count, size_t Items)
+{
+    // Make room
+    if (Results->count == Results->length)
+    {
+        size_t Length = ((Results->length > 0) ? (Results->length * 2) : (64));
+
+#define _BEN_GROW(Field) \
+        { \
+            void *New = realloc(Results->Field, sizeof(*Results->Field) * Length); \
+            if (New == NULL) \
+                return false; \
+            Results->Field = New; \
+        }
+
+        _BEN_GROW(workload);
+        _BEN_GROW(mode);
+        _BEN_GROW(bloom);
+        _BEN_GROW(operation);
+        _BEN_GROW(size);
+        _BEN_GROW(load);
+        _BEN_GROW(samples);
+        _BEN_GROW(nsPerItem);
+        _BEN_GROW(p50);
+        _BEN_GROW(p90);
+        _BEN_GROW(p99);
+        _BEN_GROW(max);
+#undef _BEN_GROW
+
+        Results->length = Length;
+    }
+
+    // Get the statistics
+    qsort(Samples, Count, sizeof(uint64_t), &BEN_CompareTime);
+    uint64_t Total = 0;
+
+    for (uint64_t *List = Samples, *EndList = Samples + Count; List < EndList; ++List)
+        Total += *List;
+
+    size_t Line = Results->count++;
+    Results->workload[Line] = Workload;
+    Results->mode[Line] = Mode;
+    Results->bloom[Line] = Bloom;
+    Results->operation[Line] = Operation;
+    Results->size[Line] = Size;
+    Results->load[Line] = Load;
+    Results->samples[Line] = Count;
+    Results->nsPerItem[Line] = (double)Total / (double)Items;
+    Results->p50[Line] = Samples[Count * 50 / 100];
+    Results->p90[Line] = Samples[Count * 90 / 100];
+    Results->p99[Line] = Samples[Count * 99 / 100];
+    Results->max[Line] = Samples[Count - 1];
+
+    return true;
+}
+
+bool BEN_Run(BEN_Results *Results, enum BEN_Workload Workload, enum BEN_Mode Mode, bool Bloom, size_t Size, double Load, char **Keys, char **MissKeys, uint8_t *Values, uint64_t *Samples)
+{
+    size_t Buckets = (size_t)((double)Size / Load);
+    size_t BatchCount = (Size + BEN_BATCH - 1) / BEN_BATCH;
+    DIC_Mode DictMode = ((Mode == BEN_MODE_POINTER) ? (DIC_MODE_POINTER) : (DIC_MODE_COPY));
+    size_t ValueSize = ((Mode == BEN_MODE_COPYSMALL) ? (sizeof(uint64_t)) : (BEN_VALUESIZE));
+
+    DIC_Dict *Dict = DIC_CreateDict(((Buckets > 0) ? (Buckets) : (1)));
+
+    if (Dict == NULL || (Bloom && !DIC_AddBloomFilter(Dict, Size)))
+    {
+        printf("Unable to create dict: %s\n", DIC_GetError());
+        return false;
+    }
+
+    // Insert
+    for (size_t Batch = 0; Batch < BatchCount; ++Batch)
+    {
+        size_t Start = Batch * BEN_BATCH;
+        size_t End = ((Start + BEN_BATCH < Size) ? (Start + BEN_BATCH) : (Size));
+        uint64_t Time = BEN_Time();
+
+        for (size_t Pos = Start; Pos < End; ++Pos)
+            if (!DIC_AddItem(Dict, Keys[Pos], Values + Pos * BEN_VALUESIZE, ValueSize, DictMode))
+            {
+                printf("Unable to add item: %s\n", DIC_GetError());
+                DIC_DestroyDict(Dict);
+                return false;
+            }
+
+        Samples[Batch] = BEN_Time() - Time;
+    }
+
+    if (!BEN_AddResult(Results, Workload, Mode, Bloom, BEN_OPERATION_INSERT, Size, Load, Samples, BatchCount, Size))
+        return false;
+
+    // Look up and remove in a different order than the items were inserted
+    BEN_Shuffle(Keys, Size, Size + Mode * 2 + Bloom);
+
+    // Hit and miss lookups, the sum keeps the compiler from removing the lookups
+    volatile uintptr_t Sum = 0;
+
+    for (enum BEN_Operation Operation = BEN_OPERATION_HIT; Operation <= BEN_OPERATION_MISS; ++Operation)
+    {
+        char **LookupKeys = ((Operation == BEN_OPERATION_HIT) ? (Keys) : (MissKeys));
+
+        for (size_t Batch = 0; Batch < BatchCount; ++Batch)
+        {
+            size_t Start = Batch * BEN_BATCH;
+            size_t End = ((Start + BEN_BATCH < Size) ? (Start + BEN_BATCH) : (Size));
+            uint64_t Time = BEN_Time();
+
+            for (size_t Pos = Start; Pos < End; ++Pos)
+                Sum += (uintptr_t)DIC_GetItem(Dict, LookupKeys[Pos]);
+
+            Samples[Batch] = BEN_Time() - Time;
+        }
+
+        if (!BEN_AddResult(Results, Workload, Mode, Bloom, Operation, Size, Load, Samples, BatchCount, Size))
+            return false;
+    }
+
+    // Copy, the copies are used to time destroy
+    DIC_Dict *Copies[BEN_REPEAT];
+
+    for (size_t Repeat = 0; Repeat < BEN_REPEAT; ++Repeat)
+    {
+        uint64_t Time = BEN_Time();
+        Copies[Repeat] = DIC_CopyDict(Dict);
+        Samples[Repeat] = BEN_Time() - Time;
+
+        if (Copies[Repeat] == NULL)
+        {
+            printf("Unable to copy dict: %s\n", DIC_GetError());
+            return false;
+        }
+    }
+
+    if (!BEN_AddResult(Results, Workload, Mode, Bloom, BEN_OPERATION_COPY, Size, Load, Samples, BEN_REPEAT, Size * BEN_REPEAT))
+        return false;
+
+    // Remove all of the items
+    for (size_t Batch = 0; Batch < BatchCount; ++Batch)
+    {
+        size_t Start = Batch * BEN_BATCH;
+        size_t End = ((Start + BEN_BATCH < Size) ? (Start + BEN_BATCH) : (Size));
+        uint64_t Time = BEN_Time();
+
+        for (size_t Pos = Start; Pos < End; ++Pos)
+            DIC_RemoveItem(Dict, Keys[Pos]);
+
+        Samples[Batch] = BEN_Time() - Time;
+    }
+
+    if (!BEN_AddResult(Results, Workload, Mode, Bloom, BEN_OPERATION_REMOVE, Size, Load, Samples, BatchCount, Size))
+        return false;
+
+    DIC_DestroyDict(Dict);
+
+    // Destroy
+    for (size_t Repeat = 0; Repeat < BEN_REPEAT; ++Repeat)
+    {
+        uint64_t Time = BEN_Time();
+        DIC_DestroyDict(Copies[Repeat]);
+        Samples[Repeat] = BEN_Time() - Time;
+    }
+
+    if (!BEN_AddResult(Results, Workload, Mode, Bloom, BEN_OPERATION_DESTROY, Size, Load, Samples, BEN_REPEAT, Size * BEN_REPEAT))
+        return false;
+
+    return true;
+}
+
+void BEN_InitResults(BEN_Results *Struct)
+{
+    Struct->count = 0;
+    Struct->length = 0;
+    Struct->workload = NULL;
+    Struct->mode = NULL;
+    Struct->bloom = NULL;
+    Struct->operation = NULL;
+    Struct->size = NULL;
+    Struct->load = NULL;
+    Struct->samples = NULL;
+    Struct->nsPerItem = NULL;
+    Struct->p50 = NULL;
+    Struct->p90 = NULL;
+    Struct->p99 = NULL;
+    Struct->max = NULL;
+}
+
+void BEN_DestroyResults(BEN_Results *Results)
+{
+    free(Results->workload);
+    free(Results->mode);
+    free(Results->bloom);
+    free(Results->operation);
+    free(Results->size);
+    free(Results->load);
+    free(Results->samples);
+    free(Results->nsPerItem);
+    free(Results->p50);
+    free(Results->p90);
+    free(Results->p99);
+    free(Results->max);
+}
+
+int main(int argc, char **argv)
+{
+    const char *FileName = ((argc > 1) ? (argv[1]) : ("DictionaryBench.csv"));
+    size_t MaxSize = BEN_Sizes[sizeof(BEN_Sizes) / sizeof(*BEN_Sizes) - 1];
+
+    // Get memory for the values and samples
+    uint8_t *Values = (uint8_t *)malloc(sizeof(uint8_t) * BEN_VALUESIZE * MaxSize);
+    uint64_t *Samples = (uint64_t *)malloc(sizeof(uint64_t) * MaxSize);
+
+    if (Values == NULL || Samples == NULL)
+    {
+        printf("Unable to allocate memory\n");
+        return -1;
+    }
+
+    for (size_t Pos = 0; Pos < BEN_VALUESIZE * MaxSize; ++Pos)
+        Values[Pos] = (uint8_t)Pos;
+
+    BEN_Results Results;
+    BEN_InitResults(&Results);
+
+    // Keep the hash table alive between dicts so it is not part of the timing
+    DIC_Dict *KeepAlive = DIC_CreateDict(1);
+
+    if (KeepAlive == NULL)
+    {
+        printf("Unable to create dict: %s\n", DIC_GetError());
+        return -1;
+    }
+
+    for (enum BEN_Workload Workload = 0; Workload < BEN_WORKLOAD_COUNT; ++Workload)
+        for (const size_t *Size = BEN_Sizes, *EndSize = BEN_Sizes + sizeof(BEN_Sizes) / sizeof(*BEN_Sizes); Size < EndSize; ++Size)
+        {
+            // Create the keys
+            char **Keys = BEN_CreateKeys(Workload, *Size, false, 1);
+            char **MissKeys = BEN_CreateKeys(Workload, *Size, true, 2);
+
+            if (Keys == NULL || MissKeys == NULL)
+            {
+                printf("Unable to create keys\n");
+                return -1;
+            }
+
+            for (const double *Load = BEN_Loads, *EndLoad = BEN_Loads + sizeof(BEN_Loads) / sizeof(*BEN_Loads); Load < EndLoad; ++Load)
+                for (enum BEN_Mode Mode = 0; Mode < BEN_MODE_COUNT; ++Mode)
+                    for (int Bloom = 0; Bloom < 2; ++Bloom)
+                        if (!BEN_Run(&Results, Workload, Mode, Bloom, *Size, *Load, Keys, MissKeys, Values, Samples))
+                            return -1;
+
+            printf("Done with workload %u, size %lu\n", Workload, *Size);
+
+            BEN_DestroyKeys(Keys, *Size);
+            BEN_DestroyKeys(MissKeys, *Size);
+        }
+
+    DIC_DestroyDict(KeepAlive);
+
+    // Save the results
+    if (!FIL_SaveCSV(FileName, "workload,mode,bloom,operation,size,load,samples,nsperitem,p50,p90,p99,max", ",", Results.count, 12,
+                     Results.workload, FIL_DATATYPE_UINT8, Results.mode, FIL_DATATYPE_UINT8, Results.bloom, FIL_DATATYPE_UINT8, Results.operation, FIL_DATATYPE_UINT8,
+                     Results.size, FIL_DATATYPE_UINT64, Results.load, FIL_DATATYPE_DOUBLE, Results.samples, FIL_DATATYPE_UINT64, Results.nsPerItem, FIL_DATATYPE_DOUBLE,
+                     Results.p50, FIL_DATATYPE_UINT64, Results.p90, FIL_DATATYPE_UINT64, Results.p99, FIL_DATATYPE_UINT64, Results.max, FIL_DATATYPE_UINT64))
+    {
+        printf("Unable to save results: %s\n", FIL_GetError());
+        return -1;
+    }
+
+    printf("Saved %lu lines to %s\n", Results.count, FileName);
+
+    BEN_DestroyResults(&Results);
+    free(Values);
+    free(Samples);
+
+    return 0;
+}
@@ -0,0 +1,966 @@
+// Benchmark for Settings.h
+// Generates a corpus of settings files of different shapes and sizes and times each phase of loading them
+// Usage: SettingsBench [Output.csv]
+//
+// The corpus is written to the current directory as SettingsBench_<shape>_<size>.set and is kept so it can be used by other tools
+// The result is written as csv with one line per file and phase:
+// shape: 0 = deep structs, 1 = wide structs, 2 = huge numeric lists, 3 = string heavy, 4 = comment heavy
+// size: The size of the file in bytes
+// phase: 0 = load (read the file), 1 = clean, 2 = split, 3 = convert (the original three pass parser),
+//        4 = parse (the single pass parser used by SET_LoadSettings, it replaces clean, split and convert), 5 = translate (into a struct with a compiled translation table)
+// samples: The number of times the phase was timed
+// mbps: The size of the file divided by the median time in MB/s
+// p50, min and max: The median, fastest and slowest time in ns
+// allocs: The number of calls to malloc, calloc, realloc and aligned_alloc done by the phase
+// peak: The largest amount of memory allocated by the phase at once in bytes, memory allocated by earlier phases is not included
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdbool.h>
+#include <errno.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/inotify.h>
+#include <sys/resource.h>
+#include <poll.h>
+#include <libgen.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <math.h>
+#include <emmintrin.h>
+
+#define BEN_HEADERSIZE 16 // The size of the header placed in front of every allocation, it keeps the memory aligned like malloc does
+#define BEN_DEPTH 32 // The number of levels of structs in the deep shape
+#define BEN_ROWSIZE 16 // The number of numbers in each row of the matrix in the numeric shape
+#define BEN_MINREPEAT 3 // The smallest number of times each phase is timed
+#define BEN_MAXREPEAT 50 // The largest number of times each phase is timed
+#define BEN_REPEATBYTES (64 * 1024 * 1024) // The number of bytes to load in total for each file, it decides how many times the phases are timed
+
+typedef struct __BEN_Memory BEN_Memory;
+typedef struct __BEN_Header BEN_Header;
+
+// Counts the allocations done by the library, it is not thread safe so only single threaded loading is timed
+struct __BEN_Memory {
+    uint64_t allocs; // The number of allocations
+    size_t live; // The number of bytes allocated right now
+    size_t peak; // The largest value of live since it was last reset
+};
+
+// Placed in front of all memory handed out
+struct __BEN_Header {
+    size_t size; // The number of bytes asked for
+    size_t offset; // The distance from the start of the real allocation to the memory handed out
+};
+
+BEN_Memory BEN_UsedMemory = {.allocs = 0, .live = 0, .peak = 0};
+
+// Registers a new allocation and returns the memory to hand out
+// Real: The memory from the real allocator, NULL if it failed
+// Size: The number of bytes asked for
+// Offset: The number of bytes before the memory to hand out
+static inline void *BEN_Track(void *Real, size_t Size, size_t Offset)
+{
+    if (Real == NULL)
+        return NULL;
+
+    BEN_Header *Header = (BEN_Header *)((uint8_t *)Real + Offset - sizeof(BEN_Header));
+    Header->size = Size;
+    Header->offset = Offset;
+
+    ++BEN_UsedMemory.allocs;
+    BEN_UsedMemory.live += Size;
+
+    if (BEN_UsedMemory.live > BEN_UsedMemory.peak)
+        BEN_UsedMemory.peak = BEN_UsedMemory.live;
+
+    return (uint8_t *)Real + Offset;
+}
+
+// Gets the header of memory handed out by BEN_Track
+static inline BEN_Header *BEN_GetHeader(void *Pointer)
+{
+    return (BEN_Header *)((uint8_t *)Pointer - sizeof(BEN_Header));
+}
+
+void *BEN_Malloc(size_t Size)
+{
+    return BEN_Track(malloc(Size + BEN_HEADERSIZE), Size, BEN_HEADERSIZE);
+}
+
+void *BEN_Calloc(size_t Count, size_t Size)
+{
+    return BEN_Track(calloc(1, Count * Size + BEN_HEADERSIZE), Count * Size, BEN_HEADERSIZE);
+}
+
+void *BEN_AlignedAlloc(size_t Alignment, size_t Size)
+{
+    // The header takes up a whole alignment so the memory handed out is still aligned
+    size_t Offset = ((Alignment > BEN_HEADERSIZE) ? (Alignment) : (BEN_HEADERSIZE));
+
+    return BEN_Track(aligned_alloc(Alignment, Size + Offset), Size, Offset);
+}
+
+void BEN_Free(void *Pointer)
+{
+    if (Pointer == NULL)
+        return;
+
+    BEN_Header *Header = BEN_GetHeader(Pointer);
+    BEN_UsedMemory.live -= Header->size;
+    free((uint8_t *)Pointer - Header->offset);
+}
+
+void *BEN_Realloc(void *Pointer, size_t Size)
+{
+    if (Pointer == NULL)
+        return BEN_Malloc(Size);
+
+    BEN_Header *Header = BEN_GetHeader(Pointer);
+    size_t OldSize = Header->size;
+
+    // Aligned memory cannot be moved by realloc without losing the alignment
+    if (Header->offset != BEN_HEADERSIZE)
+    {
+        void *New = BEN_Malloc(Size);
+
+        if (New == NULL)
+            return NULL;
+
+        memcpy(New, Pointer, ((OldSize < Size) ? (OldSize) : (Size)));
+        BEN_Free(Pointer);
+        return New;
+    }
+
+    void *Real = realloc((uint8_t *)Pointer - BEN_HEADERSIZE, Size + BEN_HEADERSIZE);
+
+    if (Real == NULL)
+        return NULL;
+
+    BEN_UsedMemory.live -= OldSize;
+    return BEN_Track(Real, Size, BEN_HEADERSIZE);
+}
+
+// Everything allocated by the libraries goes through the counters, the system headers are included above so their declarations are not changed
+#define malloc(Size) BEN_Malloc(Size)
+#define calloc(Count, Size) BEN_Calloc(Count, Size)
+#define realloc(Pointer, Size) BEN_Realloc(Pointer, Size)
+#define aligned_alloc(Alignment, Size) BEN_AlignedAlloc(Alignment, Size)
+#define free(Pointer) BEN_Free(Pointer)
+
+#include <Settings.h>
+#include <Files.h>
+#include <Random.h>
+
+enum BEN_Shape {
+    BEN_SHAPE_DEEP,
+    BEN_SHAPE_WIDE,
+    BEN_SHAPE_NUMBERS,
+    BEN_SHAPE_STRINGS,
+    BEN_SHAPE_COMMENTS,
+    BEN_SHAPE_COUNT
+};
+
+enum BEN_Phase {
+    BEN_PHASE_LOAD,
+    BEN_PHASE_CLEAN,
+    BEN_PHASE_SPLIT,
+    BEN_PHASE_CONVERT,
+    BEN_PHASE_PARSE,
+    BEN_PHASE_TRANSLATE,
+    BEN_PHASE_COUNT
+};
+
+typedef struct __BEN_Results BEN_Results;
+typedef struct __BEN_Table BEN_Table;
+typedef struct __BEN_Sample BEN_Sample;
+
+// All the lines of the csv file, one list per column
+struct __BEN_Results {
+    size_t count; // The number of lines
+    size_t length; // The number of lines there is space for
+    uint8_t *shape; // The shape of the file
+    uint64_t *size; // The size of the file
+    uint8_t *phase; // The phase timed
+    uint64_t *samples; // The number of samples
+    double *mbps; // The speed in MB/s
+    uint64_t *p50; // The median time
+    uint64_t *min; // The fastest time
+    uint64_t *max; // The slowest time
+    uint64_t *allocs; // The number of allocations
+    uint64_t *peak; // The largest amount of memory allocated at once
+};
+
+// The translation table matching a file of the corpus
+struct __BEN_Table {
+    SET_TranslationTable *table; // The table of the top level
+    size_t count; // The number of entries in table
+    SET_TranslationTable *levels; // The tables of each level of the deep shape, the entries of table point into it
+    char **names; // The names of the entries in table
+    size_t size; // The size of the struct to translate into
+};
+
+// The measurements of one phase
+struct __BEN_Sample {
+    uint64_t time; // The time in ns
+    uint64_t allocs; // The number of allocations
+    size_t peak; // The largest amount of memory allocated at once
+};
+
+const size_t BEN_Sizes[] = {65536, 1048576, 16777216};
+const char *BEN_ShapeNames[] = {"deep", "wide", "numbers", "strings", "comments"};
+const char *BEN_PhaseNames[] = {"load", "clean", "split", "convert", "parse", "translate"};
+
+// Words used to build strings and comments
+const char *BEN_Words[] = {"window", "width", "height", "title", "font", "size", "color", "border", "max", "min", "count", "name", "path", "file", "log", "level",
+                           "enable", "timeout", "retry", "delay", "buffer", "cache", "thread", "port", "host", "user", "mode", "scale", "speed", "offset", "limit", "format"};
+#define BEN_WORDCOUNT (sizeof(BEN_Words) / sizeof(*BEN_Words))
+
+// Returns the time in ns
+static inline uint64_t BEN_Time(void)
+{
+    struct timespec Time;
+    clock_gettime(CLOCK_MONOTONIC, &Time);
+
+    return (uint64_t)Time.tv_sec * 1000000000 + (uint64_t)Time.tv_nsec;
+}
+
+// Starts measuring a phase
+// Sample: The sample to start
+static inline void BEN_StartSample(BEN_Sample *Sample)
+{
+    Sample->allocs = BEN_UsedMemory.allocs;
+    Sample->peak = BEN_UsedMemory.live;
+    BEN_UsedMemory.peak = BEN_UsedMemory.live;
+    Sample->time = BEN_Time();
+}
+
+// Stops measuring a phase
+// Sample: The sample started with BEN_StartSample
+static inline void BEN_StopSample(BEN_Sample *Sample)
+{
+    Sample->time = BEN_Time() - Sample->time;
+    Sample->allocs = BEN_UsedMemory.allocs - Sample->allocs;
+    Sample->peak = BEN_UsedMemory.peak - Sample->peak;
+}
+
+// Writes a number of random words separated by spaces
+// File: The file to write to
+// Count: The number of words
+// Seed: The seed for the random numbers
+void BEN_WriteWords(FILE *File, size_t Count, RNG_Seed *Seed);
+
+// Writes a file of a shape, returns the number of fields at the top level or 0 on error
+// FileName: The name of the file
+// Shape: The shape of the file
+// Size: The file is at least this many bytes
+// Seed: The seed for the random numbers
+size_t BEN_CreateFile(const char *FileName, enum BEN_Shape Shape, size_t Size, RNG_Seed Seed);
+
+// Writes a number of fields of the wide shape, with comments in between for the comment heavy shape
+// File: The file to write to
+// Pos: The number of the field
+// Comments: True if comments should be written
+// Seed: The seed for the random numbers
+void BEN_WriteWideField(FILE *File, size_t Pos, bool Comments, RNG_Seed *Seed);
+
+// Writes a struct of the deep shape
+// File: The file to write to
+// Pos: The number of the struct
+// Seed: The seed for the random numbers
+void BEN_WriteDeepField(FILE *File, size_t Pos, RNG_Seed *Seed);
+
+// Writes a field of the string heavy shape
+// File: The file to write to
+// Pos: The number of the field
+// Seed: The seed for the random numbers
+void BEN_WriteStringField(FILE *File, size_t Pos, RNG_Seed *Seed);
+
+// Writes the lists of the numeric shape, returns false on error
+// File: The file to write to
+// Size: The number of bytes to write
+// Seed: The seed for the random numbers
+bool BEN_WriteNumbers(FILE *File, size_t Size, RNG_Seed *Seed);
+
+// Creates the translation table for a file, returns false on error
+// Table: The table to create
+// Shape: The shape of the file
+// Count: The number of fields at the top level
+bool BEN_CreateTable(BEN_Table *Table, enum BEN_Shape Shape, size_t Count);
+
+// Sets an entry of a translation table
+// Table: The entry to set
+// Name: The name of the field
+// Type: The type of the field
+// Size: The size of the values
+// Depth: The depth of the list
+// Offset: The location in the struct
+void BEN_SetEntry(SET_TranslationTable *Table, char *Name, SET_DataType Type, size_t Size, uint8_t Depth, size_t Offset);
+
+// Times all phases of loading a file, returns false on error
+// Results: The results to add to
+// FileName: The name of the file
+// Shape: The shape of the file
+// Size: The size of the file
+// Table: The translation table for the file
+bool BEN_Run(BEN_Results *Results, const char *FileName, enum BEN_Shape Shape, size_t Size, const BEN_Table *Table);
+
+// Calculates the statistics of a phase and adds a line to the results, returns false on error
+// Results: The results to add to
+// Shape, Size, Phase: The configuration
+// Samples: The measurements, the times are sorted
+// Count: The number of samples
+bool BEN_AddResult(BEN_Results *Results, enum BEN_Shape Shape, size_t Size, enum BEN_Phase Phase, BEN_Sample *Samples, size_t Count);
+
+int BEN_CompareSample(const void *Sample1, const void *Sample2);
+
+void BEN_InitResults(BEN_Results *Struct);
+void BEN_InitTable(BEN_Table *Struct);
+void BEN_InitSample(BEN_Sample *Struct);
+void BEN_DestroyResults(BEN_Results *Results);
+void BEN_DestroyTable(BEN_Table *Table);
+
+void BEN_WriteWords(FILE *File, size_t Count, RNG_Seed *Seed)
+{
+    for (size_t Pos = 0; Pos < Count; ++Pos)
+        fprintf(File, "%s%s", ((Pos > 0) ? (" ") : ("")), BEN_Words[RNG_RandS(*Seed) % BEN_WORDCOUNT]);
+}
+
+size_t BEN_CreateFile(const char *FileName, enum BEN_Shape Shape, size_t Size, RNG_Seed Seed)
+{
+    FILE *File = fopen(FileName, "w");
+
+    if (File == NULL)
+    {
+        printf("Unable to open %s: %s\n", FileName, strerror(errno));
+        return 0;
+    }
+
+    size_t Count = 0;
+
+    // The numeric shape has a fixed number of fields which grow
+    if (Shape == BEN_SHAPE_NUMBERS)
+    {
+        if (!BEN_WriteNumbers(File, Size, &Seed))
+        {
+            fclose(File);
+            return 0;
+        }
+
+        Count = 3;
+    }
+
+    // The other shapes add fields until they are large enough
+    else
+        for (; (size_t)ftell(File) < Size; ++Count)
+            switch (Shape)
+            {
+                case (BEN_SHAPE_DEEP):
+                    BEN_WriteDeepField(File, Count, &Seed);
+                    break;
+
+                case (BEN_SHAPE_STRINGS):
+                    BEN_WriteStringField(File, Count, &Seed);
+                    break;
+
+                default:
+                    BEN_WriteWideField(File, Count, Shape == BEN_SHAPE_COMMENTS, &Seed);
+                    break;
+            }
+
+    if (fclose(File) != 0)
+    {
+        printf("Unable to write %s: %s\n", FileName, strerror(errno));
+        return 0;
+    }
+
+    return Count;
+}
+
+void BEN_WriteWideField(FILE *File, size_t Pos, bool Comments, RNG_Seed *Seed)
+{
+    // Most of the text is comments, both line comments and multiline comments
+    if (Comments)
+    {
+        for (size_t Line = 0, Lines = 2 + RNG_RandS(*Seed) % 4; Line < Lines; ++Line)
+        {
+            fprintf(File, "// ");
+            BEN_WriteWords(File, 4 + RNG_RandS(*Seed) % 8, Seed);
+            fprintf(File, "\n");
+        }
+
+        if (Pos % 4 == 0)
+        {
+            fprintf(File, "/* ");
+            BEN_WriteWords(File, 8, Seed);
+            fprintf(File, "\n   ");
+            BEN_WriteWords(File, 8, Seed);
+            fprintf(File, " */\n");
+        }
+    }
+
+    // Every fourth field has the same type
+    switch (Pos % 4)
+    {
+        case (0):
+            fprintf(File, "field%lu = %u;", Pos, RNG_RandS(*Seed) % 1000000000);
+            break;
+
+        case (1):
+            fprintf(File, "field%lu = %.6f;", Pos, RNG_RandSf(*Seed) * 1000.0);
+            break;
+
+        case (2):
+            fprintf(File, "field%lu = \"", Pos);
+            BEN_WriteWords(File, 1 + RNG_RandS(*Seed) % 3, Seed);
+            fprintf(File, "\";");
+            break;
+
+        default:
+            fprintf(File, "field%lu = %s;", Pos, ((RNG_RandS(*Seed) % 2 == 0) ? ("true") : ("false")));
+            break;
+    }
+
+    if (Comments)
+    {
+        fprintf(File, " // ");
+        BEN_WriteWords(File, 3, Seed);
+    }
+
+    fprintf(File, "\n");
+}
+
+void BEN_WriteDeepField(FILE *File, size_t Pos, RNG_Seed *Seed)
+{
+    fprintf(File, "tree%lu = {\n", Pos);
+
+    // Every level has a value and all but the last has the next level
+    for (size_t Level = 1; Level <= BEN_DEPTH; ++Level)
+    {
+        fprintf(File, "%*svalue = %u;\n", (int)(Level * 4), "", RNG_RandS(*Seed) % 100000);
+
+        if (Level < BEN_DEPTH)
+            fprintf(File, "%*snext = {\n", (int)(Level * 4), "");
+    }
+
+    for (size_t Level = BEN_DEPTH; Level > 0; --Level)
+        fprintf(File, "%*s};\n", (int)((Level - 1) * 4), "");
+}
+
+void BEN_WriteStringField(FILE *File, size_t Pos, RNG_Seed *Seed)
+{
+    // Every fourth field is a list of short strings
+    if (Pos % 4 == 3)
+    {
+        fprintf(File, "text%lu = [", Pos);
+
+        for (size_t Element = 0; Element < 4; ++Element)
+        {
+            fprintf(File, "%s\"", ((Element > 0) ? (", ") : ("")));
+            BEN_WriteWords(File, 1 + RNG_RandS(*Seed) % 2, Seed);
+            fprintf(File, "\"");
+        }
+
+        fprintf(File, "];\n");
+        return;
+    }
+
+    // The other fields are long strings with special characters in them
+    fprintf(File, "text%lu = \"", Pos);
+
+    for (size_t Part = 0, Parts = 1 + RNG_RandS(*Seed) % 6; Part < Parts; ++Part)
+    {
+        BEN_WriteWords(File, 2 + RNG_RandS(*Seed) % 6, Seed);
+
+        switch (RNG_RandS(*Seed) % 4)
+        {
+            case (0):
+                fprintf(File, "\\n");
+                break;
+
+            case (1):
+                fprintf(File, " \\\"quoted\\\" ");
+                break;
+
+            case (2):
+                fprintf(File, "\\\\");
+                break;
+
+            default:
+                fprintf(File, " 'single; {braces}, [brackets]' ");
+                break;
+        }
+    }
+
+    fprintf(File, "\";\n");
+}
+
+bool BEN_WriteNumbers(FILE *File, size_t Size, RNG_Seed *Seed)
+{
+    // A third of the file is signed integers, a third is doubles and a third is a matrix of doubles
+    fprintf(File, "ints = [");
+
+    for (size_t Pos = 0; (size_t)ftell(File) < Size / 3; ++Pos)
+    {
+        int32_t Value = (int32_t)(RNG_RandS(*Seed) % 2000000) - 1000000;
+        fprintf(File, "%s%d", ((Pos == 0) ? ("") : ((Pos % BEN_ROWSIZE == 0) ? (",\n        ") : (", "))), Value);
+    }
+
+    fprintf(File, "];\ndoubles = [");
+
+    for (size_t Pos = 0; (size_t)ftell(File) < Size / 3 * 2; ++Pos)
+        fprintf(File, "%s%.9f", ((Pos == 0) ? ("") : ((Pos % BEN_ROWSIZE == 0) ? (",\n           ") : (", "))), (RNG_RandSf(*Seed) - 0.5) * 1e6);
+
+    fprintf(File, "];\nmatrix = [");
+
+    // The rows must be complete so they all have the same length
+    for (size_t Row = 0; Row == 0 || (size_t)ftell(File) < Size; ++Row)
+    {
+        fprintf(File, "%s[", ((Row > 0) ? (",\n          ") : ("")));
+
+        for (size_t Pos = 0; Pos < BEN_ROWSIZE; ++Pos)
+            fprintf(File, "%s%.6f", ((Pos > 0) ? (", ") : ("")), RNG_RandSf(*Seed) * 1e3);
+
+        fprintf(File, "]");
+    }
+
+    fprintf(File, "];\n");
+
+    return !ferror(File);
+}
+
+void BEN_SetEntry(SET_TranslationTable *Table, char *Name, SET_DataType Type, size_t Size, uint8_t Depth, size_t Offset)
+{
+    SET_InitTranslationTable(Table);
+    Table->name = Name;
+    Table->type = Type;
+    Table->size = Size;
+    Table->depth = Depth;
+    Table->offset = Offset;
+}
+
+bool BEN_CreateTable(BEN_Table *Table, enum BEN_Shape Shape, size_t Count)
+{
+    Table->count = Count;
+    Table->table = (SET_TranslationTable *)malloc(sizeof(SET_TranslationTable) * Count);
+    Table->names = (char **)malloc(sizeof(char *) * Count);
+
+    if (Table->table == NULL || Table->names == NULL)
+        return false;
+
+    for (char **List = Table->names, **EndList = Table->names + Count; List < EndList; ++List)
+        *List = NULL;
+
+    // The numeric shape has fixed names
+    if (Shape == BEN_SHAPE_NUMBERS)
+    {
+        BEN_SetEntry(Table->table, "ints", SET_DATATYPE_SINT32, sizeof(int32_t), 1, 0);
+        BEN_SetEntry(Table->table + 1, "doubles", SET_DATATYPE_DOUBLE, sizeof(double), 1, sizeof(void *));
+        BEN_SetEntry(Table->table + 2, "matrix", SET_DATATYPE_DOUBLE, sizeof(double), 2, sizeof(void *) * 2);
+        Table->size = sizeof(void *) * 3;
+
+        return true;
+    }
+
+    // Each level of the deep shape is a struct of the value and the next level, every value takes up 8 bytes
+    if (Shape == BEN_SHAPE_DEEP)
+    {
+        Table->levels = (SET_TranslationTable *)malloc(sizeof(SET_TranslationTable) * BEN_DEPTH * 2);
+
+        if (Table->levels == NULL)
+            return false;
+
+        for (size_t Level = 0; Level < BEN_DEPTH; ++Level)
+        {
+            SET_TranslationTable *Entries = Table->levels + Level * 2;
+            BEN_SetEntry(Entries, "value", SET_DATATYPE_UINT32, sizeof(uint32_t), 0, 0);
+            BEN_SetEntry(Entries + 1, "next", SET_DATATYPE_STRUCT, sizeof(uint64_t) * (BEN_DEPTH - Level - 1), 0, sizeof(uint64_t));
+            Entries[1].sub = Entries + 2;
+            Entries[1].count = ((Level + 2 < BEN_DEPTH) ? (2) : (1));
+        }
+    }
+
+    // One entry for each field
+    size_t FieldSize = ((Shape == BEN_SHAPE_DEEP) ? (sizeof(uint64_t) * BEN_DEPTH) : (sizeof(uint64_t)));
+    const char *Prefix = ((Shape == BEN_SHAPE_DEEP) ? ("tree") : ((Shape == BEN_SHAPE_STRINGS) ? ("text") : ("field")));
+
+    for (size_t Pos = 0; Pos < Count; ++Pos)
+    {
+        char Name[32];
+        sprintf(Name, "%s%lu", Prefix, Pos);
+        Table->names[Pos] = (char *)malloc(sizeof(char) * (strlen(Name) + 1));
+
+        if (Table->names[Pos] == NULL)
+            return false;
+
+        strcpy(Table->names[Pos], Name);
+        SET_TranslationTable *Entry = Table->table + Pos;
+        size_t Offset = FieldSize * Pos;
+
+        switch (Shape)
+        {
+            case (BEN_SHAPE_DEEP):
+                BEN_SetEntry(Entry, Table->names[Pos], SET_DATATYPE_STRUCT, FieldSize, 0, Offset);
+                Entry->sub = Table->levels;
+                Entry->count = 2;
+                break;
+
+            case (BEN_SHAPE_STRINGS):
+                BEN_SetEntry(Entry, Table->names[Pos], SET_DATATYPE_STR, sizeof(char *), ((Pos % 4 == 3) ? (1) : (0)), Offset);
+                break;
+
+            default:
+            {
+                const SET_DataType Types[] = {SET_DATATYPE_UINT32, SET_DATATYPE_DOUBLE, SET_DATATYPE_STR, SET_DATATYPE_BOOL};
+                const size_t Sizes[] = {sizeof(uint32_t), sizeof(double), sizeof(char *), sizeof(bool)};
+                BEN_SetEntry(Entry, Table->names[Pos], Types[Pos % 4], Sizes[Pos % 4], 0, Offset);
+                break;
+            }
+        }
+    }
+
+    Table->size = FieldSize * Count;
+
+    return true;
+}
+
+int BEN_CompareSample(const void *Sample1, const void *Sample2)
+{
+    uint64_t Value1 = ((const BEN_Sample *)Sample1)->time;
+    uint64_t Value2 = ((const BEN_Sample *)Sample2)->time;
+
+    return (Value1 > Value2) - (Value1 < Value2);
+}
+
+bool BEN_AddResult(BEN_Results *Results, enum BEN_Shape Shape, size_t Size, enum BEN_Phase Phase, BEN_Sample *Samples, size_t Count)
+{
+    // Make room
+    if (Results->count == Results->length)
+    {
+        size_t Length = ((Results->length > 0) ? (Results->length * 2) : (64));
+
+#define _BEN_GROW(Field) \
+        { \
+            void *New = realloc(Results->Field, sizeof(*Results->Field) * Length); \
+            if (New == NULL) \
+                return false; \
+            Results->Field = New; \
+        }
+
+        _BEN_GROW(shape);
+        _BEN_GROW(size);
+        _BEN_GROW(phase);
+        _BEN_GROW(samples);
+        _BEN_GROW(mbps);
+        _BEN_GROW(p50);
+        _BEN_GROW(min);
+        _BEN_GROW(max);
+        _BEN_GROW(allocs);
+        _BEN_GROW(peak);
+#undef _BEN_GROW
+
+        Results->length = Length;
+    }
+
+    // Get the statistics, the allocations are the same every time so any sample can be used
+    qsort(Samples, Count, sizeof(BEN_Sample), &BEN_CompareSample);
+    size_t Peak = 0;
+
+    for (BEN_Sample *List = Samples, *EndList = Samples + Count; List < EndList; ++List)
+        if (List->peak > Peak)
+            Peak = List->peak;
+
+    size_t Line = Results->count++;
+    Results->shape[Line] = Shape;
+    Results->size[Line] = Size;
+    Results->phase[Line] = Phase;
+    Results->samples[Line] = Count;
+    Results->p50[Line] = Samples[Count * 50 / 100].time;
+    Results->min[Line] = Samples[0].time;
+    Results->max[Line] = Samples[Count - 1].time;
+    Results->mbps[Line] = (double)Size / 1e6 / ((double)((Results->p50[Line] > 0) ? (Results->p50[Line]) : (1)) / 1e9);
+    Results->allocs[Line] = Samples[0].allocs;
+    Results->peak[Line] = Peak;
+
+    printf("%-8s %9lu B  %-9s %10.2f MB/s  p50 %12lu ns  %10lu allocs  %11lu B peak\n", BEN_ShapeNames[Shape], Size, BEN_PhaseNames[Phase], Results->mbps[Line], Results->p50[Line], Results->allocs[Line], Results->peak[Line]);
+
+    return true;
+}
+
+bool BEN_Run(BEN_Results *Results, const char *FileName, enum BEN_Shape Shape, size_t Size, const BEN_Table *Table)
+{
+    size_t Repeat = BEN_REPEATBYTES / Size;
+
+    if (Repeat < BEN_MINREPEAT)
+        Repeat = BEN_MINREPEAT;
+
+    else if (Repeat > BEN_MAXREPEAT)
+        Repeat = BEN_MAXREPEAT;
+
+    // The table is compiled once like a program would do at startup, without it the time of translating a wide struct grows with the square of the number of fields
+    SET_CompiledTable *Compiled = SET_CompileTranslationTable(Table->table, Table->count);
+
+    if (Compiled == NULL)
+    {
+        printf("Unable to compile translation table: %s\n", SET_GetError());
+        return false;
+    }
+
+    BEN_Sample *Samples = (BEN_Sample *)malloc(sizeof(BEN_Sample) * BEN_PHASE_COUNT * Repeat);
+    void *Struct = malloc(Table->size);
+
+    if (Samples == NULL || Struct == NULL)
+    {
+        printf("Unable to allocate memory\n");
+        SET_DestroyCompiledTable(Compiled);
+        free(Samples);
+        free(Struct);
+        return false;
+    }
+
+    for (BEN_Sample *List = Samples, *EndList = Samples + BEN_PHASE_COUNT * Repeat; List < EndList; ++List)
+        BEN_InitSample(List);
+
+    for (size_t Run = 0; Run < Repeat; ++Run)
+    {
+        BEN_Sample *Sample = Samples + Run;
+
+        // Read the file
+        BEN_StartSample(Sample + BEN_PHASE_LOAD * Repeat);
+        char *String = FIL_Load(FileName);
+        BEN_StopSample(Sample + BEN_PHASE_LOAD * Repeat);
+
+        if (String == NULL)
+        {
+            printf("Unable to load %s: %s\n", FileName, FIL_GetError());
+            SET_DestroyCompiledTable(Compiled);
+            free(Samples);
+            free(Struct);
+            return false;
+        }
+
+        // The three passes of the original parser, each one uses the result of the one before
+        BEN_StartSample(Sample + BEN_PHASE_CLEAN * Repeat);
+        char *Clean = _SET_CleanString(String);
+        BEN_StopSample(Sample + BEN_PHASE_CLEAN * Repeat);
+
+        BEN_StartSample(Sample + BEN_PHASE_SPLIT * Repeat);
+        SET_CodeStruct *Code = ((Clean != NULL) ? (_SET_SplitString(Clean)) : (NULL));
+        BEN_StopSample(Sample + BEN_PHASE_SPLIT * Repeat);
+
+        BEN_StartSample(Sample + BEN_PHASE_CONVERT * Repeat);
+        SET_DataStruct *Data = NULL;
+
+        DIC_Dict *Types = ((Code != NULL) ? (_SET_BuildTypeDict()) : (NULL));
+
+        if (Types != NULL)
+        {
+            Data = _SET_ConvertStruct(Code, Types);
+            DIC_DestroyDict(Types);
+        }
+
+        BEN_StopSample(Sample + BEN_PHASE_CONVERT * Repeat);
+
+        if (Data == NULL)
+        {
+            printf("Unable to convert %s: %s\n", FileName, SET_GetError());
+            free(String);
+            free(Clean);
+            if (Code != NULL)
+                SET_DestroyCodeStruct(Code);
+            SET_DestroyCompiledTable(Compiled);
+            free(Samples);
+            free(Struct);
+            return false;
+        }
+
+        SET_DestroyCodeStruct(Code);
+        free(Clean);
+        SET_DestroyDataStruct(Data);
+
+        // The single pass parser changes the text
+        BEN_StartSample(Sample + BEN_PHASE_PARSE * Repeat);
+        Data = _SET_ParseText(String, NULL, NULL, false);
+        BEN_StopSample(Sample + BEN_PHASE_PARSE * Repeat);
+        free(String);
+
+        if (Data == NULL)
+        {
+            printf("Unable to parse %s: %s\n", FileName, SET_GetError());
+            SET_DestroyCompiledTable(Compiled);
+            free(Samples);
+            free(Struct);
+            return false;
+        }
+
+        // Translate it into a struct, every field must be used
+        BEN_StartSample(Sample + BEN_PHASE_TRANSLATE * Repeat);
+        bool Translated = SET_TranslateCompiled(Struct, Data, Compiled, SET_TRANSLATIONMODE_FILL | SET_TRANSLATIONMODE_EMPTY);
+        BEN_StopSample(Sample + BEN_PHASE_TRANSLATE * Repeat);
+
+        if (!Translated)
+        {
+            printf("Unable to translate %s: %s\n", FileName, SET_GetError());
+            SET_DestroyDataStruct(Data);
+            SET_DestroyCompiledTable(Compiled);
+            free(Samples);
+            free(Struct);
+            return false;
+        }
+
+        _SET_ReverseTranslation(Struct, Data, Table->table, Table->count);
+        SET_DestroyDataStruct(Data);
+    }
+
+    for (enum BEN_Phase Phase = 0; Phase < BEN_PHASE_COUNT; ++Phase)
+        if (!BEN_AddResult(Results, Shape, Size, Phase, Samples + Phase * Repeat, Repeat))
+        {
+            printf("Unable to allocate memory\n");
+            SET_DestroyCompiledTable(Compiled);
+            free(Samples);
+            free(Struct);
+            return false;
+        }
+
+    SET_DestroyCompiledTable(Compiled);
+    free(Samples);
+    free(Struct);
+
+    return true;
+}
+
+void BEN_InitResults(BEN_Results *Struct)
+{
+    Struct->count = 0;
+    Struct->length = 0;
+    Struct->shape = NULL;
+    Struct->size = NULL;
+    Struct->phase = NULL;
+    Struct->samples = NULL;
+    Struct->mbps = NULL;
+    Struct->p50 = NULL;
+    Struct->min = NULL;
+    Struct->max = NULL;
+    Struct->allocs = NULL;
+    Struct->peak = NULL;
+}
+
+void BEN_InitTable(BEN_Table *Struct)
+{
+    Struct->table = NULL;
+    Struct->count = 0;
+    Struct->levels = NULL;
+    Struct->names = NULL;
+    Struct->size = 0;
+}
+
+void BEN_InitSample(BEN_Sample *Struct)
+{
+    Struct->time = 0;
+    Struct->allocs = 0;
+    Struct->peak = 0;
+}
+
+void BEN_DestroyResults(BEN_Results *Results)
+{
+    free(Results->shape);
+    free(Results->size);
+    free(Results->phase);
+    free(Results->samples);
+    free(Results->mbps);
+    free(Results->p50);
+    free(Results->min);
+    free(Results->max);
+    free(Results->allocs);
+    free(Results->peak);
+}
+
+void BEN_DestroyTable(BEN_Table *Table)
+{
+    if (Table->names != NULL)
+        for (char **List = Table->names, **EndList = Table->names + Table->count; List < EndList; ++List)
+            free(*List);
+
+    free(Table->names);
+    free(Table->table);
+    free(Table->levels);
+}
+
+int main(int argc, char **argv)
+{
+    const char *FileName = ((argc > 1) ? (argv[1]) : ("SettingsBench.csv"));
+
+    BEN_Results Results;
+    BEN_InitResults(&Results);
+
+    // Keep the hash table alive between dicts so it is not part of the timing
+    DIC_Dict *KeepAlive = DIC_CreateDict(1);
+
+    if (KeepAlive == NULL)
+    {
+        printf("Unable to create dict: %s\n", DIC_GetError());
+        return -1;
+    }
+
+    for (enum BEN_Shape Shape = 0; Shape < BEN_SHAPE_COUNT; ++Shape)
+        for (const size_t *Size = BEN_Sizes, *EndSize = BEN_Sizes + sizeof(BEN_Sizes) / sizeof(*BEN_Sizes); Size < EndSize; ++Size)
+        {
+            // Create the file
+            char CorpusName[64];
+            sprintf(CorpusName, "SettingsBench_%s_%lu.set", BEN_ShapeNames[Shape], *Size);
+            size_t Count = BEN_CreateFile(CorpusName, Shape, *Size, Shape * 16 + (Size - BEN_Sizes) + 1);
+
+            if (Count == 0)
+                return -1;
+
+            struct stat FileInfo;
+
+            if (stat(CorpusName, &FileInfo) != 0)
+            {
+                printf("Unable to find %s: %s\n", CorpusName, strerror(errno));
+                return -1;
+            }
+
+            // Create the translation table
+            BEN_Table Table;
+            BEN_InitTable(&Table);
+
+            if (!BEN_CreateTable(&Table, Shape, Count))
+            {
+                printf("Unable to create translation table\n");
+                return -1;
+            }
+
+            if (!BEN_Run(&Results, CorpusName, Shape, (size_t)FileInfo.st_size, &Table))
+                return -1;
+
+            BEN_DestroyTable(&Table);
+        }
+
+    DIC_DestroyDict(KeepAlive);
+
+    // Save the results
+    if (!FIL_SaveCSV(FileName, "shape,size,phase,samples,mbps,p50,min,max,allocs,peak", ",", Results.count, 10,
+                     Results.shape, FIL_DATATYPE_UINT8, Results.size, FIL_DATATYPE_UINT64, Results.phase, FIL_DATATYPE_UINT8, Results.samples, FIL_DATATYPE_UINT64,
+                     Results.mbps, FIL_DATATYPE_DOUBLE, Results.p50, FIL_DATATYPE_UINT64, Results.min, FIL_DATATYPE_UINT64, Results.max, FIL_DATATYPE_UINT64,
+                     Results.allocs, FIL_DATATYPE_UINT64, Results.peak, FIL_DATATYPE_UINT64))
+    {
+        printf("Unable to save results: %s\n", FIL_GetError());
+        return -1;
+    }
+
+    // The peak of the whole process includes memory the counters do not see, like the buffers of the files
+    struct rusage Usage;
+    getrusage(RUSAGE_SELF, &Usage);
+
+    printf("Saved %lu lines to %s, the largest resident size was %ld kB\n", Results.count, FileName, Usage.ru_maxrss);
+
+    BEN_DestroyResults(&Results);
+
+    return 0;
+}